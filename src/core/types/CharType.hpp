@@ -4,7 +4,12 @@
 
 #include "DataType.hpp"
 #include "exceptions/DataTypeException.hpp"
+#include "util/Expected.hpp"
+#include "util/BlankPadding.hpp"
+#include "values/CompactString.hpp"
 #include <string>
+#include <string_view>
+#include <span>
 #include <algorithm>
 
 namespace db::types {
@@ -19,6 +24,24 @@ namespace db::types {
             validateLength(length);
         }
 
+        // Validación de la longitud declarada sin lanzar
+        [[nodiscard]] static constexpr Expected<void> checkLength(size_t len) noexcept {
+            if (len == 0) {
+                return TypeError(TypeErrorCode::LENGTH_ZERO);
+            }
+            if (len > MAX_LENGTH) {
+                return TypeError(TypeErrorCode::LENGTH_TOO_LARGE, MAX_LENGTH);
+            }
+            return {};
+        }
+
+        [[nodiscard]] static Expected<CharType> tryCreate(bool isNullable, size_t len) {
+            if (const auto checked = checkLength(len); !checked) {
+                return checked.error();
+            }
+            return CharType(isNullable, len);
+        }
+
         [[nodiscard]] std::string getName() const override {
             return "CHAR(" + std::to_string(length) + ")";
         }
@@ -35,38 +58,96 @@ namespace db::types {
             return std::make_unique<CharType>(nullable, length);
         }
 
+        [[nodiscard]] TypeDescriptor getDescriptor() const override {
+            return TypeDescriptor::charType(length, nullable);
+        }
+
         [[nodiscard]] constexpr size_t getLength() const noexcept {
             return length;
         }
 
         // Formatea el valor según las reglas de CHAR (relleno con espacios)
         [[nodiscard]] std::string formatValue(const std::string& value) const {
+            return tryFormatValue(value).value();
+        }
+
+        [[nodiscard]] Expected<std::string> tryFormatValue(const std::string& value) const {
             if (!isValidValue(value)) {
-                throw DataTypeException("Value exceeds maximum length");
+                return TypeError(TypeErrorCode::VALUE_TOO_LONG, static_cast<uint32_t>(length));
             }
 
-            std::string formatted = value;
-            // Rellenar con espacios hasta la longitud fija
-            formatted.resize(length, PADDING_CHAR);
+            // Rellenar con espacios hasta la longitud fija, sin realojar
+            std::string formatted;
+            formatted.reserve(length);
+            formatted.append(value).append(length - value.size(), PADDING_CHAR);
             return formatted;
         }
 
-        [[nodiscard]] bool isValidValue(const std::string& value) const noexcept {
+        [[nodiscard]] bool isValidValue(std::string_view value) const noexcept {
             return value.length() <= length;
         }
 
+        // Almacenamiento recortado: se guardan los bytes sin el relleno final y la
+        // longitud n la da el tipo, así que 'Y' en un CHAR(2000) cabe en el handle.
+        // El relleno se añade sólo al leer (formatStored o PaddingKernels).
+        [[nodiscard]] Expected<CompactString> tryMakeValue(std::string_view value, StringArena& arena) const {
+            if (!isValidValue(value)) {
+                return TypeError(TypeErrorCode::VALUE_TOO_LONG, static_cast<uint32_t>(length));
+            }
+            return CompactString::make(trimPadding(value, PADDING_CHAR), arena);
+        }
+
+        // Espacios que le faltan a un valor recortado; VALUE_TOO_LONG si viene de una
+        // columna más ancha y no cabe
+        [[nodiscard]] Expected<size_t> paddingFor(std::string_view stored) const noexcept {
+            if (stored.size() > length) {
+                return TypeError(TypeErrorCode::VALUE_TOO_LONG, static_cast<uint32_t>(length));
+            }
+            return length - stored.size();
+        }
+
+        // Valor recortado de tryMakeValue -> texto de n caracteres
+        [[nodiscard]] std::string formatStored(const CompactString& stored) const {
+            return tryFormatStored(stored).value();
+        }
+
+        [[nodiscard]] Expected<std::string> tryFormatStored(const CompactString& stored) const {
+            const auto padding = paddingFor(stored.view());
+            if (!padding) {
+                return padding.error();
+            }
+            std::string formatted;
+            formatted.reserve(length);
+            formatted.append(stored.view()).append(*padding, PADDING_CHAR);
+            return formatted;
+        }
+
+        // Orden con relleno en blanco sobre valores recortados, sin rellenar ninguno
+        [[nodiscard]] static int compare(const CompactString& value1, const CompactString& value2) noexcept {
+            if (value1 == value2) {
+                return 0;
+            }
+            return compareBlankPadded(value1.view(), value2.view(), PADDING_CHAR);
+        }
+
         // Compara dos valores CHAR ignorando espacios al final
-        [[nodiscard]] static bool compareValues(const std::string& value1, const std::string& value2) noexcept {
-            auto it1 = value1.rbegin();
-            auto it2 = value2.rbegin();
+        [[nodiscard]] static bool compareValues(std::string_view value1, std::string_view value2) noexcept {
+            return compare(value1, value2) == 0;
+        }
 
-            // Saltar espacios al final de ambas cadenas
-            while (it1 != value1.rend() && *it1 == PADDING_CHAR) ++it1;
-            while (it2 != value2.rend() && *it2 == PADDING_CHAR) ++it2;
+        // Orden de CHAR con relleno en blanco, sin copias: -1, 0 o 1
+        [[nodiscard]] static int compare(std::string_view value1, std::string_view value2) noexcept {
+            return compareBlankPadded(value1, value2, PADDING_CHAR);
+        }
 
-            // Comparar el resto de los caracteres
-            return std::string(value1.begin(), it1.base()) ==
-                   std::string(value2.begin(), it2.base());
+        // Compara una columna contra una constante; la constante se recorta una sola vez
+        static void compareBatch(std::span<const std::string_view> values, std::string_view constant,
+                                 std::span<int8_t> results) noexcept {
+            const std::string_view trimmed = trimPadding(constant, PADDING_CHAR);
+            const size_t count = std::min(values.size(), results.size());
+            for (size_t i = 0; i < count; ++i) {
+                results[i] = static_cast<int8_t>(compareBlankPadded(values[i], trimmed, PADDING_CHAR));
+            }
         }
 
     private:
@@ -74,12 +155,7 @@ namespace db::types {
         size_t length;
 
         constexpr void validateLength(size_t len) {
-            if (len == 0) {
-                throw DataTypeException("Length must be greater than 0");
-            }
-            if (len > MAX_LENGTH) {
-                throw DataTypeException("Length cannot exceed " + std::to_string(MAX_LENGTH));
-            }
+            checkLength(len).value();
         }
     };
 
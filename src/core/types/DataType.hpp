@@ -2,6 +2,7 @@
 #ifndef DATA_TYPE_HPP
 #define DATA_TYPE_HPP
 
+#include "TypeDescriptor.hpp"
 #include <string>
 #include <memory>
 
@@ -14,6 +15,8 @@ namespace db::types {  // Namespace unificado en C++17+
         [[nodiscard]] virtual size_t getSize() const = 0;
         [[nodiscard]] virtual bool isNullable() const = 0;
         [[nodiscard]] virtual std::unique_ptr<DataType> clone() const = 0;
+        // Resumen sin vtable para los kernels: una llamada virtual por columna, no por valor
+        [[nodiscard]] virtual TypeDescriptor getDescriptor() const = 0;
     };
 
 } // namespace db::types
@@ -4,9 +4,11 @@
 
 #include "DataType.hpp"
 #include "exceptions/DataTypeException.hpp"
-#include <chrono>
+#include "util/Expected.hpp"
+#include "util/CivilCalendar.hpp"
+#include "util/DigitWriter.hpp"
+#include <cstring>
 #include <string>
-#include <format>
 #include <ctime>
 
 namespace db::types {
@@ -37,83 +39,72 @@ namespace db::types {
             return std::make_unique<DateType>(nullable);
         }
 
-        // Validar una fecha usando std::chrono
+        [[nodiscard]] TypeDescriptor getDescriptor() const override {
+            return TypeDescriptor::date(nullable);
+        }
+
+        // Validar una fecha
         [[nodiscard]] bool isValidDate(int year, int month, int day,
                                      int hour = 0, int minute = 0, int second = 0) const noexcept {
-            try {
-                if (year < MIN_YEAR || year > MAX_YEAR) {
-                    return false;
-                }
-
-                // Validar el rango de los componentes
-                if (month < 1 || month > 12 || day < 1 || day > 31 ||
-                    hour < 0 || hour > 23 || minute < 0 || minute > 59 ||
-                    second < 0 || second > 59) {
-                    return false;
-                }
-
-                // Usar std::chrono para validación adicional
-                std::chrono::year_month_day ymd{
-                    std::chrono::year{year},
-                    std::chrono::month{static_cast<unsigned>(month)},
-                    std::chrono::day{static_cast<unsigned>(day)}
-                };
-
-                return ymd.ok();
-            } catch (...) {
-                return false;
-            }
+            return isValidFields(year, month, day, hour, minute, second);
+        }
+
+        // Validación aritmética sin construir objetos de std::chrono
+        [[nodiscard]] static constexpr bool isValidFields(int year, int month, int day,
+                                                         int hour = 0, int minute = 0, int second = 0) noexcept {
+            return year >= MIN_YEAR && year <= MAX_YEAR &&
+                   month >= 1 && month <= 12 &&
+                   day >= 1 && day <= daysInMonth(year, month) &&
+                   hour >= 0 && hour <= 23 && minute >= 0 && minute <= 59 &&
+                   second >= 0 && second <= 59;
         }
 
         // Formatear fecha según el formato de Oracle
         [[nodiscard]] std::string formatDate(int year, int month, int day,
                                            int hour = 0, int minute = 0, int second = 0) const {
+            return tryFormatDate(year, month, day, hour, minute, second).value();
+        }
+
+        [[nodiscard]] Expected<std::string> tryFormatDate(int year, int month, int day,
+                                                        int hour = 0, int minute = 0, int second = 0) const {
             if (!isValidDate(year, month, day, hour, minute, second)) {
-                throw DataTypeException("Invalid date");
+                return TypeError(TypeErrorCode::INVALID_DATE);
             }
 
-            // Si la hora, minuto y segundo son 0, solo mostrar la fecha
-            if (hour == 0 && minute == 0 && second == 0) {
-                return std::format("{:02d}-{:02d}-{:02d}",
-                    std::abs(year), month, day) +
-                    (year < 0 ? " BC" : "");
+            // Si la hora, minuto y segundo son 0, solo se muestra la fecha
+            char buffer[32];
+            char* out = writeDigits(buffer, static_cast<uint64_t>(year < 0 ? -year : year), 2);
+            *out++ = '-';
+            out = writeTwoDigits(out, static_cast<uint32_t>(month));
+            *out++ = '-';
+            out = writeTwoDigits(out, static_cast<uint32_t>(day));
+            if (hour != 0 || minute != 0 || second != 0) {
+                *out++ = ' ';
+                out = writeTwoDigits(out, static_cast<uint32_t>(hour));
+                *out++ = ':';
+                out = writeTwoDigits(out, static_cast<uint32_t>(minute));
+                *out++ = ':';
+                out = writeTwoDigits(out, static_cast<uint32_t>(second));
             }
-
-            // Mostrar fecha y hora completa
-            return std::format("{:02d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}",
-                std::abs(year), month, day, hour, minute, second) +
-                (year < 0 ? " BC" : "");
+            if (year < 0) {
+                std::memcpy(out, " BC", 3);
+                out += 3;
+            }
+            return std::string(buffer, out);
         }
 
-        // Comparar dos fechas
+        // Comparar dos fechas como segundos desde la época; no hay casos de error
         [[nodiscard]] static int compareDates(
             int year1, int month1, int day1,
             int year2, int month2, int day2,
             int hour1 = 0, int minute1 = 0, int second1 = 0,
             int hour2 = 0, int minute2 = 0, int second2 = 0
         ) noexcept {
-            try {
-                using namespace std::chrono;
-
-                // Crear puntos en el tiempo para comparación
-                auto tp1 = sys_days{year_month_day{
-                    year{year1},
-                    month{static_cast<unsigned>(month1)},
-                    day{static_cast<unsigned>(day1)}
-                }} + hours{hour1} + minutes{minute1} + seconds{second1};
-
-                auto tp2 = sys_days{year_month_day{
-                    year{year2},
-                    month{static_cast<unsigned>(month2)},
-                    day{static_cast<unsigned>(day2)}
-                }} + hours{hour2} + minutes{minute2} + seconds{second2};
-
-                if (tp1 < tp2) return -1;
-                if (tp1 > tp2) return 1;
-                return 0;
-            } catch (...) {
-                return 0;  // En caso de error, considerar fechas iguales
-            }
+            const int64_t tp1 = daysFromCivil(year1, month1, day1) * SECONDS_PER_DAY
+                                + hour1 * int64_t{3600} + minute1 * int64_t{60} + second1;
+            const int64_t tp2 = daysFromCivil(year2, month2, day2) * SECONDS_PER_DAY
+                                + hour2 * int64_t{3600} + minute2 * int64_t{60} + second2;
+            return (tp1 > tp2) - (tp1 < tp2);
         }
 
     private:
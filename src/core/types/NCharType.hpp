@@ -4,10 +4,12 @@
 
 #include "DataType.hpp"
 #include "exceptions/DataTypeException.hpp"
+#include "util/Expected.hpp"
+#include "util/BlankPadding.hpp"
+#include "util/Utf8.hpp"
+#include "values/CompactString.hpp"
 #include <string>
 #include <string_view>
-#include <codecvt>
-#include <locale>
 
 namespace db::types {
 
@@ -21,6 +23,24 @@ namespace db::types {
             validateLength(length);
         }
 
+        // Validación de la longitud declarada sin lanzar
+        [[nodiscard]] static constexpr Expected<void> checkLength(size_t len) noexcept {
+            if (len == 0) {
+                return TypeError(TypeErrorCode::LENGTH_ZERO);
+            }
+            if (len > MAX_LENGTH) {
+                return TypeError(TypeErrorCode::LENGTH_TOO_LARGE, MAX_LENGTH);
+            }
+            return {};
+        }
+
+        [[nodiscard]] static Expected<NCharType> tryCreate(bool isNullable, size_t len) {
+            if (const auto checked = checkLength(len); !checked) {
+                return checked.error();
+            }
+            return NCharType(isNullable, len);
+        }
+
         [[nodiscard]] std::string getName() const override {
             return "NCHAR(" + std::to_string(length) + ")";
         }
@@ -37,40 +57,92 @@ namespace db::types {
             return std::make_unique<NCharType>(nullable, length);
         }
 
+        [[nodiscard]] TypeDescriptor getDescriptor() const override {
+            return TypeDescriptor::nchar(length, nullable);
+        }
+
         [[nodiscard]] constexpr size_t getLength() const noexcept {
             return length;
         }
 
-        // Mé-to-do mejorado para contar caracteres Unicode
-        [[nodiscard]] static size_t getUnicodeLength(const std::string& str) noexcept {
-            try {
-                std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> converter;
-                return converter.from_bytes(str).size();
-            } catch (...) {
-                // En caso de error de conversión, retornamos la longitud del string
-                return str.length();
-            }
+        // Cuenta caracteres Unicode sin decodificar ni reservar memoria
+        [[nodiscard]] static size_t getUnicodeLength(std::string_view str) noexcept {
+            return countUtf8CodePoints(str);
         }
 
         [[nodiscard]] std::string formatValue(const std::string& value) const {
-            if (!isValidValue(value)) {
-                throw DataTypeException("Value exceeds maximum length in characters");
+            return tryFormatValue(value).value();
+        }
+
+        [[nodiscard]] Expected<std::string> tryFormatValue(const std::string& value) const {
+            const Utf8Validation utf8 = validateUtf8(value);
+            if (!utf8.valid) {
+                return TypeError(TypeErrorCode::INVALID_UTF8, static_cast<uint32_t>(utf8.errorOffset));
             }
+            if (utf8.codePoints > length) {
+                return TypeError(TypeErrorCode::VALUE_TOO_MANY_CHARACTERS, static_cast<uint32_t>(length));
+            }
+
+            // Una sola reserva y un solo relleno con los espacios que faltan
+            const size_t padding = length - utf8.codePoints;
+            std::string result;
+            result.reserve(value.size() + padding);
+            result.append(value).append(padding, ' ');
+            return result;
+        }
+
+        // Un valor con UTF-8 mal formado nunca es válido
+        [[nodiscard]] bool isValidValue(std::string_view value) const noexcept {
+            const Utf8Validation utf8 = validateUtf8(value);
+            return utf8.valid && utf8.codePoints <= length;
+        }
 
-            std::string result = value;
-            size_t currentLength = getUnicodeLength(result);
+        // Almacenamiento recortado como en CHAR: sin el relleno final, que se
+        // añade sólo al leer (formatStored o PaddingKernels)
+        [[nodiscard]] Expected<CompactString> tryMakeValue(std::string_view value, StringArena& arena) const {
+            const Utf8Validation utf8 = validateUtf8(value);
+            if (!utf8.valid) {
+                return TypeError(TypeErrorCode::INVALID_UTF8, static_cast<uint32_t>(utf8.errorOffset));
+            }
+            if (utf8.codePoints > length) {
+                return TypeError(TypeErrorCode::VALUE_TOO_MANY_CHARACTERS, static_cast<uint32_t>(length));
+            }
+            return CompactString::make(trimPadding(value), arena);
+        }
 
-            // Agregar espacios Unicode hasta alcanzar la longitud requerida
-            while (currentLength < length) {
-                result += " ";  // Espacio UTF-8
-                currentLength++;
+        // Espacios que le faltan a un valor recortado (ya validado como UTF-8);
+        // VALUE_TOO_MANY_CHARACTERS si viene de una columna más ancha y no cabe
+        [[nodiscard]] Expected<size_t> paddingFor(std::string_view stored) const noexcept {
+            const size_t codePoints = countUtf8CodePoints(stored);
+            if (codePoints > length) {
+                return TypeError(TypeErrorCode::VALUE_TOO_MANY_CHARACTERS, static_cast<uint32_t>(length));
             }
+            return length - codePoints;
+        }
 
+        // Valor recortado de tryMakeValue -> texto de n caracteres
+        [[nodiscard]] std::string formatStored(const CompactString& stored) const {
+            return tryFormatStored(stored).value();
+        }
+
+        [[nodiscard]] Expected<std::string> tryFormatStored(const CompactString& stored) const {
+            const auto padding = paddingFor(stored.view());
+            if (!padding) {
+                return padding.error();
+            }
+            std::string result;
+            result.reserve(stored.size() + *padding);
+            result.append(stored.view()).append(*padding, ' ');
             return result;
         }
 
-        [[nodiscard]] bool isValidValue(const std::string& value) const noexcept {
-            return getUnicodeLength(value) <= length;
+        // Orden con relleno en blanco sobre valores recortados; UTF-8 conserva el
+        // orden de los puntos de código
+        [[nodiscard]] static int compare(const CompactString& value1, const CompactString& value2) noexcept {
+            if (value1 == value2) {
+                return 0;
+            }
+            return compareBlankPadded(value1.view(), value2.view());
         }
 
         // Compara dos valores NCHAR ignorando espacios al final
@@ -93,12 +165,7 @@ namespace db::types {
         size_t length;
 
         constexpr void validateLength(size_t len) {
-            if (len == 0) {
-                throw DataTypeException("Length must be greater than 0");
-            }
-            if (len > MAX_LENGTH) {
-                throw DataTypeException("Length cannot exceed " + std::to_string(MAX_LENGTH));
-            }
+            checkLength(len).value();
         }
     };
 
@@ -4,9 +4,11 @@
 
 #include "DataType.hpp"
 #include "exceptions/DataTypeException.hpp"
+#include "util/Expected.hpp"
+#include "util/Utf8.hpp"
+#include "values/CompactString.hpp"
 #include <string>
-#include <codecvt>
-#include <locale>
+#include <string_view>
 
 namespace db::types {
 
@@ -19,6 +21,24 @@ namespace db::types {
             validateLength(maxLength);
         }
 
+        // Validación de la longitud declarada sin lanzar
+        [[nodiscard]] static constexpr Expected<void> checkLength(size_t len) noexcept {
+            if (len == 0) {
+                return TypeError(TypeErrorCode::LENGTH_ZERO);
+            }
+            if (len > MAX_LENGTH) {
+                return TypeError(TypeErrorCode::LENGTH_TOO_LARGE, MAX_LENGTH);
+            }
+            return {};
+        }
+
+        [[nodiscard]] static Expected<NVarchar2Type> tryCreate(bool isNullable, size_t len) {
+            if (const auto checked = checkLength(len); !checked) {
+                return checked.error();
+            }
+            return NVarchar2Type(isNullable, len);
+        }
+
         [[nodiscard]] std::string getName() const override {
             return "NVARCHAR2(" + std::to_string(maxLength) + ")";
         }
@@ -35,28 +55,48 @@ namespace db::types {
             return std::make_unique<NVarchar2Type>(nullable, maxLength);
         }
 
+        [[nodiscard]] TypeDescriptor getDescriptor() const override {
+            return TypeDescriptor::nvarchar2(maxLength, nullable);
+        }
+
         [[nodiscard]] constexpr size_t getMaxLength() const noexcept {
             return maxLength;
         }
 
         // Cuenta caracteres Unicode usando la misma lógica que NCHAR
-        [[nodiscard]] static size_t getUnicodeLength(const std::string& str) noexcept {
-            try {
-                std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> converter;
-                return converter.from_bytes(str).size();
-            } catch (...) {
-                return str.length();
-            }
+        [[nodiscard]] static size_t getUnicodeLength(std::string_view str) noexcept {
+            return countUtf8CodePoints(str);
         }
 
-        [[nodiscard]] bool isValidValue(const std::string& value) const noexcept {
-            return getUnicodeLength(value) <= maxLength;
+        [[nodiscard]] bool isValidValue(std::string_view value) const noexcept {
+            const Utf8Validation utf8 = validateUtf8(value);
+            return utf8.valid && utf8.codePoints <= maxLength;
+        }
+
+        // Como tryFormatValue, pero devuelve el handle de 16 bytes sin copiar a un std::string
+        [[nodiscard]] Expected<CompactString> tryMakeValue(std::string_view value, StringArena& arena) const {
+            const Utf8Validation utf8 = validateUtf8(value);
+            if (!utf8.valid) {
+                return TypeError(TypeErrorCode::INVALID_UTF8, static_cast<uint32_t>(utf8.errorOffset));
+            }
+            if (utf8.codePoints > maxLength) {
+                return TypeError(TypeErrorCode::VALUE_TOO_MANY_CHARACTERS, static_cast<uint32_t>(maxLength));
+            }
+            return CompactString::make(value, arena);
         }
 
         // A diferencia de NCHAR, NVARCHAR2 no hace padding
         [[nodiscard]] std::string formatValue(const std::string& value) const {
-            if (!isValidValue(value)) {
-                throw DataTypeException("Value exceeds maximum length in characters");
+            return tryFormatValue(value).value();
+        }
+
+        [[nodiscard]] Expected<std::string> tryFormatValue(const std::string& value) const {
+            const Utf8Validation utf8 = validateUtf8(value);
+            if (!utf8.valid) {
+                return TypeError(TypeErrorCode::INVALID_UTF8, static_cast<uint32_t>(utf8.errorOffset));
+            }
+            if (utf8.codePoints > maxLength) {
+                return TypeError(TypeErrorCode::VALUE_TOO_MANY_CHARACTERS, static_cast<uint32_t>(maxLength));
             }
             return value;  // Retorna el valor tal cual, sin padding
         }
@@ -74,12 +114,7 @@ namespace db::types {
         size_t maxLength;
 
         constexpr void validateLength(size_t len) {
-            if (len == 0) {
-                throw DataTypeException("Length must be greater than 0");
-            }
-            if (len > MAX_LENGTH) {
-                throw DataTypeException("Length cannot exceed " + std::to_string(MAX_LENGTH));
-            }
+            checkLength(len).value();
         }
     };
 
@@ -1,5 +1,7 @@
 // src/core/types/NumberType.cpp
 #include "NumberType.hpp"
+#include "values/NumberValue.hpp"
+#include "kernels/NumberRangeKernels.hpp"
 #include <cmath>
 
 namespace db::types {
@@ -23,23 +25,12 @@ namespace db::types {
         // Para NUMBER(p,s), el rango es:
         // max = 10^(p-s) - 10^(-s)
         // min = -(10^(p-s) - 10^(-s))
+        // Los límites salen de tablas constexpr en lugar de llamar a std::pow por valor
+        return NumberRangeBounds::of(*this).contains(value);
+    }
 
-        // Calculamos 10^(p-s)
-        const double maxIntegerPart = std::pow(10.0, static_cast<double>(precision - scale));
-
-        // Calculamos 10^(-s)
-        const double minFraction = std::pow(10.0, -static_cast<double>(scale));
-
-        // El máximo valor permitido
-        const double maxValue = maxIntegerPart - minFraction;
-
-        // El mínimo es el negativo del máximo
-        const double minValue = -maxValue;
-
-        // Ajustamos el valor a la escala correcta para la comparación
-        const double scaledValue = std::round(value * std::pow(10.0, scale)) / std::pow(10.0, scale);
-
-        return scaledValue >= minValue && scaledValue <= maxValue;
+    bool NumberType::isInRange(const NumberValue& value) const noexcept {
+        return value.fitsIn(*this);
     }
 
 } // namespace db::types
\ No newline at end of file
@@ -3,12 +3,16 @@
 #define NUMBER_TYPE_HPP
 
 #include "NumericType.hpp"
+#include "PhysicalWidth.hpp"
 #include "exceptions/DataTypeException.hpp"
+#include "util/Expected.hpp"
 #include <string>
 #include <format>
 
 namespace db::types {
 
+    class NumberValue;
+
     class NumberType final : public NumericType {
     public:
         static constexpr size_t MAX_PRECISION = 38;
@@ -22,21 +26,43 @@ namespace db::types {
         [[nodiscard]] std::string getName() const override;
         [[nodiscard]] size_t getSize() const override;
         [[nodiscard]] std::unique_ptr<DataType> clone() const override;
+        [[nodiscard]] TypeDescriptor getDescriptor() const override {
+            return TypeDescriptor::number(precision, scale, nullable);
+        }
 
         [[nodiscard]] constexpr bool isInteger() const noexcept { return scale == 0; }
+        // Representación física más estrecha: NUMBER(9) -> int32, NUMBER(18) -> int64
+        [[nodiscard]] constexpr PhysicalLayout getPhysicalLayout() const noexcept {
+            return makePhysicalLayout(precision, scale);
+        }
         [[nodiscard]] bool isInRange(double value) const noexcept;
+        // Versión exacta: no pierde dígitos por encima de los 15-16 de un double
+        [[nodiscard]] bool isInRange(const NumberValue& value) const noexcept;
 
-    private:
-        constexpr void validatePrecisionScale(size_t p, size_t s) {
+        // Validación de NUMBER(p,s) sin lanzar
+        [[nodiscard]] static constexpr Expected<void> checkPrecisionScale(size_t p, size_t s) noexcept {
             if (p > MAX_PRECISION) {
-                throw DataTypeException("Precision cannot exceed " + std::to_string(MAX_PRECISION));
+                return TypeError(TypeErrorCode::PRECISION_TOO_LARGE, MAX_PRECISION);
             }
             if (s > MAX_SCALE) {
-                throw DataTypeException("Scale cannot exceed " + std::to_string(MAX_SCALE));
+                return TypeError(TypeErrorCode::SCALE_TOO_LARGE, MAX_SCALE);
             }
             if (s > p) {
-                throw DataTypeException("Scale cannot be greater than precision");
+                return TypeError(TypeErrorCode::SCALE_EXCEEDS_PRECISION);
+            }
+            return {};
+        }
+
+        [[nodiscard]] static Expected<NumberType> tryCreate(bool isNullable, size_t precision, size_t scale) {
+            if (const auto checked = checkPrecisionScale(precision, scale); !checked) {
+                return checked.error();
             }
+            return NumberType(isNullable, precision, scale);
+        }
+
+    private:
+        constexpr void validatePrecisionScale(size_t p, size_t s) {
+            checkPrecisionScale(p, s).value();
         }
     };
 
@@ -0,0 +1,73 @@
+// src/core/types/PhysicalWidth.hpp
+#ifndef PHYSICAL_WIDTH_HPP
+#define PHYSICAL_WIDTH_HPP
+
+#include "util/Int128.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace db::types {
+
+    // Almacenamiento nativo más estrecho para un NUMBER(p,s) guardado como
+    // entero escalado por 10^s: p <= 9 cabe en int32, p <= 18 en int64.
+    enum class PhysicalWidth : uint8_t {
+        INT32,
+        INT64,
+        INT128
+    };
+
+    struct PhysicalLayout {
+        PhysicalWidth width;
+        size_t size;       // Bytes por valor
+        size_t alignment;
+        size_t scale;      // Los valores se guardan multiplicados por 10^scale
+    };
+
+    inline constexpr size_t MAX_INT32_PRECISION = 9;
+    inline constexpr size_t MAX_INT64_PRECISION = 18;
+
+    [[nodiscard]] constexpr PhysicalWidth physicalWidthFor(size_t precision) noexcept {
+        if (precision <= MAX_INT32_PRECISION) return PhysicalWidth::INT32;
+        if (precision <= MAX_INT64_PRECISION) return PhysicalWidth::INT64;
+        return PhysicalWidth::INT128;
+    }
+
+    template<PhysicalWidth W> struct PhysicalStorage;
+    template<> struct PhysicalStorage<PhysicalWidth::INT32> { using type = int32_t; };
+    template<> struct PhysicalStorage<PhysicalWidth::INT64> { using type = int64_t; };
+    template<> struct PhysicalStorage<PhysicalWidth::INT128> { using type = int128_t; };
+
+    template<PhysicalWidth W>
+    using physical_storage_t = typename PhysicalStorage<W>::type;
+
+    [[nodiscard]] constexpr PhysicalLayout makePhysicalLayout(size_t precision, size_t scale) noexcept {
+        switch (physicalWidthFor(precision)) {
+            case PhysicalWidth::INT32:
+                return {PhysicalWidth::INT32, sizeof(int32_t), alignof(int32_t), scale};
+            case PhysicalWidth::INT64:
+                return {PhysicalWidth::INT64, sizeof(int64_t), alignof(int64_t), scale};
+            case PhysicalWidth::INT128:
+                break;
+        }
+        return {PhysicalWidth::INT128, sizeof(int128_t), alignof(int128_t), scale};
+    }
+
+    // Convierte el ancho en tiempo de ejecución en un parámetro de plantilla:
+    // un único switch por lote y kernels especializados para cada ancho.
+    template<typename F>
+    decltype(auto) dispatchPhysicalWidth(PhysicalWidth width, F&& kernel) {
+        switch (width) {
+            case PhysicalWidth::INT32:
+                return kernel(std::integral_constant<PhysicalWidth, PhysicalWidth::INT32>{});
+            case PhysicalWidth::INT64:
+                return kernel(std::integral_constant<PhysicalWidth, PhysicalWidth::INT64>{});
+            case PhysicalWidth::INT128:
+                break;
+        }
+        return kernel(std::integral_constant<PhysicalWidth, PhysicalWidth::INT128>{});
+    }
+
+} // namespace db::types
+
+#endif // PHYSICAL_WIDTH_HPP
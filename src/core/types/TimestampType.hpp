@@ -3,15 +3,25 @@
 
 #include "DataType.hpp"
 #include "exceptions/DataTypeException.hpp"
-#include <chrono>
+#include "util/Expected.hpp"
+#include "util/CivilCalendar.hpp"
+#include "util/DigitWriter.hpp"
+#include "util/PowersOfTen.hpp"
+#include "util/TimeZone.hpp"
+#include <algorithm>
+#include <array>
 #include <string>
-#include <format>
-#include <ctime>
+#include <cstring>
 #include <optional>
-#include <cmath>
+#include <string_view>
 
 namespace db::types {
 
+    // Motivo por el que unos campos no forman un TIMESTAMP válido
+    enum class TimestampError : uint8_t {
+        NONE, YEAR, MONTH, DAY, HOUR, MINUTE, SECOND, FRACTION, TIME_ZONE_OFFSET, TIME_ZONE_PRESENCE
+    };
+
     class TimestampType final : public DataType {
     public:
         static constexpr int MAX_YEAR = 9999;
@@ -19,6 +29,16 @@ namespace db::types {
         static constexpr int MAX_PRECISION = 9;  // Nanosecond precision
         static constexpr int BASE_SIZE = 7;     // Basic timestamp size in bytes
         static constexpr int MAX_FRACTION_SIZE = 3; // Additional bytes for fraction
+        static constexpr int MAX_TZ_OFFSET_MINUTES = 14 * 60;
+
+        // Mayor fracción admitida por precisión: 10^p - 1
+        static constexpr auto MAX_FRACTION = [] {
+            std::array<int32_t, MAX_PRECISION + 1> limits{};
+            for (int p = 0; p <= MAX_PRECISION; ++p) {
+                limits[p] = static_cast<int32_t>(POW10_I64[p] - 1);
+            }
+            return limits;
+        }();
 
         explicit TimestampType(int precision = 6, bool withTimeZone = false, bool isNullable = true)
             : precision_(std::clamp(precision, 0, MAX_PRECISION))
@@ -48,6 +68,10 @@ namespace db::types {
             return std::make_unique<TimestampType>(precision_, withTimeZone_, nullable_);
         }
 
+        [[nodiscard]] TypeDescriptor getDescriptor() const override {
+            return TypeDescriptor::timestamp(precision_, withTimeZone_, nullable_);
+        }
+
         [[nodiscard]] int getPrecision() const noexcept {
             return precision_;
         }
@@ -61,51 +85,59 @@ namespace db::types {
             int hour, int minute, int second,
             int fraction = 0,
             std::optional<int> tzOffset = std::nullopt) const noexcept {
-            try {
-                if (year < MIN_YEAR || year > MAX_YEAR) {
-                    return false;
-                }
-
-                // Validate basic components
-                if (month < 1 || month > 12 || day < 1 || day > 31 ||
-                    hour < 0 || hour > 23 || minute < 0 || minute > 59 ||
-                    second < 0 || second > 59) {
-                    return false;
-                }
-
-                // Validate fraction based on precision
-                if (fraction < 0) {
-                    return false;
-                }
-
-                int64_t maxFraction = static_cast<int64_t>(std::pow(10, precision_)) - 1;
-                if (fraction > maxFraction) {
-                    return false;
-                }
-
-                // Validate timezone if present
-                if (tzOffset.has_value()) {
-                    if (tzOffset.value() < -14 * 60 || tzOffset.value() > 14 * 60) {
-                        return false;
-                    }
-                }
-
-                // Validate timezone presence matches configuration
-                if (withTimeZone_ != tzOffset.has_value()) {
-                    return false;
-                }
-
-                // Use std::chrono for date validation
-                std::chrono::year_month_day ymd{
-                    std::chrono::year{year},
-                    std::chrono::month{static_cast<unsigned>(month)},
-                    std::chrono::day{static_cast<unsigned>(day)}
-                };
-
-                return ymd.ok();
-            } catch (...) {
-                return false;
+            return validate(year, month, day, hour, minute, second, fraction, tzOffset) == TimestampError::NONE;
+        }
+
+        [[nodiscard]] TimestampError validate(
+            int year, int month, int day,
+            int hour, int minute, int second,
+            int fraction = 0,
+            std::optional<int> tzOffset = std::nullopt) const noexcept {
+            if (withTimeZone_ != tzOffset.has_value()) {
+                return TimestampError::TIME_ZONE_PRESENCE;
+            }
+            return checkFields(precision_, year, month, day, hour, minute, second, fraction, tzOffset.value_or(0));
+        }
+
+        // Primer campo fuera de rango, en orden de año a desplazamiento. Sin saltos
+        // que dependan de los datos más allá de las comparaciones, para los kernels.
+        [[nodiscard]] static constexpr TimestampError checkFields(
+            int precision, int year, int month, int day, int hour, int minute, int second,
+            int fraction, int tzOffset) noexcept {
+            const bool monthValid = month >= 1 && month <= 12;
+            const int monthLength = monthValid ? daysInMonth(year, month) : 31;
+            TimestampError error = TimestampError::NONE;
+            error = (tzOffset < -MAX_TZ_OFFSET_MINUTES || tzOffset > MAX_TZ_OFFSET_MINUTES)
+                        ? TimestampError::TIME_ZONE_OFFSET : error;
+            error = (fraction < 0 || fraction > MAX_FRACTION[precision]) ? TimestampError::FRACTION : error;
+            error = (second < 0 || second > 59) ? TimestampError::SECOND : error;
+            error = (minute < 0 || minute > 59) ? TimestampError::MINUTE : error;
+            error = (hour < 0 || hour > 23) ? TimestampError::HOUR : error;
+            error = (day < 1 || day > monthLength) ? TimestampError::DAY : error;
+            error = !monthValid ? TimestampError::MONTH : error;
+            error = (year < MIN_YEAR || year > MAX_YEAR) ? TimestampError::YEAR : error;
+            return error;
+        }
+
+        [[nodiscard]] static constexpr std::string_view errorMessage(TimestampError error) noexcept {
+            switch (error) {
+                case TimestampError::NONE: return "Valid timestamp";
+                case TimestampError::YEAR: return "Year out of range";
+                case TimestampError::MONTH: return "Month out of range";
+                case TimestampError::DAY: return "Day out of range for month";
+                case TimestampError::HOUR: return "Hour out of range";
+                case TimestampError::MINUTE: return "Minute out of range";
+                case TimestampError::SECOND: return "Second out of range";
+                case TimestampError::FRACTION: return "Fraction exceeds precision";
+                case TimestampError::TIME_ZONE_OFFSET: return "Time zone offset out of range";
+                case TimestampError::TIME_ZONE_PRESENCE: return "Time zone does not match column type";
             }
+            return "Invalid timestamp";
+        }
+
+        // Regiones con horario de verano (Europe/Madrid...) de la base embebida en TimeZone
+        [[nodiscard]] static bool isValidTimeZoneRegion(std::string_view region) noexcept {
+            return TimeZone::find(region) != nullptr;
         }
 
         [[nodiscard]] std::string formatTimestamp(
@@ -113,97 +145,77 @@ namespace db::types {
             int hour, int minute, int second,
             int fraction = 0,
             std::optional<int> tzOffset = std::nullopt) const {
-            if (!isValidTimestamp(year, month, day, hour, minute, second, fraction, tzOffset)) {
-                throw DataTypeException("Invalid timestamp");
-            }
+            return tryFormatTimestamp(year, month, day, hour, minute, second, fraction, tzOffset).value();
+        }
 
-            std::string result = std::format("{:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}",
-                std::abs(year), month, day, hour, minute, second);
+        [[nodiscard]] Expected<std::string> tryFormatTimestamp(
+            int year, int month, int day,
+            int hour, int minute, int second,
+            int fraction = 0,
+            std::optional<int> tzOffset = std::nullopt) const {
+            if (const auto error = validate(year, month, day, hour, minute, second, fraction, tzOffset);
+                error != TimestampError::NONE) {
+                return TypeError(TypeErrorCode::INVALID_TIMESTAMP, 0, static_cast<uint8_t>(error));
+            }
 
-            // Add fraction if precision > 0 and fraction > 0
+            char buffer[48];
+            char* out = writeDigits(buffer, static_cast<uint64_t>(year < 0 ? -year : year), 4);
+            *out++ = '-';
+            out = writeTwoDigits(out, static_cast<uint32_t>(month));
+            *out++ = '-';
+            out = writeTwoDigits(out, static_cast<uint32_t>(day));
+            *out++ = ' ';
+            out = writeTwoDigits(out, static_cast<uint32_t>(hour));
+            *out++ = ':';
+            out = writeTwoDigits(out, static_cast<uint32_t>(minute));
+            *out++ = ':';
+            out = writeTwoDigits(out, static_cast<uint32_t>(second));
+
+            // La fracción ya está validada por debajo de 10^precision: basta rellenar con ceros
             if (precision_ > 0 && fraction > 0) {
-                std::string fractionStr = std::to_string(fraction);
-                // Pad with leading zeros if needed
-                fractionStr = std::string(precision_ - fractionStr.length(), '0') + fractionStr;
-                // Truncate if longer than precision
-                fractionStr = fractionStr.substr(0, precision_);
-                result += "." + fractionStr;
+                *out++ = '.';
+                out = writeDigits(out, static_cast<uint64_t>(fraction), static_cast<size_t>(precision_));
             }
 
-            // Add BC indicator if needed
             if (year < 0) {
-                result += " BC";
+                std::memcpy(out, " BC", 3);
+                out += 3;
             }
 
-            // Add timezone if present
             if (withTimeZone_ && tzOffset.has_value()) {
-                int offset = tzOffset.value();
-                char sign = offset < 0 ? '-' : '+';
-                offset = std::abs(offset);
-                int tzHours = offset / 60;
-                int tzMinutes = offset % 60;
-                result += std::format(" {:c}{:02d}:{:02d}", sign, tzHours, tzMinutes);
+                const int offset = tzOffset.value();
+                const int absOffset = std::abs(offset);
+                *out++ = ' ';
+                *out++ = offset < 0 ? '-' : '+';
+                out = writeTwoDigits(out, static_cast<uint32_t>(absOffset / 60));
+                *out++ = ':';
+                out = writeTwoDigits(out, static_cast<uint32_t>(absOffset % 60));
             }
 
-            return result;
+            return std::string(buffer, out);
         }
 
-        [[nodiscard]] static int compareTimestamps(
+        // Compara instantes: los desplazamientos se restan sobre segundos absolutos,
+        // así que los que cruzan la medianoche arrastran el día correctamente
+        [[nodiscard]] static constexpr int compareTimestamps(
             int year1, int month1, int day1, int hour1, int minute1, int second1,
             int year2, int month2, int day2, int hour2, int minute2, int second2,
             int fraction1 = 0, int fraction2 = 0,
             std::optional<int> tzOffset1 = std::nullopt,
             std::optional<int> tzOffset2 = std::nullopt) noexcept {
-            try {
-                using namespace std::chrono;
-
-                // Convert to UTC if timezone is provided
-                if (tzOffset1.has_value()) {
-                    adjustForTimezone(hour1, minute1, tzOffset1.value());
-                }
-                if (tzOffset2.has_value()) {
-                    adjustForTimezone(hour2, minute2, tzOffset2.value());
-                }
-
-                // Compare dates first
-                auto tp1 = sys_days{year_month_day{
-                    year{year1},
-                    month{static_cast<unsigned>(month1)},
-                    day{static_cast<unsigned>(day1)}
-                }} + hours{hour1} + minutes{minute1} + seconds{second1};
-
-                auto tp2 = sys_days{year_month_day{
-                    year{year2},
-                    month{static_cast<unsigned>(month2)},
-                    day{static_cast<unsigned>(day2)}
-                }} + hours{hour2} + minutes{minute2} + seconds{second2};
-
-                if (tp1 < tp2) return -1;
-                if (tp1 > tp2) return 1;
-
-                // If dates are equal, compare fractions
-                if (fraction1 < fraction2) return -1;
-                if (fraction1 > fraction2) return 1;
-
-                return 0;
-            } catch (...) {
-                return 0;
+            const int64_t tp1 = toUtcSeconds(year1, month1, day1, hour1, minute1, second1, tzOffset1.value_or(0));
+            const int64_t tp2 = toUtcSeconds(year2, month2, day2, hour2, minute2, second2, tzOffset2.value_or(0));
+            if (tp1 != tp2) {
+                return tp1 < tp2 ? -1 : 1;
             }
+            return (fraction1 > fraction2) - (fraction1 < fraction2);
         }
 
     private:
-        static void adjustForTimezone(int& hour, int& minute, int tzOffset) noexcept {
-            minute -= tzOffset;
-            while (minute < 0) {
-                minute += 60;
-                hour--;
-            }
-            while (minute >= 60) {
-                minute -= 60;
-                hour++;
-            }
-            while (hour < 0) hour += 24;
-            while (hour >= 24) hour -= 24;
+        static constexpr int64_t toUtcSeconds(int year, int month, int day,
+                                              int hour, int minute, int second, int tzOffset) noexcept {
+            return daysFromCivil(year, month, day) * SECONDS_PER_DAY
+                   + hour * int64_t{3600} + (minute - tzOffset) * int64_t{60} + second;
         }
 
         int precision_;
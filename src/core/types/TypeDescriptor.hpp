@@ -0,0 +1,105 @@
+// src/core/types/TypeDescriptor.hpp
+#ifndef TYPE_DESCRIPTOR_HPP
+#define TYPE_DESCRIPTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace db::types {
+
+    enum class TypeKind : uint8_t { NUMBER, VARCHAR2, CHAR, NCHAR, NVARCHAR2, DATE, TIMESTAMP };
+
+    // Descripción de un tipo en 8 bytes, copiable por valor y sin vtable. `length`
+    // es la longitud de los tipos de cadena o la precisión de NUMBER/TIMESTAMP;
+    // `scale` sólo se usa en NUMBER. Los kernels reciben esto en lugar de un
+    // DataType* y resuelven el tipo concreto una vez por lote (ver TypeDispatch).
+    struct TypeDescriptor {
+        static constexpr uint8_t NULLABLE = 0x01;
+        static constexpr uint8_t WITH_TIME_ZONE = 0x02;
+
+        TypeKind kind = TypeKind::NUMBER;
+        uint8_t flags = NULLABLE;
+        uint8_t scale = 0;
+        uint8_t reserved = 0;
+        uint32_t length = 0;
+
+        // Sin validar: los límites los comprueban los constructores de cada tipo
+        [[nodiscard]] static constexpr TypeDescriptor number(size_t precision, size_t scale,
+                                                             bool nullable = true) noexcept {
+            return make(TypeKind::NUMBER, nullable, precision, static_cast<uint8_t>(std::min<size_t>(scale, UINT8_MAX)));
+        }
+        [[nodiscard]] static constexpr TypeDescriptor varchar2(size_t maxLength, bool nullable = true) noexcept {
+            return make(TypeKind::VARCHAR2, nullable, maxLength);
+        }
+        [[nodiscard]] static constexpr TypeDescriptor charType(size_t length, bool nullable = true) noexcept {
+            return make(TypeKind::CHAR, nullable, length);
+        }
+        [[nodiscard]] static constexpr TypeDescriptor nchar(size_t length, bool nullable = true) noexcept {
+            return make(TypeKind::NCHAR, nullable, length);
+        }
+        [[nodiscard]] static constexpr TypeDescriptor nvarchar2(size_t maxLength, bool nullable = true) noexcept {
+            return make(TypeKind::NVARCHAR2, nullable, maxLength);
+        }
+        [[nodiscard]] static constexpr TypeDescriptor date(bool nullable = true) noexcept {
+            return make(TypeKind::DATE, nullable, 0);
+        }
+        [[nodiscard]] static constexpr TypeDescriptor timestamp(int precision, bool withTimeZone,
+                                                                bool nullable = true) noexcept {
+            TypeDescriptor descriptor = make(TypeKind::TIMESTAMP, nullable, static_cast<size_t>(std::max(precision, 0)));
+            descriptor.flags |= withTimeZone ? WITH_TIME_ZONE : 0;
+            return descriptor;
+        }
+
+        [[nodiscard]] constexpr bool isNullable() const noexcept { return (flags & NULLABLE) != 0; }
+        [[nodiscard]] constexpr bool hasTimeZone() const noexcept { return (flags & WITH_TIME_ZONE) != 0; }
+        [[nodiscard]] constexpr bool isString() const noexcept {
+            return kind == TypeKind::VARCHAR2 || kind == TypeKind::CHAR
+                   || kind == TypeKind::NCHAR || kind == TypeKind::NVARCHAR2;
+        }
+
+        // Mismo resultado que DataType::getSize sin llamada virtual
+        [[nodiscard]] constexpr size_t getSize() const noexcept {
+            switch (kind) {
+                case TypeKind::NUMBER: return 1 + (static_cast<size_t>(length) + 1) / 2;
+                case TypeKind::VARCHAR2:
+                case TypeKind::CHAR: return length;
+                case TypeKind::NCHAR:
+                case TypeKind::NVARCHAR2: return static_cast<size_t>(length) * 2;
+                case TypeKind::DATE: return 7;
+                case TypeKind::TIMESTAMP:
+                    return 7 + (length > 0 ? std::min<size_t>((length + 2) / 3, 3) : 0) + (hasTimeZone() ? 2 : 0);
+            }
+            return 0;
+        }
+
+        // Los 8 bytes como entero: clave de hash y comparación en una instrucción
+        [[nodiscard]] constexpr uint64_t pack() const noexcept {
+            return static_cast<uint64_t>(kind) | static_cast<uint64_t>(flags) << 8
+                   | static_cast<uint64_t>(scale) << 16 | static_cast<uint64_t>(reserved) << 24
+                   | static_cast<uint64_t>(length) << 32;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const TypeDescriptor& other) const noexcept {
+            return pack() == other.pack();
+        }
+
+    private:
+        [[nodiscard]] static constexpr TypeDescriptor make(TypeKind kind, bool nullable, size_t length,
+                                                           uint8_t scale = 0) noexcept {
+            TypeDescriptor descriptor;
+            descriptor.kind = kind;
+            descriptor.flags = nullable ? NULLABLE : 0;
+            descriptor.scale = scale;
+            descriptor.length = static_cast<uint32_t>(std::min<size_t>(length, UINT32_MAX));
+            return descriptor;
+        }
+    };
+
+    static_assert(sizeof(TypeDescriptor) == 8);
+    static_assert(std::is_trivially_copyable_v<TypeDescriptor> && std::is_standard_layout_v<TypeDescriptor>);
+
+} // namespace db::types
+
+#endif // TYPE_DESCRIPTOR_HPP
@@ -0,0 +1,48 @@
+// src/core/types/TypeDispatch.hpp
+#ifndef TYPE_DISPATCH_HPP
+#define TYPE_DISPATCH_HPP
+
+#include "TypeDescriptor.hpp"
+#include "NumberType.hpp"
+#include "Varchar2Type.hpp"
+#include "CharType.hpp"
+#include "NCharType.hpp"
+#include "NVarchar2Type.hpp"
+#include "DateType.hpp"
+#include "TimestampType.hpp"
+#include "exceptions/DataTypeException.hpp"
+#include <utility>
+
+namespace db::types {
+
+    // Resuelve el tipo concreto de un descriptor con un único switch y llama a
+    // `visitor` con él. Todas las clases de tipo son final, así que dentro del
+    // visitante sus métodos se llaman sin vtable y pueden inlinearse en el bucle
+    // del lote. Todas las ramas del visitante deben devolver el mismo tipo.
+    // Lanza DataTypeException si el descriptor no respeta los límites del tipo.
+    template<typename Visitor>
+    decltype(auto) dispatchType(const TypeDescriptor& descriptor, Visitor&& visitor) {
+        const bool nullable = descriptor.isNullable();
+        switch (descriptor.kind) {
+            case TypeKind::NUMBER:
+                return std::forward<Visitor>(visitor)(NumberType(nullable, descriptor.length, descriptor.scale));
+            case TypeKind::VARCHAR2:
+                return std::forward<Visitor>(visitor)(Varchar2Type(nullable, descriptor.length));
+            case TypeKind::CHAR:
+                return std::forward<Visitor>(visitor)(CharType(nullable, descriptor.length));
+            case TypeKind::NCHAR:
+                return std::forward<Visitor>(visitor)(NCharType(nullable, descriptor.length));
+            case TypeKind::NVARCHAR2:
+                return std::forward<Visitor>(visitor)(NVarchar2Type(nullable, descriptor.length));
+            case TypeKind::DATE:
+                return std::forward<Visitor>(visitor)(DateType(nullable));
+            case TypeKind::TIMESTAMP:
+                return std::forward<Visitor>(visitor)(
+                    TimestampType(static_cast<int>(descriptor.length), descriptor.hasTimeZone(), nullable));
+        }
+        throw DataTypeException("Unknown type kind " + std::to_string(static_cast<int>(descriptor.kind)));
+    }
+
+} // namespace db::types
+
+#endif // TYPE_DISPATCH_HPP
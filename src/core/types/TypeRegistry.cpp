@@ -0,0 +1,256 @@
+// src/core/types/TypeRegistry.cpp
+#include "TypeRegistry.hpp"
+#include "TypeDispatch.hpp"
+#include <algorithm>
+#include <mutex>
+
+namespace db::types {
+
+    namespace {
+        // Anula los campos que el tipo no usa para que tipos iguales compartan clave
+        TypeDescriptor normalize(TypeDescriptor descriptor) noexcept {
+            if (descriptor.kind != TypeKind::NUMBER) {
+                descriptor.scale = 0;
+            }
+            if (descriptor.kind != TypeKind::TIMESTAMP) {
+                descriptor.flags &= static_cast<uint8_t>(~TypeDescriptor::WITH_TIME_ZONE);
+            }
+            if (descriptor.kind == TypeKind::DATE) {
+                descriptor.length = 0;
+            }
+            descriptor.flags &= TypeDescriptor::NULLABLE | TypeDescriptor::WITH_TIME_ZONE;
+            descriptor.reserved = 0;
+            return descriptor;
+        }
+
+        Expected<void> check(const TypeDescriptor& descriptor) noexcept {
+            switch (descriptor.kind) {
+                case TypeKind::NUMBER: return NumberType::checkPrecisionScale(descriptor.length, descriptor.scale);
+                case TypeKind::VARCHAR2: return Varchar2Type::checkLength(descriptor.length);
+                case TypeKind::CHAR: return CharType::checkLength(descriptor.length);
+                case TypeKind::NCHAR: return NCharType::checkLength(descriptor.length);
+                case TypeKind::NVARCHAR2: return NVarchar2Type::checkLength(descriptor.length);
+                case TypeKind::DATE: return {};
+                case TypeKind::TIMESTAMP:
+                    if (descriptor.length > static_cast<uint32_t>(TimestampType::MAX_PRECISION)) {
+                        return TypeError(TypeErrorCode::PRECISION_TOO_LARGE, TimestampType::MAX_PRECISION);
+                    }
+                    return {};
+            }
+            return TypeError(TypeErrorCode::UNSPECIFIED);
+        }
+
+        // Analizador descendente sobre el texto DDL. Los errores llevan la posición
+        // del primer carácter que no encaja.
+        class TypeParser {
+        public:
+            explicit TypeParser(std::string_view text) noexcept : text(text) {}
+
+            Expected<TypeDescriptor> parse() noexcept {
+                TypeDescriptor descriptor;
+                skipSpaces();
+                if (keyword("NUMBER") || keyword("NUMERIC") || keyword("DECIMAL") || keyword("DEC")) {
+                    descriptor.length = NumberType::MAX_PRECISION;
+                    if (symbol('(')) {
+                        if (!number(descriptor.length)) return syntaxError();
+                        uint32_t scale = 0;
+                        if (symbol(',') && !number(scale)) return syntaxError();
+                        if (!symbol(')')) return syntaxError();
+                        descriptor.scale = static_cast<uint8_t>(std::min<uint32_t>(scale, UINT8_MAX));
+                    }
+                } else if (keyword("INTEGER") || keyword("INT") || keyword("SMALLINT")) {
+                    descriptor.length = NumberType::MAX_PRECISION;
+                } else if (keyword("VARCHAR2") || keyword("VARCHAR")) {
+                    descriptor.kind = TypeKind::VARCHAR2;
+                    if (!lengthSpec(descriptor.length, true)) return syntaxError();
+                } else if (keyword("NVARCHAR2")) {
+                    descriptor.kind = TypeKind::NVARCHAR2;
+                    if (!lengthSpec(descriptor.length, false)) return syntaxError();
+                } else if (keyword("CHAR")) {
+                    descriptor.kind = TypeKind::CHAR;
+                    descriptor.length = 1;
+                    if (peek('(') && !lengthSpec(descriptor.length, true)) return syntaxError();
+                } else if (keyword("NCHAR")) {
+                    descriptor.kind = TypeKind::NCHAR;
+                    descriptor.length = 1;
+                    if (peek('(') && !lengthSpec(descriptor.length, false)) return syntaxError();
+                } else if (keyword("DATE")) {
+                    descriptor.kind = TypeKind::DATE;
+                } else if (keyword("TIMESTAMP")) {
+                    descriptor.kind = TypeKind::TIMESTAMP;
+                    descriptor.length = 6;
+                    if (symbol('(') && !(number(descriptor.length) && symbol(')'))) return syntaxError();
+                    if (keyword("WITH")) {
+                        if (!(keyword("TIME") && keyword("ZONE"))) return syntaxError();
+                        descriptor.flags |= TypeDescriptor::WITH_TIME_ZONE;
+                    }
+                } else {
+                    return syntaxError();
+                }
+
+                if (keyword("NOT")) {
+                    if (!keyword("NULL")) return syntaxError();
+                    descriptor.flags &= static_cast<uint8_t>(~TypeDescriptor::NULLABLE);
+                } else {
+                    static_cast<void>(keyword("NULL"));
+                }
+                return position == text.size() ? Expected<TypeDescriptor>(descriptor) : syntaxError();
+            }
+
+        private:
+            std::string_view text;
+            size_t position = 0;
+
+            void skipSpaces() noexcept {
+                while (position < text.size() && (text[position] == ' ' || text[position] == '\t'
+                                                  || text[position] == '\n' || text[position] == '\r')) {
+                    ++position;
+                }
+            }
+
+            static bool isWordChar(char c) noexcept {
+                return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_';
+            }
+
+            // Palabra completa sin distinguir mayúsculas; la palabra se escribe en mayúsculas
+            bool keyword(std::string_view word) noexcept {
+                if (text.size() - position < word.size()) {
+                    return false;
+                }
+                for (size_t i = 0; i < word.size(); ++i) {
+                    const char c = text[position + i];
+                    if ((c >= 'a' && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c) != word[i]) {
+                        return false;
+                    }
+                }
+                const size_t end = position + word.size();
+                if (end < text.size() && isWordChar(text[end])) {
+                    return false;
+                }
+                position = end;
+                skipSpaces();
+                return true;
+            }
+
+            [[nodiscard]] bool peek(char c) const noexcept {
+                return position < text.size() && text[position] == c;
+            }
+
+            bool symbol(char c) noexcept {
+                if (!peek(c)) {
+                    return false;
+                }
+                ++position;
+                skipSpaces();
+                return true;
+            }
+
+            // Entero decimal sin signo; los valores enormes se saturan y los rechaza la validación
+            bool number(uint32_t& out) noexcept {
+                const size_t start = position;
+                uint64_t value = 0;
+                while (position < text.size() && text[position] >= '0' && text[position] <= '9') {
+                    value = std::min<uint64_t>(value * 10 + static_cast<uint64_t>(text[position] - '0'), UINT32_MAX);
+                    ++position;
+                }
+                if (position == start) {
+                    return false;
+                }
+                out = static_cast<uint32_t>(value);
+                skipSpaces();
+                return true;
+            }
+
+            // "(n)" o, en los tipos de bytes, "(n BYTE)"
+            bool lengthSpec(uint32_t& out, bool allowByte) noexcept {
+                if (!symbol('(') || !number(out)) {
+                    return false;
+                }
+                if (allowByte) {
+                    static_cast<void>(keyword("BYTE"));
+                }
+                return symbol(')');
+            }
+
+            [[nodiscard]] TypeError syntaxError() const noexcept {
+                return TypeError(TypeErrorCode::INVALID_TYPE_SYNTAX, static_cast<uint32_t>(position));
+            }
+        };
+    } // namespace
+
+    TypeRegistry& TypeRegistry::instance() {
+        static TypeRegistry registry;
+        return registry;
+    }
+
+    Expected<TypeHandle> TypeRegistry::intern(const TypeDescriptor& descriptor) {
+        const TypeDescriptor normalized = normalize(descriptor);
+        const uint64_t packed = normalized.pack();
+        {
+            std::shared_lock lock(mutex);
+            if (const auto found = entries.find(packed); found != entries.end()) {
+                return TypeHandle(found->second.get());
+            }
+        }
+        if (const auto checked = check(normalized); !checked) {
+            return checked.error();
+        }
+
+        // Se construye fuera del cerrojo; si otro hilo se adelanta, gana su entrada
+        auto type = dispatchType(normalized, [](const auto& concrete) -> std::unique_ptr<const DataType> {
+            return std::make_unique<std::decay_t<decltype(concrete)>>(concrete);
+        });
+        auto entry = std::make_unique<const TypeHandle::Entry>(TypeHandle::Entry{normalized, std::move(type)});
+        std::unique_lock lock(mutex);
+        const auto [position, inserted] = entries.try_emplace(packed, std::move(entry));
+        return TypeHandle(position->second.get());
+    }
+
+    TypeHandle TypeRegistry::number(size_t precision, size_t scale, bool nullable) {
+        NumberType::checkPrecisionScale(precision, scale).value();
+        return intern(TypeDescriptor::number(precision, scale, nullable)).value();
+    }
+
+    TypeHandle TypeRegistry::varchar2(size_t maxLength, bool nullable) {
+        Varchar2Type::checkLength(maxLength).value();
+        return intern(TypeDescriptor::varchar2(maxLength, nullable)).value();
+    }
+
+    TypeHandle TypeRegistry::charType(size_t length, bool nullable) {
+        CharType::checkLength(length).value();
+        return intern(TypeDescriptor::charType(length, nullable)).value();
+    }
+
+    TypeHandle TypeRegistry::nchar(size_t length, bool nullable) {
+        NCharType::checkLength(length).value();
+        return intern(TypeDescriptor::nchar(length, nullable)).value();
+    }
+
+    TypeHandle TypeRegistry::nvarchar2(size_t maxLength, bool nullable) {
+        NVarchar2Type::checkLength(maxLength).value();
+        return intern(TypeDescriptor::nvarchar2(maxLength, nullable)).value();
+    }
+
+    TypeHandle TypeRegistry::date(bool nullable) {
+        return intern(TypeDescriptor::date(nullable)).value();
+    }
+
+    TypeHandle TypeRegistry::timestamp(int precision, bool withTimeZone, bool nullable) {
+        const int clamped = std::clamp(precision, 0, TimestampType::MAX_PRECISION);
+        return intern(TypeDescriptor::timestamp(clamped, withTimeZone, nullable)).value();
+    }
+
+    Expected<TypeHandle> TypeRegistry::parse(std::string_view ddl) {
+        const auto descriptor = TypeParser(ddl).parse();
+        if (!descriptor) {
+            return descriptor.error();
+        }
+        return intern(*descriptor);
+    }
+
+    size_t TypeRegistry::size() const {
+        std::shared_lock lock(mutex);
+        return entries.size();
+    }
+
+} // namespace db::types
@@ -0,0 +1,93 @@
+// src/core/types/TypeRegistry.hpp
+#ifndef TYPE_REGISTRY_HPP
+#define TYPE_REGISTRY_HPP
+
+#include "DataType.hpp"
+#include "NumberType.hpp"
+#include "TimestampType.hpp"
+#include "TypeDescriptor.hpp"
+#include "util/Expected.hpp"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace db::types {
+
+    // Referencia barata a un tipo internado: un puntero. Dos handles del mismo
+    // registro son iguales si y sólo si describen el mismo tipo.
+    class TypeHandle {
+    public:
+        constexpr TypeHandle() noexcept = default;
+
+        [[nodiscard]] const DataType& operator*() const noexcept { return *entry->type; }
+        [[nodiscard]] const DataType* operator->() const noexcept { return entry->type.get(); }
+        [[nodiscard]] const DataType* get() const noexcept { return entry ? entry->type.get() : nullptr; }
+        [[nodiscard]] const TypeDescriptor& getDescriptor() const noexcept { return entry->descriptor; }
+        [[nodiscard]] TypeKind getKind() const noexcept { return entry->descriptor.kind; }
+
+        constexpr explicit operator bool() const noexcept { return entry != nullptr; }
+        [[nodiscard]] constexpr bool operator==(const TypeHandle&) const noexcept = default;
+
+    private:
+        friend class TypeRegistry;
+        friend struct std::hash<TypeHandle>;
+
+        struct Entry {
+            TypeDescriptor descriptor;
+            std::unique_ptr<const DataType> type;
+        };
+
+        constexpr explicit TypeHandle(const Entry* entry) noexcept : entry(entry) {}
+
+        const Entry* entry = nullptr;
+    };
+
+    // Catálogo de descriptores inmutables: cada tipo distinto se crea una sola vez
+    // y vive tanto como el registro. Las búsquedas comparten un shared_mutex y sólo
+    // la primera aparición de un tipo toma el cerrojo exclusivo.
+    class TypeRegistry {
+    public:
+        TypeRegistry() = default;
+        TypeRegistry(const TypeRegistry&) = delete;
+        TypeRegistry& operator=(const TypeRegistry&) = delete;
+
+        // Registro del catálogo; vive hasta el final del programa
+        [[nodiscard]] static TypeRegistry& instance();
+
+        // Lanzan DataTypeException con los mismos límites que los constructores
+        [[nodiscard]] TypeHandle number(size_t precision = NumberType::MAX_PRECISION, size_t scale = 0,
+                                        bool nullable = true);
+        [[nodiscard]] TypeHandle varchar2(size_t maxLength, bool nullable = true);
+        [[nodiscard]] TypeHandle charType(size_t length = 1, bool nullable = true);
+        [[nodiscard]] TypeHandle nchar(size_t length = 1, bool nullable = true);
+        [[nodiscard]] TypeHandle nvarchar2(size_t maxLength, bool nullable = true);
+        [[nodiscard]] TypeHandle date(bool nullable = true);
+        // La precisión se recorta a [0, 9] como en TimestampType
+        [[nodiscard]] TypeHandle timestamp(int precision = 6, bool withTimeZone = false, bool nullable = true);
+
+        [[nodiscard]] Expected<TypeHandle> intern(const TypeDescriptor& descriptor);
+
+        // Tipo de una columna en DDL: "NUMBER(10,2)", "varchar2(100 byte) not null",
+        // "TIMESTAMP(3) WITH TIME ZONE". Sin distinguir mayúsculas; sin excepciones.
+        [[nodiscard]] Expected<TypeHandle> parse(std::string_view ddl);
+
+        [[nodiscard]] size_t size() const;
+
+    private:
+        mutable std::shared_mutex mutex;
+        std::unordered_map<uint64_t, std::unique_ptr<const TypeHandle::Entry>> entries;
+    };
+
+} // namespace db::types
+
+template<>
+struct std::hash<db::types::TypeHandle> {
+    size_t operator()(const db::types::TypeHandle& handle) const noexcept {
+        return std::hash<const void*>{}(handle.entry);
+    }
+};
+
+#endif // TYPE_REGISTRY_HPP
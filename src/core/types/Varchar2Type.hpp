@@ -4,6 +4,10 @@
 
 #include "DataType.hpp"
 #include "exceptions/DataTypeException.hpp"
+#include "util/Expected.hpp"
+#include "values/CompactString.hpp"
+#include <string>
+#include <string_view>
 
 namespace db::types {
 
@@ -16,6 +20,24 @@ namespace db::types {
             validateLength(maxLength);
         }
 
+        // Validación de la longitud declarada sin lanzar
+        [[nodiscard]] static constexpr Expected<void> checkLength(size_t len) noexcept {
+            if (len == 0) {
+                return TypeError(TypeErrorCode::LENGTH_ZERO);
+            }
+            if (len > MAX_LENGTH) {
+                return TypeError(TypeErrorCode::LENGTH_TOO_LARGE, MAX_LENGTH);
+            }
+            return {};
+        }
+
+        [[nodiscard]] static Expected<Varchar2Type> tryCreate(bool isNullable, size_t len) {
+            if (const auto checked = checkLength(len); !checked) {
+                return checked.error();
+            }
+            return Varchar2Type(isNullable, len);
+        }
+
         [[nodiscard]] std::string getName() const override {
             return "VARCHAR2(" + std::to_string(maxLength) + ")";
         }
@@ -32,25 +54,32 @@ namespace db::types {
             return std::make_unique<Varchar2Type>(nullable, maxLength);
         }
 
+        [[nodiscard]] TypeDescriptor getDescriptor() const override {
+            return TypeDescriptor::varchar2(maxLength, nullable);
+        }
+
         [[nodiscard]] constexpr size_t getMaxLength() const noexcept {
             return maxLength;
         }
 
-        [[nodiscard]] bool isValidValue(const std::string& value) const noexcept {
+        [[nodiscard]] bool isValidValue(std::string_view value) const noexcept {
             return value.length() <= maxLength;
         }
 
+        // Valida y devuelve el handle de 16 bytes; más de 12 bytes se copian en `arena`
+        [[nodiscard]] Expected<CompactString> tryMakeValue(std::string_view value, StringArena& arena) const {
+            if (value.length() > maxLength) {
+                return TypeError(TypeErrorCode::VALUE_TOO_LONG, static_cast<uint32_t>(maxLength));
+            }
+            return CompactString::make(value, arena);
+        }
+
     private:
         bool nullable;
         size_t maxLength;
 
         constexpr void validateLength(size_t length) {
-            if (length == 0) {
-                throw DataTypeException("Length must be greater than 0");
-            }
-            if (length > MAX_LENGTH) {
-                throw DataTypeException("Length cannot exceed " + std::to_string(MAX_LENGTH));
-            }
+            checkLength(length).value();
         }
     };
 
@@ -2,6 +2,7 @@
 #ifndef DATA_TYPE_EXCEPTION_HPP
 #define DATA_TYPE_EXCEPTION_HPP
 
+#include "TypeError.hpp"
 #include <stdexcept>
 #include <string>
 #include <source_location>
@@ -20,14 +21,27 @@ namespace db::types {
             ),
             location_(location) {}
 
+        // Versión lanzada por la API con Expected: conserva el código del error
+        explicit DataTypeException(
+            const TypeError& error,
+            const std::source_location& location = std::source_location::current()
+        ) : DataTypeException(error.message(), location) {
+            error_ = error;
+        }
+
         [[nodiscard]] const std::source_location& where() const noexcept {
             return location_;
         }
 
+        [[nodiscard]] const TypeError& error() const noexcept {
+            return error_;
+        }
+
     private:
         std::source_location location_;
+        TypeError error_;
     };
 
 } // namespace db::types
 
-#endif // DATA_TYPE_EXCEPTION_HPP
\ No newline at end of file
+#endif // DATA_TYPE_EXCEPTION_HPP
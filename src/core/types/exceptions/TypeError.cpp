@@ -0,0 +1,45 @@
+// src/core/types/exceptions/TypeError.cpp
+#include "TypeError.hpp"
+#include "../TimestampType.hpp"
+
+namespace db::types {
+
+    std::string TypeError::message() const {
+        switch (code_) {
+            case TypeErrorCode::UNSPECIFIED:
+                return "Type error";
+            case TypeErrorCode::LENGTH_ZERO:
+                return "Length must be greater than 0";
+            case TypeErrorCode::LENGTH_TOO_LARGE:
+                return "Length cannot exceed " + std::to_string(detail_);
+            case TypeErrorCode::PRECISION_TOO_LARGE:
+                return "Precision cannot exceed " + std::to_string(detail_);
+            case TypeErrorCode::SCALE_TOO_LARGE:
+                return "Scale cannot exceed " + std::to_string(detail_);
+            case TypeErrorCode::SCALE_EXCEEDS_PRECISION:
+                return "Scale cannot be greater than precision";
+            case TypeErrorCode::VALUE_TOO_LONG:
+                return "Value exceeds maximum length of " + std::to_string(detail_);
+            case TypeErrorCode::VALUE_TOO_MANY_CHARACTERS:
+                return "Value exceeds maximum length in characters of " + std::to_string(detail_);
+            case TypeErrorCode::VALUE_OUT_OF_RANGE:
+                return "Value out of range for type";
+            case TypeErrorCode::INVALID_NUMBER:
+                return "Invalid number";
+            case TypeErrorCode::INVALID_UTF8:
+                return "Invalid UTF-8 sequence at byte " + std::to_string(detail_);
+            case TypeErrorCode::INVALID_DATE:
+                return "Invalid date";
+            case TypeErrorCode::INVALID_TIMESTAMP:
+                return "Invalid timestamp: "
+                       + std::string(TimestampType::errorMessage(static_cast<TimestampError>(reason_)));
+            case TypeErrorCode::INVALID_TYPE_SYNTAX:
+                return "Invalid type definition at position " + std::to_string(detail_);
+            case TypeErrorCode::UNSUPPORTED_CAST:
+                return "Unsupported cast from type kind " + std::to_string(reason_)
+                       + " to type kind " + std::to_string(detail_);
+        }
+        return "Type error";
+    }
+
+} // namespace db::types
@@ -0,0 +1,55 @@
+// src/core/types/exceptions/TypeError.hpp
+#ifndef TYPE_ERROR_HPP
+#define TYPE_ERROR_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace db::types {
+
+    enum class TypeErrorCode : uint8_t {
+        UNSPECIFIED,
+        LENGTH_ZERO,
+        LENGTH_TOO_LARGE,           // detail: longitud máxima del tipo
+        PRECISION_TOO_LARGE,        // detail: precisión máxima
+        SCALE_TOO_LARGE,            // detail: escala máxima
+        SCALE_EXCEEDS_PRECISION,
+        VALUE_TOO_LONG,             // detail: longitud máxima en bytes
+        VALUE_TOO_MANY_CHARACTERS,  // detail: longitud máxima en caracteres
+        VALUE_OUT_OF_RANGE,
+        INVALID_NUMBER,
+        INVALID_UTF8,               // detail: byte donde empieza la secuencia mala
+        INVALID_DATE,
+        INVALID_TIMESTAMP,          // reason: TimestampError
+        INVALID_TYPE_SYNTAX,        // detail: posición en el texto DDL
+        UNSUPPORTED_CAST            // reason: TypeKind de origen; detail: TypeKind de destino
+    };
+
+    // Error de tipo en 8 bytes: código más los datos para describirlo. El texto
+    // sólo se construye al llamar a message(), así que rechazar una fila en una
+    // carga masiva no formatea nada ni reserva memoria.
+    class TypeError {
+    public:
+        constexpr explicit TypeError(TypeErrorCode code = TypeErrorCode::UNSPECIFIED,
+                                     uint32_t detail = 0, uint8_t reason = 0) noexcept
+            : code_(code), reason_(reason), detail_(detail) {}
+
+        [[nodiscard]] constexpr TypeErrorCode code() const noexcept { return code_; }
+        [[nodiscard]] constexpr uint8_t reason() const noexcept { return reason_; }
+        [[nodiscard]] constexpr uint32_t detail() const noexcept { return detail_; }
+
+        [[nodiscard]] std::string message() const;
+
+        [[nodiscard]] constexpr bool operator==(const TypeError&) const noexcept = default;
+
+    private:
+        TypeErrorCode code_;
+        uint8_t reason_;
+        uint32_t detail_;
+    };
+
+    static_assert(sizeof(TypeError) == 8);
+
+} // namespace db::types
+
+#endif // TYPE_ERROR_HPP
@@ -3,6 +3,7 @@
 #define NUMERIC_TYPE_FACTORY_HPP
 
 #include "../NumberType.hpp"
+#include "../util/Expected.hpp"
 #include <concepts>
 
 namespace db::types {
@@ -43,6 +44,32 @@ namespace db::types {
         ) {
             return createNumber<T>(nullable, precision, scale);
         }
+
+        // Variantes sin excepciones: devuelven el TypeError en lugar de lanzar
+        template<typename T>
+        requires std::integral<T> || std::floating_point<T>
+        static Expected<std::unique_ptr<DataType>> tryCreateNumber(
+            bool nullable = true,
+            T precision = NumberType::MAX_PRECISION,
+            T scale = 0
+        ) {
+            const auto checked = NumberType::checkPrecisionScale(static_cast<size_t>(precision),
+                                                                 static_cast<size_t>(scale));
+            if (!checked) {
+                return checked.error();
+            }
+            return createNumber<T>(nullable, precision, scale);
+        }
+
+        template<typename T>
+        requires std::integral<T> || std::floating_point<T>
+        static Expected<std::unique_ptr<DataType>> tryCreateDecimal(
+            T precision,
+            T scale,
+            bool nullable = true
+        ) {
+            return tryCreateNumber<T>(nullable, precision, scale);
+        }
     };
 
 } // namespace db::types
@@ -6,6 +6,7 @@
 #include "../NVarchar2Type.hpp"
 #include "../CharType.hpp"
 #include "../NCharType.hpp"
+#include "../util/Expected.hpp"
 #include <concepts>
 
 namespace db::types {
@@ -84,6 +85,56 @@ namespace db::types {
         ) {
             return createNVarchar2<size_t>(NVarchar2Type::MAX_LENGTH, nullable);
         }
+
+        // Variantes sin excepciones: devuelven el TypeError en lugar de lanzar
+
+        template<typename T>
+        requires std::integral<T> || std::floating_point<T>
+        static Expected<std::unique_ptr<DataType>> tryCreateVarchar2(
+            T maxLength,
+            bool nullable = true
+        ) {
+            if (const auto checked = Varchar2Type::checkLength(static_cast<size_t>(maxLength)); !checked) {
+                return checked.error();
+            }
+            return createVarchar2<T>(maxLength, nullable);
+        }
+
+        template<typename T>
+        requires std::integral<T> || std::floating_point<T>
+        static Expected<std::unique_ptr<DataType>> tryCreateChar(
+            T length,
+            bool nullable = true
+        ) {
+            if (const auto checked = CharType::checkLength(static_cast<size_t>(length)); !checked) {
+                return checked.error();
+            }
+            return createChar<T>(length, nullable);
+        }
+
+        template<typename T>
+        requires std::integral<T> || std::floating_point<T>
+        static Expected<std::unique_ptr<DataType>> tryCreateNChar(
+            T length,
+            bool nullable = true
+        ) {
+            if (const auto checked = NCharType::checkLength(static_cast<size_t>(length)); !checked) {
+                return checked.error();
+            }
+            return createNChar<T>(length, nullable);
+        }
+
+        template<typename T>
+        requires std::integral<T> || std::floating_point<T>
+        static Expected<std::unique_ptr<DataType>> tryCreateNVarchar2(
+            T maxLength,
+            bool nullable = true
+        ) {
+            if (const auto checked = NVarchar2Type::checkLength(static_cast<size_t>(maxLength)); !checked) {
+                return checked.error();
+            }
+            return createNVarchar2<T>(maxLength, nullable);
+        }
     };
 
 } // namespace db::types
@@ -0,0 +1,473 @@
+// src/core/types/kernels/CastKernels.cpp
+#include "CastKernels.hpp"
+#include "DateTimeFormat.hpp"
+#include "../CharType.hpp"
+#include "../NumberType.hpp"
+#include "../TimestampType.hpp"
+#include "../exceptions/DataTypeException.hpp"
+#include "../util/BlankPadding.hpp"
+#include "../util/PowersOfTen.hpp"
+#include "../util/Utf8.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <initializer_list>
+
+namespace db::types {
+
+    namespace {
+        constexpr size_t KIND_COUNT = static_cast<size_t>(TypeKind::TIMESTAMP) + 1;
+        constexpr std::string_view DATE_MASK = "YYYY-MM-DD HH24:MI:SS";
+
+        // Alternativa de CastColumn que corresponde a cada TypeKind
+        constexpr size_t columnIndex(TypeKind kind) noexcept {
+            switch (kind) {
+                case TypeKind::NUMBER: return 0;
+                case TypeKind::DATE: return 2;
+                case TypeKind::TIMESTAMP: return 3;
+                default: return 1;
+            }
+        }
+
+        constexpr bool isPadded(const TypeDescriptor& type) noexcept {
+            return type.kind == TypeKind::CHAR || type.kind == TypeKind::NCHAR;
+        }
+
+        constexpr bool isNational(const TypeDescriptor& type) noexcept {
+            return type.kind == TypeKind::NCHAR || type.kind == TypeKind::NVARCHAR2;
+        }
+
+        // Todo valor del origen es ya un valor válido del destino
+        constexpr bool isNoOpCast(const TypeDescriptor& from, const TypeDescriptor& to) noexcept {
+            if (from.kind != to.kind) {
+                return false;
+            }
+            switch (from.kind) {
+                case TypeKind::NUMBER:
+                    return to.scale >= from.scale
+                           && int64_t{to.length} - to.scale >= int64_t{from.length} - from.scale;
+                case TypeKind::VARCHAR2:
+                case TypeKind::NVARCHAR2: return to.length >= from.length;
+                case TypeKind::CHAR:
+                case TypeKind::NCHAR: return to.length == from.length;
+                case TypeKind::DATE: return true;
+                case TypeKind::TIMESTAMP:
+                    return to.length >= from.length && to.hasTimeZone() == from.hasTimeZone();
+            }
+            return false;
+        }
+
+        void markFailed(std::span<uint64_t> failed, std::span<TypeError> errors, size_t row, TypeError error) noexcept {
+            failed[row / Bitmap::BITS_PER_WORD] |= uint64_t{1} << (row % Bitmap::BITS_PER_WORD);
+            errors[row] = error;
+        }
+
+        template<typename Visitor>
+        void forEachFailed(std::span<const uint64_t> failed, size_t count, Visitor&& visitor) {
+            for (size_t w = 0; w < Bitmap::wordsFor(count); ++w) {
+                for (uint64_t word = failed[w]; word != 0; word &= word - 1) {
+                    visitor(w * Bitmap::BITS_PER_WORD + static_cast<size_t>(std::countr_zero(word)));
+                }
+            }
+        }
+
+        // Espacios que faltan para llenar un CHAR/NCHAR, o por qué `text` no cabe en `to`
+        Expected<size_t> fitString(const TypeDescriptor& to, std::string_view text) noexcept {
+            size_t length = text.size();
+            if (isNational(to)) {
+                const Utf8Validation utf8 = validateUtf8(text);
+                if (!utf8.valid) {
+                    return TypeError(TypeErrorCode::INVALID_UTF8, static_cast<uint32_t>(utf8.errorOffset));
+                }
+                if (utf8.codePoints > to.length) {
+                    return TypeError(TypeErrorCode::VALUE_TOO_MANY_CHARACTERS, to.length);
+                }
+                length = utf8.codePoints;
+            } else if (length > to.length) {
+                return TypeError(TypeErrorCode::VALUE_TOO_LONG, to.length);
+            }
+            return isPadded(to) ? static_cast<size_t>(to.length) - length : size_t{0};
+        }
+
+        // Escribe las cadenas del resultado una tras otra en `chars`. Las vistas se
+        // crean en finish() porque `chars` puede cambiar de sitio mientras crece.
+        class StringWriter {
+        public:
+            StringWriter(const TypeDescriptor& to, CastBuffer& buffer, size_t count) : to(to), buffer(buffer) {
+                buffer.chars.clear();
+                buffer.ends.clear();
+                buffer.ends.reserve(count);
+            }
+
+            // Si no cabe, la fila queda vacía
+            Expected<void> append(std::string_view text) {
+                const auto padding = fitString(to, text);
+                if (padding) {
+                    buffer.chars.append(text);
+                    buffer.chars.append(*padding, CharType::PADDING_CHAR);
+                }
+                buffer.ends.push_back(static_cast<uint32_t>(buffer.chars.size()));
+                if (!padding) {
+                    return padding.error();
+                }
+                return {};
+            }
+
+            void finish() {
+                buffer.strings.resize(buffer.ends.size());
+                uint32_t start = 0;
+                for (size_t i = 0; i < buffer.ends.size(); ++i) {
+                    buffer.strings[i] = std::string_view(buffer.chars.data() + start, buffer.ends[i] - start);
+                    start = buffer.ends[i];
+                }
+            }
+
+        private:
+            const TypeDescriptor& to;
+            CastBuffer& buffer;
+        };
+
+        // Cadenas de origen sin el relleno de CHAR/NCHAR; sin copia si no lo hay
+        std::span<const std::string_view> sourceTexts(const TypeDescriptor& from, const CastColumn& input,
+                                                      std::vector<std::string_view>& trimmed) {
+            const auto texts = std::get<std::span<const std::string_view>>(input);
+            if (!isPadded(from)) {
+                return texts;
+            }
+            trimmed.resize(texts.size());
+            std::transform(texts.begin(), texts.end(), trimmed.begin(),
+                           [](std::string_view text) { return trimPadding(text); });
+            return trimmed;
+        }
+
+        std::string timestampMask(size_t digits, bool withTimeZone) {
+            std::string mask(DATE_MASK);
+            if (digits > 0) {
+                mask += ".FF" + std::to_string(digits);
+            }
+            if (withTimeZone) {
+                mask += " TZH:TZM";
+            }
+            return mask;
+        }
+
+        // Máscaras por defecto compiladas una sola vez
+        struct DefaultFormats {
+            DateTimeFormat date = DateTimeFormat::compile(DATE_MASK);
+            DateTimeFormat dateOnly = DateTimeFormat::compile("YYYY-MM-DD");
+            std::vector<DateTimeFormat> timestamps;       // Salida: [precisión * 2 + con zona]
+            std::vector<DateTimeFormat> timestampInputs;  // Entrada: [con zona * 2 + sin fracción]
+
+            DefaultFormats() {
+                for (size_t precision = 0; precision <= static_cast<size_t>(TimestampType::MAX_PRECISION); ++precision) {
+                    timestamps.push_back(DateTimeFormat::compile(timestampMask(precision, false)));
+                    timestamps.push_back(DateTimeFormat::compile(timestampMask(precision, true)));
+                }
+                for (const bool withTimeZone : {false, true}) {
+                    timestampInputs.push_back(DateTimeFormat::compile(
+                        timestampMask(static_cast<size_t>(TimestampType::MAX_PRECISION), withTimeZone)));
+                    timestampInputs.push_back(DateTimeFormat::compile(timestampMask(0, withTimeZone)));
+                }
+            }
+
+            [[nodiscard]] const DateTimeFormat& timestamp(const TypeDescriptor& type) const noexcept {
+                const size_t precision = std::min<size_t>(type.length, TimestampType::MAX_PRECISION);
+                return timestamps[precision * 2 + type.hasTimeZone()];
+            }
+        };
+
+        const DefaultFormats& defaultFormats() {
+            static const DefaultFormats formats;
+            return formats;
+        }
+
+        // Las filas que una máscara rechaza se reintentan con la siguiente
+        template<typename Value>
+        void parseWithFallback(std::initializer_list<const DateTimeFormat*> formats,
+                               std::span<const std::string_view> texts, std::span<Value> out,
+                               std::span<uint64_t> failed) {
+            auto format = formats.begin();
+            if ((*format)->parseBatch(texts, out, failed) == 0) {
+                return;
+            }
+            for (++format; format != formats.end(); ++format) {
+                std::vector<uint32_t> rows;
+                std::vector<std::string_view> retry;
+                forEachFailed(failed, texts.size(), [&](size_t row) {
+                    rows.push_back(static_cast<uint32_t>(row));
+                    retry.push_back(texts[row]);
+                });
+                std::vector<Value> parsed(retry.size());
+                std::vector<uint64_t> stillFailed(Bitmap::wordsFor(retry.size()));
+                const size_t remaining = (*format)->parseBatch(retry, parsed, stillFailed);
+                for (size_t j = 0; remaining < retry.size() && j < rows.size(); ++j) {
+                    if ((stillFailed[j / Bitmap::BITS_PER_WORD] >> (j % Bitmap::BITS_PER_WORD) & 1) == 0) {
+                        out[rows[j]] = parsed[j];
+                        failed[rows[j] / Bitmap::BITS_PER_WORD] &=
+                            ~(uint64_t{1} << (rows[j] % Bitmap::BITS_PER_WORD));
+                    }
+                }
+                if (remaining == 0) {
+                    return;
+                }
+            }
+        }
+
+        // Redondeo de la fracción a `precision` dígitos, con acarreo a los segundos
+        TimestampValue roundToPrecision(const TimestampValue& value, uint32_t precision) noexcept {
+            const int64_t unit = POW10_I64[static_cast<size_t>(TimestampType::MAX_PRECISION) - precision];
+            const int64_t nanos = (value.getNanos() + unit / 2) / unit * unit;
+            return TimestampValue::fromUtc(value.getUtcSeconds(), nanos)
+                .atOffset(value.getOffsetMinutes(), value.getZoneId());
+        }
+
+        int64_t localSeconds(const TimestampValue& value) noexcept {
+            return value.getUtcSeconds() + value.getOffsetMinutes() * int64_t{60};
+        }
+
+        // Cada kernel atiende un par de la matriz y deja en `buffer` n valores del destino
+
+        void numberToNumber(const TypeDescriptor&, const TypeDescriptor& to, const CastColumn& input,
+                            CastBuffer& buffer, std::span<uint64_t> failed, std::span<TypeError> errors) {
+            const auto values = std::get<std::span<const NumberValue>>(input);
+            const NumberType type(true, to.length, to.scale);
+            buffer.numbers.resize(values.size());
+            for (size_t i = 0; i < values.size(); ++i) {
+                if (values[i].fitsIn(type)) {
+                    buffer.numbers[i] = values[i].roundToScale(to.scale);
+                } else {
+                    buffer.numbers[i] = NumberValue{};
+                    markFailed(failed, errors, i, TypeError(TypeErrorCode::VALUE_OUT_OF_RANGE));
+                }
+            }
+        }
+
+        void numberToString(const TypeDescriptor&, const TypeDescriptor& to, const CastColumn& input,
+                            CastBuffer& buffer, std::span<uint64_t> failed, std::span<TypeError> errors) {
+            const auto values = std::get<std::span<const NumberValue>>(input);
+            StringWriter writer(to, buffer, values.size());
+            char text[NumberValue::MAX_STRING_LENGTH];
+            for (size_t i = 0; i < values.size(); ++i) {
+                if (const auto appended = writer.append({text, values[i].toChars(text)}); !appended) {
+                    markFailed(failed, errors, i, appended.error());
+                }
+            }
+            writer.finish();
+        }
+
+        // Como TO_NUMBER se ignoran los espacios a ambos lados, incluido el relleno de CHAR
+        void stringToNumber(const TypeDescriptor&, const TypeDescriptor& to, const CastColumn& input,
+                            CastBuffer& buffer, std::span<uint64_t> failed, std::span<TypeError> errors) {
+            const auto texts = std::get<std::span<const std::string_view>>(input);
+            const NumberType type(true, to.length, to.scale);
+            buffer.numbers.resize(texts.size());
+            for (size_t i = 0; i < texts.size(); ++i) {
+                std::string_view text = trimPadding(texts[i]);
+                text.remove_prefix(std::min(text.find_first_not_of(' '), text.size()));
+                auto parsed = NumberValue::tryFromString(text);
+                if (parsed && !parsed->fitsIn(type)) {
+                    parsed = TypeError(TypeErrorCode::VALUE_OUT_OF_RANGE);
+                }
+                if (parsed) {
+                    buffer.numbers[i] = parsed->roundToScale(to.scale);
+                } else {
+                    buffer.numbers[i] = NumberValue{};
+                    markFailed(failed, errors, i, parsed.error());
+                }
+            }
+        }
+
+        void stringToString(const TypeDescriptor& from, const TypeDescriptor& to, const CastColumn& input,
+                            CastBuffer& buffer, std::span<uint64_t> failed, std::span<TypeError> errors) {
+            const auto texts = std::get<std::span<const std::string_view>>(input);
+            const bool trim = isPadded(from);
+            StringWriter writer(to, buffer, texts.size());
+            for (size_t i = 0; i < texts.size(); ++i) {
+                if (const auto appended = writer.append(trim ? trimPadding(texts[i]) : texts[i]); !appended) {
+                    markFailed(failed, errors, i, appended.error());
+                }
+            }
+            writer.finish();
+        }
+
+        void stringToDate(const TypeDescriptor& from, const TypeDescriptor&, const CastColumn& input,
+                          CastBuffer& buffer, std::span<uint64_t> failed, std::span<TypeError> errors) {
+            std::vector<std::string_view> trimmed;
+            const auto texts = sourceTexts(from, input, trimmed);
+            buffer.dates.resize(texts.size());
+            parseWithFallback<DateValue>({&defaultFormats().date, &defaultFormats().dateOnly}, texts, buffer.dates,
+                                         failed);
+            forEachFailed(failed, texts.size(), [&](size_t row) { errors[row] = TypeError(TypeErrorCode::INVALID_DATE); });
+        }
+
+        void stringToTimestamp(const TypeDescriptor& from, const TypeDescriptor& to, const CastColumn& input,
+                               CastBuffer& buffer, std::span<uint64_t> failed, std::span<TypeError> errors) {
+            std::vector<std::string_view> trimmed;
+            const auto texts = sourceTexts(from, input, trimmed);
+            const auto& inputs = defaultFormats().timestampInputs;
+            buffer.timestamps.resize(texts.size());
+            if (to.hasTimeZone()) {
+                // Sin desplazamiento en el texto se toma la zona de la sesión (UTC)
+                parseWithFallback<TimestampValue>({&inputs[2], &inputs[3], &inputs[0], &inputs[1]}, texts,
+                                                  buffer.timestamps, failed);
+            } else {
+                parseWithFallback<TimestampValue>({&inputs[0], &inputs[1]}, texts, buffer.timestamps, failed);
+            }
+            for (auto& value : buffer.timestamps) {
+                value = roundToPrecision(value, to.length);
+            }
+            forEachFailed(failed, texts.size(),
+                          [&](size_t row) { errors[row] = TypeError(TypeErrorCode::INVALID_TIMESTAMP); });
+        }
+
+        // El año debe caber en DATE para poder formatearse; esas filas fallan sin lanzar
+        template<typename Value>
+        void formatToStrings(const DateTimeFormat& format, std::span<const Value> values, const TypeDescriptor& to,
+                             CastBuffer& buffer, std::span<uint64_t> failed, std::span<TypeError> errors,
+                             TypeError outOfRange) {
+            StringWriter writer(to, buffer, values.size());
+            std::vector<char> scratch(format.maxLength());
+            for (size_t i = 0; i < values.size(); ++i) {
+                bool inRange;
+                if constexpr (std::is_same_v<Value, DateValue>) {
+                    inRange = values[i].isInRange();
+                } else {
+                    inRange = DateValue{localSeconds(values[i])}.isInRange();
+                }
+                if (!inRange) {
+                    static_cast<void>(writer.append({}));
+                    markFailed(failed, errors, i, outOfRange);
+                    continue;
+                }
+                const size_t length = format.format(values[i], scratch);
+                if (const auto appended = writer.append({scratch.data(), length}); !appended) {
+                    markFailed(failed, errors, i, appended.error());
+                }
+            }
+            writer.finish();
+        }
+
+        void dateToString(const TypeDescriptor&, const TypeDescriptor& to, const CastColumn& input,
+                          CastBuffer& buffer, std::span<uint64_t> failed, std::span<TypeError> errors) {
+            formatToStrings(defaultFormats().date, std::get<std::span<const DateValue>>(input), to, buffer, failed,
+                            errors, TypeError(TypeErrorCode::INVALID_DATE));
+        }
+
+        void timestampToString(const TypeDescriptor& from, const TypeDescriptor& to, const CastColumn& input,
+                               CastBuffer& buffer, std::span<uint64_t> failed, std::span<TypeError> errors) {
+            formatToStrings(defaultFormats().timestamp(from), std::get<std::span<const TimestampValue>>(input), to,
+                            buffer, failed, errors, TypeError(TypeErrorCode::INVALID_TIMESTAMP));
+        }
+
+        // DATE es hora local; con la sesión en UTC es también el instante
+        void dateToTimestamp(const TypeDescriptor&, const TypeDescriptor&, const CastColumn& input,
+                             CastBuffer& buffer, std::span<uint64_t>, std::span<TypeError>) {
+            const auto values = std::get<std::span<const DateValue>>(input);
+            buffer.timestamps.resize(values.size());
+            for (size_t i = 0; i < values.size(); ++i) {
+                buffer.timestamps[i] = TimestampValue::fromUtc(values[i].getEpochSeconds());
+            }
+        }
+
+        // Hora local truncada al segundo, como DateArithmeticKernels::toLocalDates
+        void timestampToDate(const TypeDescriptor&, const TypeDescriptor&, const CastColumn& input,
+                             CastBuffer& buffer, std::span<uint64_t> failed, std::span<TypeError> errors) {
+            const auto values = std::get<std::span<const TimestampValue>>(input);
+            buffer.dates.resize(values.size());
+            for (size_t i = 0; i < values.size(); ++i) {
+                const DateValue date{localSeconds(values[i])};
+                if (date.isInRange()) {
+                    buffer.dates[i] = date;
+                } else {
+                    buffer.dates[i] = DateValue{};
+                    markFailed(failed, errors, i, TypeError(TypeErrorCode::INVALID_DATE));
+                }
+            }
+        }
+
+        void timestampToTimestamp(const TypeDescriptor& from, const TypeDescriptor& to, const CastColumn& input,
+                                  CastBuffer& buffer, std::span<uint64_t>, std::span<TypeError>) {
+            const auto values = std::get<std::span<const TimestampValue>>(input);
+            const bool dropZone = from.hasTimeZone() && !to.hasTimeZone();
+            buffer.timestamps.resize(values.size());
+            for (size_t i = 0; i < values.size(); ++i) {
+                const TimestampValue value = dropZone
+                                                 ? TimestampValue::fromUtc(localSeconds(values[i]), values[i].getNanos())
+                                                 : values[i];
+                buffer.timestamps[i] = roundToPrecision(value, to.length);
+            }
+        }
+
+        CastColumn outputOf(TypeKind kind, const CastBuffer& buffer, size_t count) noexcept {
+            switch (columnIndex(kind)) {
+                case 0: return std::span<const NumberValue>(buffer.numbers.data(), count);
+                case 2: return std::span<const DateValue>(buffer.dates.data(), count);
+                case 3: return std::span<const TimestampValue>(buffer.timestamps.data(), count);
+                default: return std::span<const std::string_view>(buffer.strings.data(), count);
+            }
+        }
+    } // namespace
+
+    Expected<CastPlan> CastPlan::of(const TypeDescriptor& from, const TypeDescriptor& to) noexcept {
+        if (isNoOpCast(from, to)) {
+            return CastPlan(from, to, nullptr);
+        }
+        // Filas: origen; columnas: destino, en el orden de TypeKind
+        using Row = std::array<Kernel, KIND_COUNT>;
+        constexpr Row FROM_STRING = {stringToNumber, stringToString, stringToString, stringToString,
+                                     stringToString, stringToDate, stringToTimestamp};
+        static constexpr std::array<Row, KIND_COUNT> MATRIX = {{
+            {numberToNumber, numberToString, numberToString, numberToString, numberToString, nullptr, nullptr},
+            FROM_STRING,
+            FROM_STRING,
+            FROM_STRING,
+            FROM_STRING,
+            {nullptr, dateToString, dateToString, dateToString, dateToString, nullptr, dateToTimestamp},
+            {nullptr, timestampToString, timestampToString, timestampToString, timestampToString, timestampToDate,
+             timestampToTimestamp},
+        }};
+        const auto source = static_cast<size_t>(from.kind);
+        const auto target = static_cast<size_t>(to.kind);
+        const Kernel kernel = source < KIND_COUNT && target < KIND_COUNT ? MATRIX[source][target] : nullptr;
+        if (kernel == nullptr) {
+            return TypeError(TypeErrorCode::UNSUPPORTED_CAST, static_cast<uint32_t>(to.kind),
+                             static_cast<uint8_t>(from.kind));
+        }
+        return CastPlan(from, to, kernel);
+    }
+
+    CastResult CastPlan::apply(const CastColumn& input, CastBuffer& buffer, std::span<uint64_t> failed,
+                               std::span<TypeError> errors) const {
+        if (input.index() != columnIndex(from.kind)) {
+            throw DataTypeException("Input column does not match the cast source type");
+        }
+        const size_t count = std::visit([](const auto& values) { return values.size(); }, input);
+        if (failed.size() < Bitmap::wordsFor(count) || errors.size() < count) {
+            throw DataTypeException("Output span is smaller than input");
+        }
+        std::fill_n(failed.begin(), Bitmap::wordsFor(count), uint64_t{0});
+        if (kernel == nullptr) {
+            return {input, 0};
+        }
+        kernel(from, to, input, buffer, failed, errors);
+        size_t failures = 0;
+        for (size_t w = 0; w < Bitmap::wordsFor(count); ++w) {
+            failures += static_cast<size_t>(std::popcount(failed[w]));
+        }
+        return {outputOf(to.kind, buffer, count), failures};
+    }
+
+    CastColumn CastPlan::applyOrThrow(const CastColumn& input, CastBuffer& buffer) const {
+        const size_t count = std::visit([](const auto& values) { return values.size(); }, input);
+        std::vector<uint64_t> failed(Bitmap::wordsFor(count));
+        std::vector<TypeError> errors(count);
+        const CastResult result = apply(input, buffer, failed, errors);
+        for (size_t w = 0; w < failed.size(); ++w) {
+            if (failed[w] != 0) {
+                throw DataTypeException(errors[w * Bitmap::BITS_PER_WORD + static_cast<size_t>(std::countr_zero(failed[w]))]);
+            }
+        }
+        return result.values;
+    }
+
+} // namespace db::types
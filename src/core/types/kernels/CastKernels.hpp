@@ -0,0 +1,90 @@
+// src/core/types/kernels/CastKernels.hpp
+#ifndef CAST_KERNELS_HPP
+#define CAST_KERNELS_HPP
+
+#include "../TypeDescriptor.hpp"
+#include "../exceptions/TypeError.hpp"
+#include "../util/Bitmap.hpp"
+#include "../util/Expected.hpp"
+#include "../values/NumberValue.hpp"
+#include "../values/DateValue.hpp"
+#include "../values/TimestampValue.hpp"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace db::types {
+
+    // Columna de entrada o salida de un cast; la alternativa depende del TypeKind:
+    // NUMBER, cualquier tipo de cadena, DATE o TIMESTAMP
+    using CastColumn = std::variant<std::span<const NumberValue>, std::span<const std::string_view>,
+                                    std::span<const DateValue>, std::span<const TimestampValue>>;
+
+    // Memoria del resultado, reutilizable entre lotes para no reservar en cada
+    // llamada. Los string_view de `strings` apuntan a `chars`: siguen siendo
+    // válidos hasta el siguiente cast sobre el mismo buffer.
+    struct CastBuffer {
+        std::vector<NumberValue> numbers;
+        std::vector<std::string_view> strings;
+        std::vector<DateValue> dates;
+        std::vector<TimestampValue> timestamps;
+        std::string chars;
+        std::vector<uint32_t> ends;
+    };
+
+    struct CastResult {
+        CastColumn values;
+        size_t failed;
+    };
+
+    // Conversión entre dos tipos resuelta una vez: of() consulta la matriz de casts
+    // por (origen, destino) y guarda el kernel por lotes de ese par, o ninguno si
+    // los valores de origen ya son válidos en el destino (NUMBER(10) -> NUMBER(12),
+    // VARCHAR2(10) -> VARCHAR2(20), DATE -> DATE...).
+    //
+    // Semántica de Oracle con la sesión en UTC y las máscaras por defecto
+    // YYYY-MM-DD HH24:MI:SS[.FFn][ TZH:TZM]:
+    //   - CHAR/NCHAR de origen pierden el relleno; CHAR/NCHAR de destino lo añaden.
+    //   - Cadena -> NUMBER admite espacios alrededor; NUMBER se redondea a la escala.
+    //   - Cadena -> TIMESTAMP admite la fracción con cualquier número de dígitos y
+    //     redondea a la precisión; sin TZH:TZM, WITH TIME ZONE toma el desplazamiento
+    //     0 de la sesión. Cadena -> DATE admite también sólo YYYY-MM-DD.
+    //   - TIMESTAMP -> DATE y WITH TIME ZONE -> sin zona se quedan con la hora local.
+    class CastPlan {
+    public:
+        // UNSUPPORTED_CAST si el par no tiene conversión (DATE -> NUMBER...)
+        [[nodiscard]] static Expected<CastPlan> of(const TypeDescriptor& from, const TypeDescriptor& to) noexcept;
+
+        [[nodiscard]] const TypeDescriptor& getSource() const noexcept { return from; }
+        [[nodiscard]] const TypeDescriptor& getTarget() const noexcept { return to; }
+        [[nodiscard]] bool isNoOp() const noexcept { return kernel == nullptr; }
+
+        // Las filas que no se pueden convertir se marcan en `failed` (wordsFor(n)
+        // palabras), su causa queda en errors[i] y su valor queda vacío o a cero;
+        // errors[i] de las filas correctas no se escribe. Un cast sin conversión
+        // devuelve la entrada tal cual. Lanza una sola vez si `input` no es del tipo
+        // de origen o las salidas son cortas.
+        CastResult apply(const CastColumn& input, CastBuffer& buffer, std::span<uint64_t> failed,
+                         std::span<TypeError> errors) const;
+
+        // Igual que apply pero lanza DataTypeException con el error de la primera fila mala
+        CastColumn applyOrThrow(const CastColumn& input, CastBuffer& buffer) const;
+
+    private:
+        using Kernel = void (*)(const TypeDescriptor& from, const TypeDescriptor& to, const CastColumn& input,
+                                CastBuffer& buffer, std::span<uint64_t> failed, std::span<TypeError> errors);
+
+        constexpr CastPlan(const TypeDescriptor& from, const TypeDescriptor& to, Kernel kernel) noexcept
+            : from(from), to(to), kernel(kernel) {}
+
+        TypeDescriptor from;
+        TypeDescriptor to;
+        Kernel kernel;
+    };
+
+} // namespace db::types
+
+#endif // CAST_KERNELS_HPP
@@ -0,0 +1,51 @@
+// src/core/types/kernels/CompactStringKernels.cpp
+#include "CompactStringKernels.hpp"
+#include <algorithm>
+
+namespace db::types {
+
+    namespace {
+        template<typename Predicate>
+        Bitmap select(std::span<const CompactString> values, Predicate predicate) {
+            Bitmap selected(values.size());
+            auto words = selected.words();
+            for (size_t base = 0; base < values.size(); base += Bitmap::BITS_PER_WORD) {
+                const size_t end = std::min(values.size(), base + Bitmap::BITS_PER_WORD);
+                uint64_t word = 0;
+                for (size_t i = base; i < end; ++i) {
+                    word |= static_cast<uint64_t>(predicate(values[i])) << (i - base);
+                }
+                words[base / Bitmap::BITS_PER_WORD] = word;
+            }
+            return selected;
+        }
+    } // namespace
+
+    Bitmap CompactStringKernels::selectEqual(std::span<const CompactString> values, const CompactString& needle) {
+        const uint64_t head = needle.head();
+        if (needle.isInline()) {
+            // Misma longitud implica que el valor también está en línea: dos palabras sin saltos
+            const uint64_t tail = needle.tail();
+            return select(values, [&](const CompactString& value) {
+                return (value.head() == head) & (value.tail() == tail);
+            });
+        }
+        return select(values, [&](const CompactString& value) {
+            return value.head() == head && value == needle;
+        });
+    }
+
+    Bitmap CompactStringKernels::selectBetween(std::span<const CompactString> values, const CompactString& low,
+                                               const CompactString& high) {
+        return select(values, [&](const CompactString& value) {
+            return value >= low && value <= high;
+        });
+    }
+
+    Bitmap CompactStringKernels::selectStartsWith(std::span<const CompactString> values, std::string_view prefix) {
+        return select(values, [&](const CompactString& value) {
+            return value.startsWith(prefix);
+        });
+    }
+
+} // namespace db::types
@@ -0,0 +1,32 @@
+// src/core/types/kernels/CompactStringKernels.hpp
+#ifndef COMPACT_STRING_KERNELS_HPP
+#define COMPACT_STRING_KERNELS_HPP
+
+#include "../values/CompactString.hpp"
+#include "../util/Bitmap.hpp"
+#include <span>
+#include <string_view>
+
+namespace db::types {
+
+    // Filtros sobre columnas de CompactString. Longitud y prefijo están en el
+    // propio handle, así que la mayoría de filas se deciden sin seguir el puntero
+    // a la arena y el bucle recorre memoria contigua de 16 bytes por fila.
+    class CompactStringKernels {
+    public:
+        CompactStringKernels() = delete;
+
+        // value = needle
+        static Bitmap selectEqual(std::span<const CompactString> values, const CompactString& needle);
+
+        // low <= value <= high en orden de bytes
+        static Bitmap selectBetween(std::span<const CompactString> values, const CompactString& low,
+                                    const CompactString& high);
+
+        // value LIKE 'prefix%'
+        static Bitmap selectStartsWith(std::span<const CompactString> values, std::string_view prefix);
+    };
+
+} // namespace db::types
+
+#endif // COMPACT_STRING_KERNELS_HPP
@@ -0,0 +1,284 @@
+// src/core/types/kernels/DateArithmeticKernels.cpp
+#include "DateArithmeticKernels.hpp"
+#include <algorithm>
+
+namespace db::types {
+
+    namespace {
+        constexpr int64_t SECONDS_PER_HOUR = 3600;
+        constexpr int64_t SECONDS_PER_MINUTE = 60;
+
+        // Mes que contiene la última fila vista. Solo se recalcula la fecha civil
+        // cuando una fila cae fuera de [firstDay, endDay).
+        struct MonthCursor {
+            int64_t firstDay = 1;
+            int64_t endDay = 1;
+            int year = 0;
+            int month = 0;
+
+            void locate(int64_t days) noexcept {
+                if (days >= firstDay && days < endDay) {
+                    return;
+                }
+                const CivilDate date = civilFromDays(days);
+                year = date.year;
+                month = date.month;
+                firstDay = days - (date.day - 1);
+                endDay = firstDay + daysInMonth(year, month);
+            }
+
+            [[nodiscard]] int dayOf(int64_t days) const noexcept {
+                return static_cast<int>(days - firstDay) + 1;
+            }
+
+            [[nodiscard]] int length() const noexcept {
+                return static_cast<int>(endDay - firstDay);
+            }
+        };
+
+        struct DayAndTime {
+            int64_t days;
+            int64_t secondOfDay;
+        };
+
+        inline DayAndTime split(DateValue value) noexcept {
+            const int64_t days = value.getEpochDays();
+            return {days, value.getEpochSeconds() - days * SECONDS_PER_DAY};
+        }
+
+        inline DateValue atDay(int64_t days, int64_t secondOfDay = 0) noexcept {
+            return DateValue{days * SECONDS_PER_DAY + secondOfDay};
+        }
+
+        inline int64_t firstDayOfMonth(int year, int month) noexcept {
+            return daysFromCivil(year, month, 1);
+        }
+
+        // Primer día del mes `month` contado desde enero de `year`; admite meses fuera de 1..12
+        inline int64_t firstDayOfMonthOffset(int year, int64_t month) noexcept {
+            const int64_t total = year * int64_t{12} + month - 1;
+            return daysFromCivil(floorDiv(total, 12), static_cast<int>(floorMod(total, 12)) + 1, 1);
+        }
+
+        DateValue addMonthsTo(MonthCursor& cursor, DateValue value, int32_t months) noexcept {
+            const auto [days, secondOfDay] = split(value);
+            cursor.locate(days);
+            const int day = cursor.dayOf(days);
+            const int64_t total = cursor.year * int64_t{12} + (cursor.month - 1) + months;
+            const int64_t year = floorDiv(total, 12);
+            const int month = static_cast<int>(floorMod(total, 12)) + 1;
+            const int targetLength = daysInMonth(year, month);
+            const int targetDay = day == cursor.length() ? targetLength : std::min(day, targetLength);
+            return atDay(daysFromCivil(year, month, targetDay), secondOfDay);
+        }
+
+        // Inicio del periodo de `unit` que contiene la fila, y el del siguiente si
+        // hay que redondear hacia arriba
+        DateValue truncOrRound(MonthCursor& cursor, DateValue value, DateUnit unit, bool roundUp) noexcept {
+            const int64_t seconds = value.getEpochSeconds();
+            int64_t span = 0;
+            switch (unit) {
+                case DateUnit::DAY: span = SECONDS_PER_DAY; break;
+                case DateUnit::HOUR: span = SECONDS_PER_HOUR; break;
+                case DateUnit::MINUTE: span = SECONDS_PER_MINUTE; break;
+                default: break;
+            }
+            if (span != 0) {
+                return DateValue{floorDiv(seconds + (roundUp ? span / 2 : 0), span) * span};
+            }
+
+            const int64_t days = floorDiv(seconds, SECONDS_PER_DAY);
+            cursor.locate(days);
+            const int day = cursor.dayOf(days);
+            switch (unit) {
+                case DateUnit::MONTH:
+                    return atDay(roundUp && day >= 16 ? cursor.endDay : cursor.firstDay);
+                case DateUnit::QUARTER: {
+                    const int first = (cursor.month - 1) / 3 * 3 + 1;
+                    const int monthInQuarter = cursor.month - first;
+                    const bool up = roundUp && (monthInQuarter == 2 || (monthInQuarter == 1 && day >= 16));
+                    return atDay(firstDayOfMonthOffset(cursor.year, first + (up ? 3 : 0)));
+                }
+                default: {
+                    const bool up = roundUp && cursor.month >= 7;
+                    return atDay(firstDayOfMonth(cursor.year + (up ? 1 : 0), 1));
+                }
+            }
+        }
+
+        void checkSizes(size_t input, size_t output) {
+            if (output < input) {
+                throw DataTypeException("Output span is smaller than input");
+            }
+        }
+    } // namespace
+
+    void DateArithmeticKernels::addMonths(std::span<const DateValue> values, int32_t months,
+                                          std::span<DateValue> out) {
+        checkSizes(values.size(), out.size());
+        MonthCursor cursor;
+        for (size_t i = 0; i < values.size(); ++i) {
+            out[i] = addMonthsTo(cursor, values[i], months);
+        }
+    }
+
+    void DateArithmeticKernels::addMonths(std::span<const DateValue> values, std::span<const int32_t> months,
+                                          std::span<DateValue> out) {
+        checkSizes(values.size(), months.size());
+        checkSizes(values.size(), out.size());
+        MonthCursor cursor;
+        for (size_t i = 0; i < values.size(); ++i) {
+            out[i] = addMonthsTo(cursor, values[i], months[i]);
+        }
+    }
+
+    void DateArithmeticKernels::lastDay(std::span<const DateValue> values, std::span<DateValue> out) {
+        checkSizes(values.size(), out.size());
+        MonthCursor cursor;
+        for (size_t i = 0; i < values.size(); ++i) {
+            const auto [days, secondOfDay] = split(values[i]);
+            cursor.locate(days);
+            out[i] = atDay(cursor.endDay - 1, secondOfDay);
+        }
+    }
+
+    void DateArithmeticKernels::trunc(std::span<const DateValue> values, DateUnit unit, std::span<DateValue> out) {
+        checkSizes(values.size(), out.size());
+        MonthCursor cursor;
+        for (size_t i = 0; i < values.size(); ++i) {
+            out[i] = truncOrRound(cursor, values[i], unit, false);
+        }
+    }
+
+    void DateArithmeticKernels::round(std::span<const DateValue> values, DateUnit unit, std::span<DateValue> out) {
+        checkSizes(values.size(), out.size());
+        MonthCursor cursor;
+        for (size_t i = 0; i < values.size(); ++i) {
+            out[i] = truncOrRound(cursor, values[i], unit, true);
+        }
+    }
+
+    void DateArithmeticKernels::extract(std::span<const DateValue> values, DateField field, std::span<int32_t> out) {
+        checkSizes(values.size(), out.size());
+        // Los campos de hora y el día de la semana no necesitan la fecha civil
+        switch (field) {
+            case DateField::HOUR:
+                for (size_t i = 0; i < values.size(); ++i) {
+                    out[i] = static_cast<int32_t>(split(values[i]).secondOfDay / SECONDS_PER_HOUR);
+                }
+                return;
+            case DateField::MINUTE:
+                for (size_t i = 0; i < values.size(); ++i) {
+                    out[i] = static_cast<int32_t>(split(values[i]).secondOfDay / SECONDS_PER_MINUTE % 60);
+                }
+                return;
+            case DateField::SECOND:
+                for (size_t i = 0; i < values.size(); ++i) {
+                    out[i] = static_cast<int32_t>(split(values[i]).secondOfDay % 60);
+                }
+                return;
+            case DateField::TIMEZONE_HOUR:
+            case DateField::TIMEZONE_MINUTE:
+                throw DataTypeException("DATE has no time zone to extract");
+            case DateField::DAY_OF_WEEK:
+                // 1970-01-01 fue jueves (4 en ISO)
+                for (size_t i = 0; i < values.size(); ++i) {
+                    out[i] = static_cast<int32_t>(floorMod(values[i].getEpochDays() + 3, 7) + 1);
+                }
+                return;
+            default:
+                break;
+        }
+
+        MonthCursor cursor;
+        for (size_t i = 0; i < values.size(); ++i) {
+            const int64_t days = values[i].getEpochDays();
+            cursor.locate(days);
+            switch (field) {
+                case DateField::YEAR: out[i] = cursor.year; break;
+                case DateField::QUARTER: out[i] = (cursor.month - 1) / 3 + 1; break;
+                case DateField::MONTH: out[i] = cursor.month; break;
+                case DateField::DAY: out[i] = cursor.dayOf(days); break;
+                default:
+                    out[i] = static_cast<int32_t>(days - firstDayOfMonth(cursor.year, 1) + 1);
+                    break;
+            }
+        }
+    }
+
+    void DateArithmeticKernels::extract(std::span<const TimestampValue> values, DateField field,
+                                        std::span<double> out) {
+        checkSizes(values.size(), out.size());
+        switch (field) {
+            case DateField::TIMEZONE_HOUR:
+                for (size_t i = 0; i < values.size(); ++i) {
+                    out[i] = values[i].getOffsetMinutes() / 60;
+                }
+                return;
+            case DateField::TIMEZONE_MINUTE:
+                for (size_t i = 0; i < values.size(); ++i) {
+                    out[i] = values[i].getOffsetMinutes() % 60;
+                }
+                return;
+            default:
+                break;
+        }
+
+        // La hora local es un DATE: se reutiliza su kernel por bloques en la pila
+        constexpr size_t BLOCK = 256;
+        DateValue local[BLOCK];
+        int32_t fields[BLOCK];
+        for (size_t base = 0; base < values.size(); base += BLOCK) {
+            const size_t count = std::min(BLOCK, values.size() - base);
+            const auto block = values.subspan(base, count);
+            toLocalDates(block, std::span<DateValue>(local, count));
+            extract(std::span<const DateValue>(local, count), field, std::span<int32_t>(fields, count));
+            for (size_t i = 0; i < count; ++i) {
+                out[base + i] = fields[i];
+            }
+            if (field == DateField::SECOND) {
+                for (size_t i = 0; i < count; ++i) {
+                    out[base + i] += block[i].getNanos() / 1e9;
+                }
+            }
+        }
+    }
+
+    void DateArithmeticKernels::daysBetween(std::span<const DateValue> a, std::span<const DateValue> b,
+                                            std::span<double> out) {
+        checkSizes(a.size(), b.size());
+        checkSizes(a.size(), out.size());
+        constexpr double DAYS_PER_SECOND = 1.0 / static_cast<double>(SECONDS_PER_DAY);
+        for (size_t i = 0; i < a.size(); ++i) {
+            out[i] = static_cast<double>(a[i].getEpochSeconds() - b[i].getEpochSeconds()) * DAYS_PER_SECOND;
+        }
+    }
+
+    void DateArithmeticKernels::secondsBetween(std::span<const DateValue> a, std::span<const DateValue> b,
+                                               std::span<int64_t> out) {
+        checkSizes(a.size(), b.size());
+        checkSizes(a.size(), out.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            out[i] = a[i].getEpochSeconds() - b[i].getEpochSeconds();
+        }
+    }
+
+    void DateArithmeticKernels::secondsBetween(std::span<const TimestampValue> a, std::span<const TimestampValue> b,
+                                               std::span<double> out) {
+        checkSizes(a.size(), b.size());
+        checkSizes(a.size(), out.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            const auto seconds = static_cast<double>(a[i].getUtcSeconds() - b[i].getUtcSeconds());
+            const auto nanos = static_cast<double>(a[i].getNanos() - b[i].getNanos());
+            out[i] = seconds + nanos / TimestampValue::NANOS_PER_SECOND;
+        }
+    }
+
+    void DateArithmeticKernels::toLocalDates(std::span<const TimestampValue> values, std::span<DateValue> out) {
+        checkSizes(values.size(), out.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            out[i] = DateValue{values[i].getUtcSeconds() + values[i].getOffsetMinutes() * SECONDS_PER_MINUTE};
+        }
+    }
+
+} // namespace db::types
@@ -0,0 +1,62 @@
+// src/core/types/kernels/DateArithmeticKernels.hpp
+#ifndef DATE_ARITHMETIC_KERNELS_HPP
+#define DATE_ARITHMETIC_KERNELS_HPP
+
+#include "../values/DateValue.hpp"
+#include "../values/TimestampValue.hpp"
+#include <cstdint>
+#include <span>
+
+namespace db::types {
+
+    // Unidades de TRUNC/ROUND ('YYYY', 'Q', 'MM', 'DD', 'HH', 'MI')
+    enum class DateUnit : uint8_t { YEAR, QUARTER, MONTH, DAY, HOUR, MINUTE };
+
+    // Campos de EXTRACT. DAY_OF_WEEK sigue ISO: 1 es lunes y 7 domingo. Los de
+    // zona sólo existen en TIMESTAMP y conservan el signo del desplazamiento.
+    enum class DateField : uint8_t {
+        YEAR, QUARTER, MONTH, DAY, HOUR, MINUTE, SECOND, DAY_OF_WEEK, DAY_OF_YEAR, TIMEZONE_HOUR, TIMEZONE_MINUTE
+    };
+
+    // Aritmética de calendario por columnas sobre DateValue. Cada kernel recorre el
+    // lote con un cursor que recuerda el mes de la fila anterior: en columnas
+    // agrupadas u ordenadas por fecha casi ninguna fila paga la conversión civil.
+    // Los resultados no se validan contra el rango de DATE (ver DateValue::isInRange).
+    class DateArithmeticKernels {
+    public:
+        DateArithmeticKernels() = delete;
+
+        // ADD_MONTHS de Oracle: el último día de un mes va al último día del mes destino
+        static void addMonths(std::span<const DateValue> values, int32_t months, std::span<DateValue> out);
+        static void addMonths(std::span<const DateValue> values, std::span<const int32_t> months,
+                              std::span<DateValue> out);
+
+        // Conserva la hora del día, como LAST_DAY
+        static void lastDay(std::span<const DateValue> values, std::span<DateValue> out);
+
+        static void trunc(std::span<const DateValue> values, DateUnit unit, std::span<DateValue> out);
+        // Redondea hacia arriba desde julio, el día 16 del segundo mes del trimestre,
+        // el día 16, las 12:00 y el minuto/segundo 30 respectivamente
+        static void round(std::span<const DateValue> values, DateUnit unit, std::span<DateValue> out);
+
+        // Lanza una sola vez con TIMEZONE_HOUR/TIMEZONE_MINUTE: DATE no tiene zona
+        static void extract(std::span<const DateValue> values, DateField field, std::span<int32_t> out);
+        // Campos de la hora local en el desplazamiento de cada fila; SECOND incluye la
+        // fracción, como el NUMBER que devuelve EXTRACT en Oracle
+        static void extract(std::span<const TimestampValue> values, DateField field, std::span<double> out);
+
+        // a - b fila a fila: en días con fracción (DATE - DATE) o en segundos enteros
+        static void daysBetween(std::span<const DateValue> a, std::span<const DateValue> b, std::span<double> out);
+        static void secondsBetween(std::span<const DateValue> a, std::span<const DateValue> b,
+                                   std::span<int64_t> out);
+        // Segundos con fracción entre instantes UTC
+        static void secondsBetween(std::span<const TimestampValue> a, std::span<const TimestampValue> b,
+                                   std::span<double> out);
+
+        // CAST(ts AS DATE): hora local en el desplazamiento original, sin fracción
+        static void toLocalDates(std::span<const TimestampValue> values, std::span<DateValue> out);
+    };
+
+} // namespace db::types
+
+#endif // DATE_ARITHMETIC_KERNELS_HPP
@@ -0,0 +1,102 @@
+// src/core/types/kernels/DateKernels.cpp
+#include "DateKernels.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace db::types {
+
+    size_t DateKernels::findInvalid(const DateFieldColumns<const int>& fields, std::span<uint64_t> invalid) noexcept {
+        const size_t count = fields.size();
+        size_t total = 0;
+        for (size_t base = 0; base < count; base += Bitmap::BITS_PER_WORD) {
+            const size_t end = std::min(count, base + Bitmap::BITS_PER_WORD);
+            uint64_t word = 0;
+            for (size_t i = base; i < end; ++i) {
+                const bool valid = DateType::isValidFields(fields.year[i], fields.month[i], fields.day[i],
+                                                           fields.hour[i], fields.minute[i], fields.second[i]);
+                word |= static_cast<uint64_t>(!valid) << (i - base);
+            }
+            invalid[base / Bitmap::BITS_PER_WORD] = word;
+            total += static_cast<size_t>(std::popcount(word));
+        }
+        return total;
+    }
+
+    void DateKernels::fromFields(const DateFieldColumns<const int>& fields, std::span<DateValue> out) noexcept {
+        const size_t count = std::min(fields.size(), out.size());
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = DateValue::fromCivil(fields.year[i], fields.month[i], fields.day[i],
+                                          fields.hour[i], fields.minute[i], fields.second[i]);
+        }
+    }
+
+    void DateKernels::toFields(std::span<const DateValue> values, const DateFieldColumns<int>& out) noexcept {
+        const size_t count = std::min(values.size(), out.size());
+        for (size_t i = 0; i < count; ++i) {
+            const DateFields fields = values[i].toFields();
+            out.year[i] = fields.year;
+            out.month[i] = fields.month;
+            out.day[i] = fields.day;
+            out.hour[i] = fields.hour;
+            out.minute[i] = fields.minute;
+            out.second[i] = fields.second;
+        }
+    }
+
+    void DateKernels::encode(std::span<const DateValue> values, std::span<uint8_t> out) {
+        if (out.size() < values.size() * DateValue::ENCODED_SIZE) {
+            throw DataTypeException("Output span is smaller than input");
+        }
+        // Mínimo y máximo sin saltos en lugar de comprobar cada fila
+        int64_t lowest = DateValue::MIN_EPOCH_SECONDS;
+        int64_t highest = DateValue::MAX_EPOCH_SECONDS;
+        for (const DateValue value : values) {
+            lowest = std::min(lowest, value.getEpochSeconds());
+            highest = std::max(highest, value.getEpochSeconds());
+        }
+        if (lowest < DateValue::MIN_EPOCH_SECONDS || highest > DateValue::MAX_EPOCH_SECONDS) {
+            throw DataTypeException("Date out of range");
+        }
+
+        uint8_t* cursor = out.data();
+        for (const DateValue value : values) {
+            value.encodeUnchecked(cursor);
+            cursor += DateValue::ENCODED_SIZE;
+        }
+    }
+
+    void DateKernels::decode(std::span<const uint8_t> bytes, std::span<DateValue> out) {
+        if (bytes.size() % DateValue::ENCODED_SIZE != 0) {
+            throw DataTypeException("Malformed DATE encoding");
+        }
+        const size_t count = bytes.size() / DateValue::ENCODED_SIZE;
+        if (out.size() < count) {
+            throw DataTypeException("Output span is smaller than input");
+        }
+        bool valid = true;
+        for (size_t i = 0; i < count; ++i) {
+            valid &= DateValue::decodeUnchecked(bytes.data() + i * DateValue::ENCODED_SIZE, out[i]);
+        }
+        if (!valid) {
+            throw DataTypeException("Malformed DATE encoding");
+        }
+    }
+
+    Bitmap DateKernels::selectBetween(std::span<const DateValue> values, DateValue low, DateValue high) {
+        Bitmap selected(values.size());
+        auto words = selected.words();
+        const int64_t lower = low.getEpochSeconds();
+        const int64_t upper = high.getEpochSeconds();
+        for (size_t base = 0; base < values.size(); base += Bitmap::BITS_PER_WORD) {
+            const size_t end = std::min(values.size(), base + Bitmap::BITS_PER_WORD);
+            uint64_t word = 0;
+            for (size_t i = base; i < end; ++i) {
+                const int64_t v = values[i].getEpochSeconds();
+                word |= static_cast<uint64_t>((v >= lower) & (v <= upper)) << (i - base);
+            }
+            words[base / Bitmap::BITS_PER_WORD] = word;
+        }
+        return selected;
+    }
+
+} // namespace db::types
@@ -0,0 +1,39 @@
+// src/core/types/kernels/DateKernels.hpp
+#ifndef DATE_KERNELS_HPP
+#define DATE_KERNELS_HPP
+
+#include "../DateType.hpp"
+#include "../values/DateValue.hpp"
+#include "../util/Bitmap.hpp"
+#include <cstdint>
+#include <span>
+
+namespace db::types {
+
+    // Conversión y filtrado de columnas DATE sobre la representación compacta.
+    // Ningún kernel construye objetos de std::chrono ni lanza por fila.
+    class DateKernels {
+    public:
+        DateKernels() = delete;
+
+        // Marca las filas cuyos campos no forman una fecha válida; devuelve cuántas son
+        static size_t findInvalid(const DateFieldColumns<const int>& fields, std::span<uint64_t> invalid) noexcept;
+
+        // Sin validación por fila: las filas inválidas se normalizan aritméticamente
+        static void fromFields(const DateFieldColumns<const int>& fields, std::span<DateValue> out) noexcept;
+        static void toFields(std::span<const DateValue> values, const DateFieldColumns<int>& out) noexcept;
+
+        // Codificación de DateValue::ENCODED_SIZE bytes por fila, contigua en `out`.
+        // Se valida todo el lote antes de escribir: lanza si algún valor no es una DATE
+        // válida o `out` es corto, sin comprobaciones dentro del bucle de codificación.
+        static void encode(std::span<const DateValue> values, std::span<uint8_t> out);
+        // Lanza si algún registro no es una codificación canónica
+        static void decode(std::span<const uint8_t> bytes, std::span<DateValue> out);
+
+        // low <= v <= high como comparación de enteros
+        [[nodiscard]] static Bitmap selectBetween(std::span<const DateValue> values, DateValue low, DateValue high);
+    };
+
+} // namespace db::types
+
+#endif // DATE_KERNELS_HPP
@@ -0,0 +1,783 @@
+// src/core/types/kernels/DateTimeFormat.cpp
+#include "DateTimeFormat.hpp"
+#include "../util/Bitmap.hpp"
+#include "../util/DigitWriter.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace db::types {
+
+    namespace {
+        constexpr std::string_view MONTH_NAMES[] = {
+            "JANUARY", "FEBRUARY", "MARCH", "APRIL", "MAY", "JUNE",
+            "JULY", "AUGUST", "SEPTEMBER", "OCTOBER", "NOVEMBER", "DECEMBER"
+        };
+        constexpr std::string_view DAY_NAMES[] = {
+            "MONDAY", "TUESDAY", "WEDNESDAY", "THURSDAY", "FRIDAY", "SATURDAY", "SUNDAY"
+        };
+        constexpr size_t NAME_WIDTH = 9;  // SEPTEMBER y WEDNESDAY
+        constexpr std::string_view LITERAL_CHARACTERS = "-/,.;: ";
+
+        bool startsWith(std::string_view text, std::string_view keyword) noexcept {
+            if (text.size() < keyword.size()) {
+                return false;
+            }
+            for (size_t i = 0; i < keyword.size(); ++i) {
+                if (std::toupper(static_cast<unsigned char>(text[i])) != keyword[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Los nombres están en mayúsculas; se pasa a minúsculas la primera letra y/o el resto
+        char* writeName(char* out, std::string_view name, size_t length, bool lowerFirst, bool lowerRest) noexcept {
+            for (size_t i = 0; i < length; ++i) {
+                const bool lower = i == 0 ? lowerFirst : lowerRest;
+                out[i] = lower ? static_cast<char>(std::tolower(static_cast<unsigned char>(name[i]))) : name[i];
+            }
+            return out + length;
+        }
+
+        bool isDigit(char c) noexcept {
+            return c >= '0' && c <= '9';
+        }
+
+        // Lee entre 1 y maxDigits dígitos; deja `digits` con cuántos leyó
+        bool readNumber(std::string_view text, size_t& pos, size_t maxDigits, int& value, size_t& digits) noexcept {
+            value = 0;
+            digits = 0;
+            while (digits < maxDigits && pos < text.size() && isDigit(text[pos])) {
+                value = value * 10 + (text[pos++] - '0');
+                ++digits;
+            }
+            return digits > 0;
+        }
+
+        bool readNumber(std::string_view text, size_t& pos, size_t maxDigits, int& value) noexcept {
+            size_t digits;
+            return readNumber(text, pos, maxDigits, value, digits);
+        }
+
+        // Compara sin distinguir mayúsculas con los `length` primeros caracteres de name
+        bool readName(std::string_view text, size_t& pos, std::string_view name, size_t length) noexcept {
+            if (text.size() - pos < length) {
+                return false;
+            }
+            for (size_t i = 0; i < length; ++i) {
+                if (std::toupper(static_cast<unsigned char>(text[pos + i])) != name[i]) {
+                    return false;
+                }
+            }
+            pos += length;
+            return true;
+        }
+
+        // Índice del nombre leído o -1
+        template<size_t N>
+        int readNameOf(std::string_view text, size_t& pos, const std::string_view (&names)[N],
+                       bool abbreviated, bool padded) noexcept {
+            for (size_t i = 0; i < N; ++i) {
+                const size_t length = abbreviated ? 3 : names[i].size();
+                if (readName(text, pos, names[i], length)) {
+                    // TO_CHAR rellena los nombres completos hasta NAME_WIDTH salvo con FM
+                    for (size_t written = length; padded && written < NAME_WIDTH
+                                                  && pos < text.size() && text[pos] == ' '; ++written) {
+                        ++pos;
+                    }
+                    return static_cast<int>(i);
+                }
+            }
+            return -1;
+        }
+
+        int twoDigits(const char* text) noexcept {
+            return (text[0] - '0') * 10 + (text[1] - '0');
+        }
+
+        bool areDigits(const char* text, size_t count) noexcept {
+            bool all = true;
+            for (size_t i = 0; i < count; ++i) {
+                all &= isDigit(text[i]);
+            }
+            return all;
+        }
+
+        char* pad(char* out, size_t written, size_t width) noexcept {
+            for (; written < width; ++written) {
+                *out++ = ' ';
+            }
+            return out;
+        }
+    } // namespace
+
+    DateTimeFormat DateTimeFormat::compile(std::string_view mask) {
+        struct Keyword {
+            std::string_view text;
+            Element element;
+            size_t width;
+        };
+        // Los prefijos más largos primero: MONTH antes que MON, DDD antes que DD...
+        static constexpr Keyword KEYWORDS[] = {
+            {"SYYYY", Element::SIGNED_YEAR, 5}, {"YYYY", Element::YEAR, 4}, {"YY", Element::SHORT_YEAR, 2},
+            {"MONTH", Element::MONTH_NAME, NAME_WIDTH}, {"MON", Element::MONTH_ABBREVIATION, 3},
+            {"MM", Element::MONTH, 2}, {"MI", Element::MINUTE, 2},
+            {"DDD", Element::DAY_OF_YEAR, 3}, {"DAY", Element::DAY_NAME, NAME_WIDTH},
+            {"DD", Element::DAY, 2}, {"DY", Element::DAY_ABBREVIATION, 3},
+            {"HH24", Element::HOUR24, 2}, {"HH12", Element::HOUR12, 2}, {"HH", Element::HOUR12, 2},
+            {"SS", Element::SECOND, 2},
+            {"AM", Element::MERIDIAN, 2}, {"PM", Element::MERIDIAN, 2},
+            {"BC", Element::ERA, 2}, {"AD", Element::ERA, 2},
+            {"TZH", Element::TZ_HOUR, 3}, {"TZM", Element::TZ_MINUTE, 2},
+            {"TZR", Element::TZ_REGION, TimeZone::MAX_NAME_LENGTH}
+        };
+
+        DateTimeFormat format;
+        bool fillMode = false;
+        size_t i = 0;
+        while (i < mask.size()) {
+            const std::string_view rest = mask.substr(i);
+            if (rest[0] == '"') {
+                const size_t close = rest.find('"', 1);
+                if (close == std::string_view::npos) {
+                    throw DataTypeException("Unterminated quoted text in format model");
+                }
+                format.appendLiteral(rest.substr(1, close - 1));
+                i += close + 1;
+                continue;
+            }
+            if (LITERAL_CHARACTERS.find(rest[0]) != std::string_view::npos) {
+                format.appendLiteral(rest.substr(0, 1));
+                ++i;
+                continue;
+            }
+            if (startsWith(rest, "FM")) {
+                fillMode = !fillMode;
+                i += 2;
+                continue;
+            }
+
+            // Mayúsculas de la máscara: MON, Mon o mon
+            LetterCase letterCase = LetterCase::UPPER;
+            if (std::islower(static_cast<unsigned char>(rest[0]))) {
+                letterCase = LetterCase::LOWER;
+            } else if (rest.size() > 1 && std::islower(static_cast<unsigned char>(rest[1]))) {
+                letterCase = LetterCase::CAPITALIZED;
+            }
+
+            if (startsWith(rest, "FF")) {
+                uint8_t digits = TimestampType::MAX_PRECISION;
+                size_t length = 2;
+                if (rest.size() > 2 && rest[2] >= '1' && rest[2] <= '9') {
+                    digits = static_cast<uint8_t>(rest[2] - '0');
+                    ++length;
+                }
+                format.append(Element::FRACTION, letterCase, fillMode, digits, digits);
+                i += length;
+                continue;
+            }
+
+            bool matched = false;
+            for (const auto& keyword : KEYWORDS) {
+                if (startsWith(rest, keyword.text)) {
+                    format.append(keyword.element, letterCase, fillMode, 0, keyword.width);
+                    i += keyword.text.size();
+                    matched = true;
+                    break;
+                }
+            }
+            if (!matched) {
+                throw DataTypeException("Invalid format model element at position " + std::to_string(i));
+            }
+        }
+        format.detectIsoLayout();
+        return format;
+    }
+
+    void DateTimeFormat::append(Element element, LetterCase letterCase, bool fillMode, uint8_t digits, size_t width) {
+        program.push_back({element, letterCase, fillMode, digits, 0, 0});
+        maxLength_ += width;
+    }
+
+    void DateTimeFormat::appendLiteral(std::string_view text) {
+        if (text.empty()) {
+            return;
+        }
+        if (literals.size() + text.size() > std::numeric_limits<uint16_t>::max()) {
+            throw DataTypeException("Format model is too long");
+        }
+        // Literales consecutivos se copian con un único memcpy
+        if (!program.empty() && program.back().element == Element::LITERAL) {
+            program.back().length = static_cast<uint16_t>(program.back().length + text.size());
+        } else {
+            program.push_back({Element::LITERAL, LetterCase::UPPER, false, 0,
+                               static_cast<uint16_t>(literals.size()), static_cast<uint16_t>(text.size())});
+        }
+        literals.append(text);
+        maxLength_ += text.size();
+    }
+
+    DateTimeFormat::Parts DateTimeFormat::split(int64_t localSeconds, int32_t nanos, int offsetMinutes,
+                                                uint16_t zoneId) noexcept {
+        const int64_t days = floorDiv(localSeconds, SECONDS_PER_DAY);
+        const CivilDate date = civilFromDays(days);
+        return {days, date.year, date.month, date.day,
+                static_cast<int>(localSeconds - days * SECONDS_PER_DAY), nanos, offsetMinutes, zoneId};
+    }
+
+    DateTimeFormat::Parts DateTimeFormat::partsOf(const DateValue& value) noexcept {
+        return split(value.getEpochSeconds(), 0, 0, TimeZone::FIXED_OFFSET_ID);
+    }
+
+    DateTimeFormat::Parts DateTimeFormat::partsOf(const TimestampValue& value) noexcept {
+        return split(value.getUtcSeconds() + value.getOffsetMinutes() * int64_t{60},
+                     value.getNanos(), value.getOffsetMinutes(), value.getZoneId());
+    }
+
+    size_t DateTimeFormat::run(const Parts& parts, char* out) const {
+        if (parts.year < -DateType::MAX_YEAR || parts.year > DateType::MAX_YEAR) {
+            throw DataTypeException("Date out of range");
+        }
+        char* const start = out;
+        const auto absYear = static_cast<uint32_t>(parts.year < 0 ? -parts.year : parts.year);
+        const int hour = parts.secondOfDay / 3600;
+        const int absOffset = parts.offsetMinutes < 0 ? -parts.offsetMinutes : parts.offsetMinutes;
+
+        for (const Instruction& ins : program) {
+            const size_t width = ins.fillMode ? 1 : 2;
+            const bool lowerFirst = ins.letterCase == LetterCase::LOWER;
+            const bool lowerRest = ins.letterCase != LetterCase::UPPER;
+            switch (ins.element) {
+                case Element::LITERAL:
+                    std::memcpy(out, literals.data() + ins.offset, ins.length);
+                    out += ins.length;
+                    break;
+                case Element::YEAR:
+                    out = writeDigits(out, absYear, ins.fillMode ? 1 : 4);
+                    break;
+                case Element::SIGNED_YEAR:
+                    if (parts.year < 0 || !ins.fillMode) {
+                        *out++ = parts.year < 0 ? '-' : ' ';
+                    }
+                    out = writeDigits(out, absYear, ins.fillMode ? 1 : 4);
+                    break;
+                case Element::SHORT_YEAR:
+                    out = writeDigits(out, absYear % 100, width);
+                    break;
+                case Element::MONTH:
+                    out = writeDigits(out, static_cast<uint64_t>(parts.month), width);
+                    break;
+                case Element::MONTH_ABBREVIATION:
+                    out = writeName(out, MONTH_NAMES[parts.month - 1], 3, lowerFirst, lowerRest);
+                    break;
+                case Element::MONTH_NAME: {
+                    const std::string_view name = MONTH_NAMES[parts.month - 1];
+                    out = writeName(out, name, name.size(), lowerFirst, lowerRest);
+                    out = ins.fillMode ? out : pad(out, name.size(), NAME_WIDTH);
+                    break;
+                }
+                case Element::DAY:
+                    out = writeDigits(out, static_cast<uint64_t>(parts.day), width);
+                    break;
+                case Element::DAY_OF_YEAR:
+                    out = writeDigits(out, static_cast<uint64_t>(parts.days - daysFromCivil(parts.year, 1, 1) + 1),
+                                      ins.fillMode ? 1 : 3);
+                    break;
+                case Element::DAY_ABBREVIATION:
+                case Element::DAY_NAME: {
+                    // 1970-01-01 fue jueves; 0 es lunes
+                    const std::string_view name = DAY_NAMES[floorMod(parts.days + 3, 7)];
+                    if (ins.element == Element::DAY_ABBREVIATION) {
+                        out = writeName(out, name, 3, lowerFirst, lowerRest);
+                    } else {
+                        out = writeName(out, name, name.size(), lowerFirst, lowerRest);
+                        out = ins.fillMode ? out : pad(out, name.size(), NAME_WIDTH);
+                    }
+                    break;
+                }
+                case Element::HOUR12:
+                    out = writeDigits(out, static_cast<uint64_t>((hour + 11) % 12 + 1), width);
+                    break;
+                case Element::HOUR24:
+                    out = writeDigits(out, static_cast<uint64_t>(hour), width);
+                    break;
+                case Element::MINUTE:
+                    out = writeDigits(out, static_cast<uint64_t>(parts.secondOfDay / 60 % 60), width);
+                    break;
+                case Element::SECOND:
+                    out = writeDigits(out, static_cast<uint64_t>(parts.secondOfDay % 60), width);
+                    break;
+                case Element::FRACTION:
+                    out = writeDigits(out, static_cast<uint64_t>(parts.nanos) /
+                                      static_cast<uint64_t>(POW10_I64[TimestampType::MAX_PRECISION - ins.digits]),
+                                      ins.digits);
+                    break;
+                case Element::MERIDIAN:
+                    out = writeName(out, hour < 12 ? "AM" : "PM", 2, lowerFirst, lowerRest);
+                    break;
+                case Element::ERA:
+                    out = writeName(out, parts.year < 0 ? "BC" : "AD", 2, lowerFirst, lowerRest);
+                    break;
+                case Element::TZ_HOUR:
+                    *out++ = parts.offsetMinutes < 0 ? '-' : '+';
+                    out = writeTwoDigits(out, static_cast<uint32_t>(absOffset / 60));
+                    break;
+                case Element::TZ_MINUTE:
+                    out = writeTwoDigits(out, static_cast<uint32_t>(absOffset % 60));
+                    break;
+                case Element::TZ_REGION:
+                    if (const TimeZone* zone = TimeZone::byId(parts.zoneId)) {
+                        std::memcpy(out, zone->getName().data(), zone->getName().size());
+                        out += zone->getName().size();
+                    } else {
+                        *out++ = parts.offsetMinutes < 0 ? '-' : '+';
+                        out = writeTwoDigits(out, static_cast<uint32_t>(absOffset / 60));
+                        *out++ = ':';
+                        out = writeTwoDigits(out, static_cast<uint32_t>(absOffset % 60));
+                    }
+                    break;
+            }
+        }
+        return static_cast<size_t>(out - start);
+    }
+
+    void DateTimeFormat::checkBuffer(size_t available, size_t count) const {
+        if (count > std::numeric_limits<uint32_t>::max() / std::max<size_t>(maxLength_, 1)) {
+            throw DataTypeException("Batch too large for 32-bit offsets");
+        }
+        if (available < count * maxLength_) {
+            throw DataTypeException("Output buffer is smaller than the format model requires");
+        }
+    }
+
+    size_t DateTimeFormat::format(const DateValue& value, std::span<char> out) const {
+        checkBuffer(out.size(), 1);
+        return run(partsOf(value), out.data());
+    }
+
+    size_t DateTimeFormat::format(const TimestampValue& value, std::span<char> out) const {
+        checkBuffer(out.size(), 1);
+        return run(partsOf(value), out.data());
+    }
+
+    std::string DateTimeFormat::format(const DateValue& value) const {
+        std::string result(maxLength_, '\0');
+        result.resize(run(partsOf(value), result.data()));
+        return result;
+    }
+
+    std::string DateTimeFormat::format(const TimestampValue& value) const {
+        std::string result(maxLength_, '\0');
+        result.resize(run(partsOf(value), result.data()));
+        return result;
+    }
+
+    struct DateTimeFormat::Parsed {
+        int year = 1970;
+        int month = 1;
+        int day = 1;
+        int hour = 0;
+        int minute = 0;
+        int second = 0;
+        int32_t nanos = 0;
+        int dayOfYear = 0;
+        int tzHour = 0;
+        int tzMinute = 0;
+        bool tzNegative = false;
+        bool hour12 = false;
+        bool pm = false;
+        bool beforeChrist = false;
+        const TimeZone* region = nullptr;
+    };
+
+    void DateTimeFormat::detectIsoLayout() noexcept {
+        size_t i = 0;
+        const auto element = [&](Element expected) {
+            return i < program.size() && program[i].element == expected ? (++i, true) : false;
+        };
+        const auto literal = [&](std::string_view expected) {
+            if (i < program.size() && program[i].element == Element::LITERAL
+                && std::string_view(literals).substr(program[i].offset, program[i].length) == expected) {
+                ++i;
+                return true;
+            }
+            return false;
+        };
+
+        IsoLayout layout;
+        if (!(element(Element::YEAR) && literal("-") && element(Element::MONTH) && literal("-")
+              && element(Element::DAY))) {
+            return;
+        }
+        if (literal(" ")) {
+            layout.separator = ' ';
+        } else if (literal("T")) {
+            layout.separator = 'T';
+        } else {
+            return;
+        }
+        if (!(element(Element::HOUR24) && literal(":") && element(Element::MINUTE) && literal(":")
+              && element(Element::SECOND))) {
+            return;
+        }
+        if (literal(".")) {
+            if (i >= program.size() || program[i].element != Element::FRACTION) {
+                return;
+            }
+            layout.fractionDigits = program[i++].digits;
+        }
+        layout.offset = literal(" ") ? 2 : 1;
+        if (element(Element::TZ_HOUR)) {
+            if (!(literal(":") && element(Element::TZ_MINUTE))) {
+                return;
+            }
+        } else if (layout.offset == 2) {
+            return;
+        } else {
+            layout.offset = 0;
+        }
+        layout.enabled = i == program.size();
+        iso = layout;
+    }
+
+    bool DateTimeFormat::parseIso(std::string_view text, const IsoLayout& layout, Parsed& parsed) noexcept {
+        constexpr size_t BASE_LENGTH = 19;  // YYYY-MM-DDTHH:MI:SS
+        if (text.size() < BASE_LENGTH) {
+            return false;
+        }
+        const char* data = text.data();
+
+#if defined(__SSE2__)
+        // Los 16 primeros bytes se validan y convierten en un solo registro: dígitos
+        // y separadores se comprueban con dos comparaciones y los pares de dígitos se
+        // combinan con multiplicaciones-suma de 16 bits.
+        constexpr int DIGIT_POSITIONS = 0xDB6F;      // 0-3, 5-6, 8-9, 11-12, 14-15
+        constexpr int SEPARATOR_POSITIONS = 0x2490;  // 4, 7, 10, 13
+        const __m128i raw = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        const __m128i digits = _mm_sub_epi8(raw, _mm_set1_epi8('0'));
+        const __m128i digitMask = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+        const __m128i separators = _mm_setr_epi8(0, 0, 0, 0, '-', 0, 0, '-', 0, 0, layout.separator, 0, 0, ':', 0, 0);
+        const __m128i separatorMask = _mm_cmpeq_epi8(raw, separators);
+        if ((_mm_movemask_epi8(digitMask) & DIGIT_POSITIONS) != DIGIT_POSITIONS
+            || (_mm_movemask_epi8(separatorMask) & SEPARATOR_POSITIONS) != SEPARATOR_POSITIONS) {
+            return false;
+        }
+
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i low = _mm_madd_epi16(_mm_unpacklo_epi8(digits, zero),
+                                           _mm_setr_epi16(1000, 100, 10, 1, 0, 10, 1, 0));
+        const __m128i high = _mm_madd_epi16(_mm_unpackhi_epi8(digits, zero),
+                                            _mm_setr_epi16(10, 1, 0, 10, 1, 0, 10, 1));
+        alignas(16) int32_t dateSums[4];
+        alignas(16) int32_t timeSums[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(dateSums), low);
+        _mm_store_si128(reinterpret_cast<__m128i*>(timeSums), high);
+        parsed.year = dateSums[0] + dateSums[1];
+        parsed.month = dateSums[2] + dateSums[3];
+        parsed.day = timeSums[0];
+        parsed.hour = timeSums[1] + timeSums[2];
+        parsed.minute = timeSums[3];
+#else
+        if (!(areDigits(data, 4) && data[4] == '-' && areDigits(data + 5, 2) && data[7] == '-'
+              && areDigits(data + 8, 2) && data[10] == layout.separator && areDigits(data + 11, 2)
+              && data[13] == ':' && areDigits(data + 14, 2))) {
+            return false;
+        }
+        parsed.year = twoDigits(data) * 100 + twoDigits(data + 2);
+        parsed.month = twoDigits(data + 5);
+        parsed.day = twoDigits(data + 8);
+        parsed.hour = twoDigits(data + 11);
+        parsed.minute = twoDigits(data + 14);
+#endif
+        if (data[16] != ':' || !areDigits(data + 17, 2)) {
+            return false;
+        }
+        parsed.second = twoDigits(data + 17);
+
+        size_t pos = BASE_LENGTH;
+        if (layout.fractionDigits > 0) {
+            if (pos >= text.size() || text[pos] != '.') {
+                return false;
+            }
+            ++pos;
+            int fraction;
+            size_t count;
+            if (!readNumber(text, pos, layout.fractionDigits, fraction, count)) {
+                return false;
+            }
+            parsed.nanos = static_cast<int32_t>(fraction * POW10_I64[TimestampType::MAX_PRECISION - count]);
+        }
+        if (layout.offset == 2) {
+            if (pos >= text.size() || text[pos] != ' ') {
+                return false;
+            }
+            ++pos;
+        }
+        if (layout.offset > 0) {
+            if (text.size() - pos != 6 || (text[pos] != '+' && text[pos] != '-')
+                || !areDigits(data + pos + 1, 2) || text[pos + 3] != ':' || !areDigits(data + pos + 4, 2)) {
+                return false;
+            }
+            parsed.tzNegative = text[pos] == '-';
+            parsed.tzHour = twoDigits(data + pos + 1);
+            parsed.tzMinute = twoDigits(data + pos + 4);
+            pos += 6;
+        }
+        return pos == text.size();
+    }
+
+    bool DateTimeFormat::parseGeneral(std::string_view text, Parsed& parsed, size_t& pos) const noexcept {
+        pos = 0;
+        for (const Instruction& ins : program) {
+            bool ok = true;
+            switch (ins.element) {
+                case Element::LITERAL:
+                    ok = std::string_view(literals).substr(ins.offset, ins.length) == text.substr(pos, ins.length);
+                    pos += ok ? ins.length : 0;
+                    break;
+                case Element::SIGNED_YEAR:
+                    if (pos < text.size() && (text[pos] == '-' || text[pos] == '+' || text[pos] == ' ')) {
+                        parsed.beforeChrist = text[pos++] == '-';
+                    }
+                    ok = readNumber(text, pos, 4, parsed.year);
+                    break;
+                case Element::YEAR:
+                    ok = readNumber(text, pos, 4, parsed.year);
+                    break;
+                case Element::SHORT_YEAR:
+                    ok = readNumber(text, pos, 2, parsed.year);
+                    parsed.year += 2000;
+                    break;
+                case Element::MONTH:
+                    ok = readNumber(text, pos, 2, parsed.month);
+                    break;
+                case Element::MONTH_ABBREVIATION:
+                case Element::MONTH_NAME: {
+                    const int month = readNameOf(text, pos, MONTH_NAMES, ins.element == Element::MONTH_ABBREVIATION,
+                                                 !ins.fillMode);
+                    ok = month >= 0;
+                    parsed.month = month + 1;
+                    break;
+                }
+                case Element::DAY:
+                    ok = readNumber(text, pos, 2, parsed.day);
+                    break;
+                case Element::DAY_OF_YEAR:
+                    ok = readNumber(text, pos, 3, parsed.dayOfYear) && parsed.dayOfYear > 0;
+                    break;
+                case Element::DAY_ABBREVIATION:
+                case Element::DAY_NAME:
+                    // El día de la semana se deduce de la fecha; solo se valida el nombre
+                    ok = readNameOf(text, pos, DAY_NAMES, ins.element == Element::DAY_ABBREVIATION,
+                                    !ins.fillMode) >= 0;
+                    break;
+                case Element::HOUR12:
+                    ok = readNumber(text, pos, 2, parsed.hour);
+                    parsed.hour12 = true;
+                    break;
+                case Element::HOUR24:
+                    ok = readNumber(text, pos, 2, parsed.hour);
+                    break;
+                case Element::MINUTE:
+                    ok = readNumber(text, pos, 2, parsed.minute);
+                    break;
+                case Element::SECOND:
+                    ok = readNumber(text, pos, 2, parsed.second);
+                    break;
+                case Element::FRACTION: {
+                    int fraction;
+                    size_t count;
+                    ok = readNumber(text, pos, ins.digits, fraction, count);
+                    parsed.nanos = ok ? static_cast<int32_t>(fraction * POW10_I64[TimestampType::MAX_PRECISION - count])
+                                      : 0;
+                    break;
+                }
+                case Element::MERIDIAN:
+                    if (readName(text, pos, "AM", 2)) {
+                        parsed.pm = false;
+                    } else {
+                        ok = readName(text, pos, "PM", 2);
+                        parsed.pm = true;
+                    }
+                    break;
+                case Element::ERA:
+                    if (readName(text, pos, "BC", 2)) {
+                        parsed.beforeChrist = true;
+                    } else {
+                        ok = readName(text, pos, "AD", 2);
+                    }
+                    break;
+                case Element::TZ_HOUR:
+                    ok = pos < text.size() && (text[pos] == '+' || text[pos] == '-');
+                    if (ok) {
+                        parsed.tzNegative = text[pos++] == '-';
+                        ok = readNumber(text, pos, 2, parsed.tzHour);
+                    }
+                    break;
+                case Element::TZ_MINUTE:
+                    ok = readNumber(text, pos, 2, parsed.tzMinute);
+                    break;
+                case Element::TZ_REGION:
+                    if (pos < text.size() && (text[pos] == '+' || text[pos] == '-')) {
+                        parsed.tzNegative = text[pos++] == '-';
+                        ok = readNumber(text, pos, 2, parsed.tzHour) && pos < text.size() && text[pos++] == ':'
+                             && readNumber(text, pos, 2, parsed.tzMinute);
+                    } else {
+                        const size_t start = pos;
+                        while (pos < text.size() && (std::isalpha(static_cast<unsigned char>(text[pos]))
+                                                     || text[pos] == '/' || text[pos] == '_')) {
+                            ++pos;
+                        }
+                        parsed.region = TimeZone::find(text.substr(start, pos - start));
+                        ok = parsed.region != nullptr;
+                    }
+                    break;
+            }
+            if (!ok) {
+                return false;
+            }
+        }
+        return pos == text.size();
+    }
+
+    bool DateTimeFormat::parseFields(std::string_view text, Parsed& parsed, size_t& errorPosition) const noexcept {
+        if (iso.enabled && parseIso(text, iso, parsed)) {
+            return true;
+        }
+        parsed = Parsed{};
+        return parseGeneral(text, parsed, errorPosition);
+    }
+
+    // Aplica AM/PM, BC y DDD y valida el resultado
+    bool DateTimeFormat::resolve(Parsed& parsed) noexcept {
+        if (parsed.hour12) {
+            if (parsed.hour < 1 || parsed.hour > 12) {
+                return false;
+            }
+            parsed.hour = parsed.hour % 12 + (parsed.pm ? 12 : 0);
+        }
+        if (parsed.beforeChrist) {
+            parsed.year = -parsed.year;
+        }
+        if (parsed.dayOfYear > 0) {
+            if (parsed.dayOfYear > (isLeapYear(parsed.year) ? 366 : 365)) {
+                return false;
+            }
+            const CivilDate date = civilFromDays(daysFromCivil(parsed.year, 1, 1) + parsed.dayOfYear - 1);
+            parsed.month = date.month;
+            parsed.day = date.day;
+        }
+        return DateType::isValidFields(parsed.year, parsed.month, parsed.day,
+                                       parsed.hour, parsed.minute, parsed.second)
+               && parsed.tzHour <= 14 && parsed.tzMinute <= 59
+               && parsed.tzHour * 60 + parsed.tzMinute <= 14 * 60;
+    }
+
+    void DateTimeFormat::checkDateElements() const {
+        for (const Instruction& ins : program) {
+            if (ins.element == Element::FRACTION || ins.element == Element::TZ_HOUR
+                || ins.element == Element::TZ_MINUTE || ins.element == Element::TZ_REGION) {
+                throw DataTypeException("Format model element not valid for DATE");
+            }
+        }
+    }
+
+    DateTimeFormat::Parsed DateTimeFormat::parseOrThrow(std::string_view text, const char* invalidMessage) const {
+        Parsed parsed;
+        size_t errorPosition = 0;
+        if (!parseFields(text, parsed, errorPosition)) {
+            throw DataTypeException("Value does not match format model at position " + std::to_string(errorPosition));
+        }
+        if (!resolve(parsed)) {
+            throw DataTypeException(invalidMessage);
+        }
+        return parsed;
+    }
+
+    template<typename Value>
+    Value DateTimeFormat::toValue(const Parsed& p) noexcept {
+        if constexpr (std::is_same_v<Value, DateValue>) {
+            return DateValue::fromCivil(p.year, p.month, p.day, p.hour, p.minute, p.second);
+        } else if (p.region != nullptr) {
+            return TimestampValue::fromLocal(*p.region, p.year, p.month, p.day, p.hour, p.minute, p.second, p.nanos);
+        } else {
+            const int offset = (p.tzNegative ? -1 : 1) * (p.tzHour * 60 + p.tzMinute);
+            return TimestampValue::fromCivil(p.year, p.month, p.day, p.hour, p.minute, p.second, p.nanos, offset);
+        }
+    }
+
+    DateValue DateTimeFormat::parseDate(std::string_view text) const {
+        checkDateElements();
+        return toValue<DateValue>(parseOrThrow(text, "Invalid date"));
+    }
+
+    TimestampValue DateTimeFormat::parseTimestamp(std::string_view text) const {
+        return toValue<TimestampValue>(parseOrThrow(text, "Invalid timestamp"));
+    }
+
+    template<typename Value>
+    size_t DateTimeFormat::parseRows(std::span<const std::string_view> texts, std::span<Value> out,
+                                     std::span<uint64_t> failed) const {
+        if (out.size() < texts.size() || failed.size() < Bitmap::wordsFor(texts.size())) {
+            throw DataTypeException("Output span is smaller than input");
+        }
+        std::fill_n(failed.begin(), Bitmap::wordsFor(texts.size()), uint64_t{0});
+        size_t failures = 0;
+        for (size_t i = 0; i < texts.size(); ++i) {
+            Parsed parsed;
+            size_t errorPosition;
+            if (parseFields(texts[i], parsed, errorPosition) && resolve(parsed)) {
+                out[i] = toValue<Value>(parsed);
+            } else {
+                out[i] = Value{};
+                failed[i / Bitmap::BITS_PER_WORD] |= uint64_t{1} << (i % Bitmap::BITS_PER_WORD);
+                ++failures;
+            }
+        }
+        return failures;
+    }
+
+    size_t DateTimeFormat::parseBatch(std::span<const std::string_view> texts, std::span<DateValue> out,
+                                      std::span<uint64_t> failed) const {
+        checkDateElements();
+        return parseRows(texts, out, failed);
+    }
+
+    size_t DateTimeFormat::parseBatch(std::span<const std::string_view> texts, std::span<TimestampValue> out,
+                                      std::span<uint64_t> failed) const {
+        return parseRows(texts, out, failed);
+    }
+
+    template<typename Value>
+    size_t DateTimeFormat::formatRows(std::span<const Value> values, std::span<char> out,
+                                      std::span<uint32_t> ends) const {
+        checkBuffer(out.size(), values.size());
+        if (ends.size() < values.size()) {
+            throw DataTypeException("Output span is smaller than input");
+        }
+        size_t position = 0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            position += run(partsOf(values[i]), out.data() + position);
+            ends[i] = static_cast<uint32_t>(position);
+        }
+        return position;
+    }
+
+    size_t DateTimeFormat::formatBatch(std::span<const DateValue> values, std::span<char> out,
+                                       std::span<uint32_t> ends) const {
+        return formatRows(values, out, ends);
+    }
+
+    size_t DateTimeFormat::formatBatch(std::span<const TimestampValue> values, std::span<char> out,
+                                       std::span<uint32_t> ends) const {
+        return formatRows(values, out, ends);
+    }
+
+} // namespace db::types
@@ -0,0 +1,139 @@
+// src/core/types/kernels/DateTimeFormat.hpp
+#ifndef DATE_TIME_FORMAT_HPP
+#define DATE_TIME_FORMAT_HPP
+
+#include "../values/DateValue.hpp"
+#include "../values/TimestampValue.hpp"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace db::types {
+
+    // Máscara de formato estilo TO_CHAR/TO_DATE de Oracle compilada una vez a una
+    // lista de instrucciones. Formatear recorre esa lista y escribe directamente en
+    // el buffer del llamante, sin std::format ni cadenas temporales; parsear la
+    // recorre leyendo campos del texto.
+    //
+    // Elementos: YYYY, SYYYY, YY, MM, MON, MONTH, DD, DDD, DY, DAY, HH, HH12, HH24,
+    // MI, SS, FF y FF1..FF9, AM/PM, BC/AD, TZH, TZM, TZR (región o
+    // desplazamiento ±HH:MM) y FM. Los nombres siguen las
+    // mayúsculas de la máscara (MON, Mon, mon). Se copian tal cual los signos
+    // - / , . ; : y el espacio, y el texto entre comillas dobles.
+    class DateTimeFormat {
+    public:
+        // Lanza DataTypeException si la máscara contiene un elemento desconocido
+        static DateTimeFormat compile(std::string_view mask);
+
+        // Cota superior de bytes por valor; los buffers deben tener al menos este tamaño
+        [[nodiscard]] size_t maxLength() const noexcept { return maxLength_; }
+
+        // Devuelven los bytes escritos. Lanzan si `out` es más corto que maxLength()
+        // o si el año no está en el rango de DATE.
+        size_t format(const DateValue& value, std::span<char> out) const;
+        size_t format(const TimestampValue& value, std::span<char> out) const;
+        [[nodiscard]] std::string format(const DateValue& value) const;
+        [[nodiscard]] std::string format(const TimestampValue& value) const;
+
+        // Escribe los valores uno tras otro en `out`; ends[i] es el final del valor i.
+        // Requiere out.size() >= values.size() * maxLength(). Devuelve el total escrito.
+        size_t formatBatch(std::span<const DateValue> values, std::span<char> out,
+                           std::span<uint32_t> ends) const;
+        size_t formatBatch(std::span<const TimestampValue> values, std::span<char> out,
+                           std::span<uint32_t> ends) const;
+
+        // TO_DATE/TO_TIMESTAMP. Los números aceptan menos dígitos que su anchura, los
+        // nombres no distinguen mayúsculas y los literales deben coincidir. Los campos
+        // de fecha ausentes toman 1970-01-01 y los de hora 0; YY se lee como 20YY.
+        // Lanzan DataTypeException si el texto no encaja o la fecha no existe.
+        // Las máscaras YYYY-MM-DD HH24:MI:SS (con "T" o espacio), seguidas o no de
+        // .FFn y TZH:TZM, se intentan primero con un parser de anchura fija en SSE2.
+        [[nodiscard]] DateValue parseDate(std::string_view text) const;
+        [[nodiscard]] TimestampValue parseTimestamp(std::string_view text) const;
+
+        // Sin lanzar por fila: las filas que no encajan se marcan en `failed` y se
+        // dejan a cero en `out`. Devuelve cuántas fallaron.
+        size_t parseBatch(std::span<const std::string_view> texts, std::span<DateValue> out,
+                          std::span<uint64_t> failed) const;
+        size_t parseBatch(std::span<const std::string_view> texts, std::span<TimestampValue> out,
+                          std::span<uint64_t> failed) const;
+
+    private:
+        enum class Element : uint8_t {
+            LITERAL, YEAR, SIGNED_YEAR, SHORT_YEAR, MONTH, MONTH_ABBREVIATION, MONTH_NAME,
+            DAY, DAY_OF_YEAR, DAY_ABBREVIATION, DAY_NAME, HOUR12, HOUR24, MINUTE, SECOND,
+            FRACTION, MERIDIAN, ERA, TZ_HOUR, TZ_MINUTE, TZ_REGION
+        };
+
+        enum class LetterCase : uint8_t { UPPER, CAPITALIZED, LOWER };
+
+        struct Instruction {
+            Element element;
+            LetterCase letterCase;
+            bool fillMode;       // FM: sin ceros a la izquierda ni relleno de nombres
+            uint8_t digits;      // Dígitos de FRACTION
+            uint16_t offset;     // Texto de LITERAL dentro de `literals`
+            uint16_t length;
+        };
+
+        // Campos de hora local ya separados para una fila
+        struct Parts {
+            int64_t days;
+            int year;
+            int month;
+            int day;
+            int secondOfDay;
+            int32_t nanos;
+            int offsetMinutes;
+            uint16_t zoneId;
+        };
+
+        // Forma de la máscara cuando admite el parser ISO-8601 de anchura fija
+        struct IsoLayout {
+            bool enabled = false;
+            char separator = ' ';
+            uint8_t fractionDigits = 0;  // 0: sin fracción
+            uint8_t offset = 0;          // 0: sin TZH:TZM, 1: pegado, 2: tras un espacio
+        };
+
+        struct Parsed;
+
+        DateTimeFormat() = default;
+
+        void append(Element element, LetterCase letterCase, bool fillMode, uint8_t digits, size_t width);
+        void appendLiteral(std::string_view text);
+        [[nodiscard]] static Parts split(int64_t localSeconds, int32_t nanos, int offsetMinutes,
+                                          uint16_t zoneId) noexcept;
+        [[nodiscard]] static Parts partsOf(const DateValue& value) noexcept;
+        [[nodiscard]] static Parts partsOf(const TimestampValue& value) noexcept;
+        void checkBuffer(size_t available, size_t count) const;
+        size_t run(const Parts& parts, char* out) const;
+
+        void detectIsoLayout() noexcept;
+        [[nodiscard]] bool parseFields(std::string_view text, Parsed& parsed, size_t& errorPosition) const noexcept;
+        [[nodiscard]] bool parseGeneral(std::string_view text, Parsed& parsed, size_t& errorPosition) const noexcept;
+        [[nodiscard]] static bool parseIso(std::string_view text, const IsoLayout& layout, Parsed& parsed) noexcept;
+        [[nodiscard]] static bool resolve(Parsed& parsed) noexcept;
+        void checkDateElements() const;
+        [[nodiscard]] Parsed parseOrThrow(std::string_view text, const char* invalidMessage) const;
+
+        template<typename Value>
+        [[nodiscard]] static Value toValue(const Parsed& parsed) noexcept;
+        template<typename Value>
+        size_t parseRows(std::span<const std::string_view> texts, std::span<Value> out,
+                         std::span<uint64_t> failed) const;
+
+        template<typename Value>
+        size_t formatRows(std::span<const Value> values, std::span<char> out, std::span<uint32_t> ends) const;
+
+        std::vector<Instruction> program;
+        std::string literals;
+        size_t maxLength_ = 0;
+        IsoLayout iso;
+    };
+
+} // namespace db::types
+
+#endif // DATE_TIME_FORMAT_HPP
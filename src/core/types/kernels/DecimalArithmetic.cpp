@@ -0,0 +1,302 @@
+// src/core/types/kernels/DecimalArithmetic.cpp
+#include "DecimalArithmetic.hpp"
+#include "../util/PowersOfTen.hpp"
+#include <algorithm>
+
+namespace db::types {
+
+    namespace {
+        // Entero sin signo de 256 bits para los casos que no caben en 128:
+        // productos de dos valores de 38 dígitos y cambios de escala grandes.
+        struct UInt256 {
+            uint128_t high = 0;
+            uint128_t low = 0;
+        };
+
+        constexpr uint128_t LOW_64_BITS = ~uint64_t{0};
+
+        UInt256 multiplyWide(uint128_t a, uint128_t b) noexcept {
+            const uint128_t a0 = a & LOW_64_BITS, a1 = a >> 64;
+            const uint128_t b0 = b & LOW_64_BITS, b1 = b >> 64;
+            const uint128_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+            const uint128_t middle = (p00 >> 64) + (p01 & LOW_64_BITS) + (p10 & LOW_64_BITS);
+            return {p11 + (p01 >> 64) + (p10 >> 64) + (middle >> 64), (middle << 64) | (p00 & LOW_64_BITS)};
+        }
+
+        // false si el producto no cabe en 256 bits
+        bool multiplyInPlace(UInt256& value, uint128_t factor) noexcept {
+            const UInt256 low = multiplyWide(value.low, factor);
+            const UInt256 high = multiplyWide(value.high, factor);
+            const uint128_t top = low.high + high.low;
+            if (high.high != 0 || top < low.high) {
+                return false;
+            }
+            value = {top, low.low};
+            return true;
+        }
+
+        bool lessThan(const UInt256& a, const UInt256& b) noexcept {
+            return a.high < b.high || (a.high == b.high && a.low < b.low);
+        }
+
+        UInt256 subtract(const UInt256& a, const UInt256& b) noexcept {
+            return {a.high - b.high - (a.low < b.low ? 1 : 0), a.low - b.low};
+        }
+
+        UInt256 add(const UInt256& a, const UInt256& b) noexcept {
+            const uint128_t low = a.low + b.low;
+            return {a.high + b.high + (low < a.low ? 1 : 0), low};
+        }
+
+        UInt256 shiftLeftOne(const UInt256& value, uint128_t bit) noexcept {
+            return {(value.high << 1) | (value.low >> 127), (value.low << 1) | bit};
+        }
+
+        // 10^exponent con exponente hasta 76
+        UInt256 powerOfTen(size_t exponent) noexcept {
+            if (exponent <= MAX_POWER_OF_TEN) {
+                return {0, POW10_U128[exponent]};
+            }
+            return multiplyWide(POW10_U128[MAX_POWER_OF_TEN], POW10_U128[exponent - MAX_POWER_OF_TEN]);
+        }
+
+        // Cociente redondeado (mitad alejándose de cero) por división binaria larga.
+        // Solo se usa en el camino lento, cuando los operandos no caben en 128 bits.
+        UInt256 divideRounded(const UInt256& numerator, const UInt256& denominator) noexcept {
+            UInt256 quotient{};
+            UInt256 remainder{};
+            for (int bit = 255; bit >= 0; --bit) {
+                const uint128_t next = bit >= 128 ? (numerator.high >> (bit - 128)) & 1 : (numerator.low >> bit) & 1;
+                remainder = shiftLeftOne(remainder, next);
+                if (!lessThan(remainder, denominator)) {
+                    remainder = subtract(remainder, denominator);
+                    if (bit >= 128) {
+                        quotient.high |= uint128_t{1} << (bit - 128);
+                    } else {
+                        quotient.low |= uint128_t{1} << bit;
+                    }
+                }
+            }
+            if (!lessThan(shiftLeftOne(remainder, 0), denominator)) {
+                quotient = add(quotient, {0, 1});
+            }
+            return quotient;
+        }
+
+        [[noreturn]] void throwOverflow(const NumberType& result) {
+            throw DataTypeException("Value exceeds precision of " + result.getName());
+        }
+
+        // Comprobación sin saltos de |value| < limit
+        constexpr bool withinLimit(int128_t value, uint128_t limit) noexcept {
+            return static_cast<uint128_t>(value) + (limit - 1) <= 2 * (limit - 1);
+        }
+
+        Decimal128 finish(const UInt256& magnitude, bool negative, const NumberType& result) {
+            if (magnitude.high != 0 || magnitude.low >= POW10_U128[result.getPrecision()]) {
+                throwOverflow(result);
+            }
+            const auto value = static_cast<int128_t>(magnitude.low);
+            return {negative ? -value : value, result.getScale()};
+        }
+
+        // magnitude * 10^-fromScale llevado a la escala del resultado
+        Decimal128 scaleMagnitude(UInt256 magnitude, size_t fromScale, bool negative, const NumberType& result) {
+            const size_t toScale = result.getScale();
+            if (toScale >= fromScale) {
+                const UInt256 factor = powerOfTen(toScale - fromScale);
+                if (factor.high != 0 || !multiplyInPlace(magnitude, factor.low)) {
+                    throwOverflow(result);
+                }
+                return finish(magnitude, negative, result);
+            }
+            // Más allá de 10^76 cualquier magnitud de 256 bits redondea a cero
+            if (fromScale - toScale > 2 * MAX_POWER_OF_TEN) {
+                return {0, toScale};
+            }
+            return finish(divideRounded(magnitude, powerOfTen(fromScale - toScale)), negative, result);
+        }
+
+        Decimal128 combine(const Decimal128& a, const Decimal128& b, bool negateB, const NumberType& result) {
+            const int128_t bValue = negateB ? -b.getUnscaled() : b.getUnscaled();
+
+            // Camino rápido: misma escala en operandos y resultado, sin saltos
+            if (a.getScale() == b.getScale()) {
+                int128_t total;
+                const bool overflow = __builtin_add_overflow(a.getUnscaled(), bValue, &total);
+                if (a.getScale() == result.getScale()) {
+                    if (overflow | !withinLimit(total, POW10_U128[result.getPrecision()])) {
+                        throwOverflow(result);
+                    }
+                    return {total, result.getScale()};
+                }
+                if (!overflow) {
+                    return scaleMagnitude({0, absoluteValue(total)}, a.getScale(), total < 0, result);
+                }
+            }
+
+            // Camino general: se alinean las magnitudes a la escala común en 256 bits
+            const size_t common = std::max(a.getScale(), b.getScale());
+            UInt256 left = multiplyWide(absoluteValue(a.getUnscaled()), POW10_U128[common - a.getScale()]);
+            UInt256 right = multiplyWide(absoluteValue(bValue), POW10_U128[common - b.getScale()]);
+            const bool leftNegative = a.getUnscaled() < 0;
+            const bool rightNegative = bValue < 0;
+
+            if (leftNegative == rightNegative) {
+                return scaleMagnitude(add(left, right), common, leftNegative, result);
+            }
+            if (lessThan(left, right)) {
+                return scaleMagnitude(subtract(right, left), common, rightNegative, result);
+            }
+            return scaleMagnitude(subtract(left, right), common, leftNegative, result);
+        }
+
+        // Suma exacta: total + carries * 2^128, convertida a signo y magnitud de 256 bits
+        UInt256 wideMagnitude(int128_t total, int64_t carries, bool& negative) noexcept {
+            UInt256 value{
+                static_cast<uint128_t>(static_cast<int128_t>(carries) + (total < 0 ? -1 : 0)),
+                static_cast<uint128_t>(total)
+            };
+            negative = (value.high >> 127) != 0;
+            if (negative) {
+                value = add({~value.high, ~value.low}, {0, 1});
+            }
+            return value;
+        }
+
+        Decimal128 average(const UInt256& magnitude, bool negative, size_t count, size_t scale,
+                           const NumberType& result) {
+            if (count == 0) {
+                throw DataTypeException("Cannot average an empty column");
+            }
+            const size_t toScale = result.getScale();
+            UInt256 numerator = magnitude;
+            UInt256 denominator{0, count};
+            if (toScale >= scale) {
+                const UInt256 factor = powerOfTen(toScale - scale);
+                if (factor.high != 0 || !multiplyInPlace(numerator, factor.low)) {
+                    throwOverflow(result);
+                }
+            } else {
+                const UInt256 factor = powerOfTen(scale - toScale);
+                if (factor.high != 0 || !multiplyInPlace(denominator, factor.low)) {
+                    return {0, toScale};
+                }
+            }
+            return finish(divideRounded(numerator, denominator), negative, result);
+        }
+    } // namespace
+
+    Decimal128 DecimalArithmetic::add(const Decimal128& a, const Decimal128& b, const NumberType& result) {
+        return combine(a, b, false, result);
+    }
+
+    Decimal128 DecimalArithmetic::subtract(const Decimal128& a, const Decimal128& b, const NumberType& result) {
+        return combine(a, b, true, result);
+    }
+
+    Decimal128 DecimalArithmetic::multiply(const Decimal128& a, const Decimal128& b, const NumberType& result) {
+        const bool negative = (a.getUnscaled() < 0) != (b.getUnscaled() < 0);
+        const size_t productScale = a.getScale() + b.getScale();
+
+        // Camino rápido: el producto cabe en 128 bits
+        int128_t product;
+        if (!__builtin_mul_overflow(a.getUnscaled(), b.getUnscaled(), &product)) {
+            if (productScale == result.getScale()) {
+                if (!withinLimit(product, POW10_U128[result.getPrecision()])) {
+                    throwOverflow(result);
+                }
+                return {product, result.getScale()};
+            }
+            return scaleMagnitude({0, absoluteValue(product)}, productScale, negative, result);
+        }
+        return scaleMagnitude(multiplyWide(absoluteValue(a.getUnscaled()), absoluteValue(b.getUnscaled())),
+                              productScale, negative, result);
+    }
+
+    Decimal128 DecimalArithmetic::divide(const Decimal128& a, const Decimal128& b, const NumberType& result) {
+        if (b.getUnscaled() == 0) {
+            throw DataTypeException("Division by zero");
+        }
+        const bool negative = (a.getUnscaled() < 0) != (b.getUnscaled() < 0);
+        const uint128_t dividend = absoluteValue(a.getUnscaled());
+        const uint128_t divisor = absoluteValue(b.getUnscaled());
+
+        // cociente = a * 10^(rs + bs - as) / b, exponente de cualquier signo
+        const long exponent = static_cast<long>(result.getScale() + b.getScale()) - static_cast<long>(a.getScale());
+        UInt256 numerator{0, dividend};
+        UInt256 denominator{0, divisor};
+        const UInt256 factor = powerOfTen(static_cast<size_t>(exponent >= 0 ? exponent : -exponent));
+        UInt256& scaled = exponent >= 0 ? numerator : denominator;
+        if (factor.high != 0 || !multiplyInPlace(scaled, factor.low)) {
+            if (exponent >= 0) {
+                throwOverflow(result);
+            }
+            return {0, result.getScale()};
+        }
+
+        // Camino rápido: ambos operandos caben en 128 bits
+        if (numerator.high == 0 && denominator.high == 0) {
+            const uint128_t quotient = numerator.low / denominator.low;
+            const uint128_t remainder = numerator.low % denominator.low;
+            const bool roundUp = remainder >= denominator.low - remainder;
+            return finish({0, quotient + (roundUp ? 1 : 0)}, negative, result);
+        }
+        return finish(divideRounded(numerator, denominator), negative, result);
+    }
+
+    Decimal128 DecimalArithmetic::rescale(const Decimal128& value, const NumberType& result) {
+        if (value.getScale() == result.getScale()) {
+            if (!withinLimit(value.getUnscaled(), POW10_U128[result.getPrecision()])) {
+                throwOverflow(result);
+            }
+            return value;
+        }
+        return scaleMagnitude({0, absoluteValue(value.getUnscaled())}, value.getScale(),
+                              value.getUnscaled() < 0, result);
+    }
+
+    Decimal128 DecimalArithmetic::sum(std::span<const int64_t> unscaled, size_t scale, const NumberType& result) {
+        // Un acumulador de 128 bits no puede desbordar sumando menos de 2^64 valores de 64 bits
+        int128_t total = 0;
+        for (const int64_t value : unscaled) {
+            total += value;
+        }
+        return rescale(Decimal128{total, scale}, result);
+    }
+
+    Decimal128 DecimalArithmetic::sum(std::span<const int128_t> unscaled, size_t scale, const NumberType& result) {
+        int128_t total = 0;
+        int64_t carries = 0;
+        for (const int128_t value : unscaled) {
+            const bool overflow = __builtin_add_overflow(total, value, &total);
+            carries += overflow ? (value > 0 ? 1 : -1) : 0;
+        }
+        if (carries != 0) {
+            // |suma| >= 2^127 > 10^38: nunca cabe en un NUMBER
+            throwOverflow(result);
+        }
+        return rescale(Decimal128{total, scale}, result);
+    }
+
+    Decimal128 DecimalArithmetic::avg(std::span<const int64_t> unscaled, size_t scale, const NumberType& result) {
+        int128_t total = 0;
+        for (const int64_t value : unscaled) {
+            total += value;
+        }
+        return average({0, absoluteValue(total)}, total < 0, unscaled.size(), scale, result);
+    }
+
+    Decimal128 DecimalArithmetic::avg(std::span<const int128_t> unscaled, size_t scale, const NumberType& result) {
+        int128_t total = 0;
+        int64_t carries = 0;
+        for (const int128_t value : unscaled) {
+            const bool overflow = __builtin_add_overflow(total, value, &total);
+            carries += overflow ? (value > 0 ? 1 : -1) : 0;
+        }
+        bool negative = false;
+        const UInt256 magnitude = wideMagnitude(total, carries, negative);
+        return average(magnitude, negative, unscaled.size(), scale, result);
+    }
+
+} // namespace db::types
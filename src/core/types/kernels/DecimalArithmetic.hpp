@@ -0,0 +1,34 @@
+// src/core/types/kernels/DecimalArithmetic.hpp
+#ifndef DECIMAL_ARITHMETIC_HPP
+#define DECIMAL_ARITHMETIC_HPP
+
+#include "../NumberType.hpp"
+#include "../values/Decimal128.hpp"
+#include <cstdint>
+#include <span>
+
+namespace db::types {
+
+    // Aritmética exacta sobre Decimal128. Cada operación recibe el NumberType del
+    // resultado: se redondea a su escala (mitad alejándose de cero) y se lanza
+    // DataTypeException si el valor no cabe en su precisión.
+    class DecimalArithmetic {
+    public:
+        DecimalArithmetic() = delete;
+
+        static Decimal128 add(const Decimal128& a, const Decimal128& b, const NumberType& result);
+        static Decimal128 subtract(const Decimal128& a, const Decimal128& b, const NumberType& result);
+        static Decimal128 multiply(const Decimal128& a, const Decimal128& b, const NumberType& result);
+        static Decimal128 divide(const Decimal128& a, const Decimal128& b, const NumberType& result);
+        static Decimal128 rescale(const Decimal128& value, const NumberType& result);
+
+        // Agregados sobre columnas cuyos valores comparten la escala `scale`
+        static Decimal128 sum(std::span<const int64_t> unscaled, size_t scale, const NumberType& result);
+        static Decimal128 sum(std::span<const int128_t> unscaled, size_t scale, const NumberType& result);
+        static Decimal128 avg(std::span<const int64_t> unscaled, size_t scale, const NumberType& result);
+        static Decimal128 avg(std::span<const int128_t> unscaled, size_t scale, const NumberType& result);
+    };
+
+} // namespace db::types
+
+#endif // DECIMAL_ARITHMETIC_HPP
@@ -0,0 +1,146 @@
+// src/core/types/kernels/DictionaryEncoding.cpp
+#include "DictionaryEncoding.hpp"
+#include "TypeKernels.hpp"
+#include "../exceptions/DataTypeException.hpp"
+#include "../util/BlankPadding.hpp"
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+namespace db::types {
+
+    namespace {
+        template<typename Code, typename Predicate>
+        Bitmap selectRows(const std::vector<Code>& codes, Predicate predicate) {
+            Bitmap selected(codes.size());
+            auto words = selected.words();
+            for (size_t base = 0; base < codes.size(); base += Bitmap::BITS_PER_WORD) {
+                const size_t end = std::min(codes.size(), base + Bitmap::BITS_PER_WORD);
+                uint64_t word = 0;
+                for (size_t i = base; i < end; ++i) {
+                    word |= static_cast<uint64_t>(predicate(codes[i])) << (i - base);
+                }
+                words[base / Bitmap::BITS_PER_WORD] = word;
+            }
+            return selected;
+        }
+
+        template<typename Code>
+        std::vector<Code> narrow(const std::vector<uint32_t>& codes) {
+            return std::vector<Code>(codes.begin(), codes.end());
+        }
+    } // namespace
+
+    DictionaryColumn DictionaryColumn::encode(const TypeDescriptor& type, std::span<const std::string_view> values) {
+        Bitmap invalid(values.size());
+        if (TypeKernels::findInvalid(type, values, invalid.words()) > 0) {
+            throw DataTypeException("Value does not fit in dictionary column type");
+        }
+
+        DictionaryColumn column(type);
+        column.rows = values.size();
+
+        // Valores distintos en el orden del tipo
+        std::unordered_map<std::string_view, uint32_t> distinct;
+        for (const std::string_view value : values) {
+            distinct.try_emplace(column.normalize(value), 0);
+        }
+        std::vector<std::string_view> sorted;
+        sorted.reserve(distinct.size());
+        for (const auto& [value, code] : distinct) {
+            sorted.push_back(value);
+        }
+        std::sort(sorted.begin(), sorted.end(),
+                  [&](std::string_view a, std::string_view b) { return column.less(a, b); });
+
+        column.entries.reserve(sorted.size());
+        for (uint32_t code = 0; code < sorted.size(); ++code) {
+            distinct[sorted[code]] = code;
+            column.entries.push_back(column.arena.copy(sorted[code]));
+        }
+
+        std::vector<uint32_t> codes(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            codes[i] = distinct.find(column.normalize(values[i]))->second;
+        }
+        if (sorted.size() <= size_t{std::numeric_limits<uint8_t>::max()} + 1) {
+            column.codes = narrow<uint8_t>(codes);
+        } else if (sorted.size() <= size_t{std::numeric_limits<uint16_t>::max()} + 1) {
+            column.codes = narrow<uint16_t>(codes);
+        } else {
+            column.codes = std::move(codes);
+        }
+        return column;
+    }
+
+    size_t DictionaryColumn::getCodeWidth() const noexcept {
+        return std::visit([](const auto& codes) { return sizeof(codes[0]); }, codes);
+    }
+
+    uint32_t DictionaryColumn::codeAt(size_t row) const noexcept {
+        return std::visit([row](const auto& codes) { return static_cast<uint32_t>(codes[row]); }, codes);
+    }
+
+    std::string_view DictionaryColumn::normalize(std::string_view value) const noexcept {
+        const bool padded = type.kind == TypeKind::CHAR || type.kind == TypeKind::NCHAR;
+        return padded ? trimPadding(value) : value;
+    }
+
+    bool DictionaryColumn::less(std::string_view a, std::string_view b) const noexcept {
+        if (type.kind == TypeKind::CHAR || type.kind == TypeKind::NCHAR) {
+            return compareBlankPadded(a, b) < 0;
+        }
+        return a < b;
+    }
+
+    uint32_t DictionaryColumn::bound(std::string_view value, bool after) const noexcept {
+        const std::string_view key = normalize(value);
+        const auto position = after
+            ? std::upper_bound(entries.begin(), entries.end(), key,
+                               [&](std::string_view a, std::string_view b) { return less(a, b); })
+            : std::lower_bound(entries.begin(), entries.end(), key,
+                               [&](std::string_view a, std::string_view b) { return less(a, b); });
+        return static_cast<uint32_t>(position - entries.begin());
+    }
+
+    std::optional<uint32_t> DictionaryColumn::find(std::string_view value) const noexcept {
+        const uint32_t code = bound(value, false);
+        if (code < entries.size() && !less(normalize(value), entries[code])) {
+            return code;
+        }
+        return std::nullopt;
+    }
+
+    Bitmap DictionaryColumn::selectCodes(uint32_t first, uint32_t last) const {
+        if (first >= last) {
+            return Bitmap(rows);
+        }
+        // Un solo compare sin signo por fila: code - first < last - first
+        return std::visit([&](const auto& values) {
+            return selectRows(values, [first, span = last - first](uint32_t code) { return code - first < span; });
+        }, codes);
+    }
+
+    Bitmap DictionaryColumn::selectEqual(std::string_view value) const {
+        const auto code = find(value);
+        return code ? selectCodes(*code, *code + 1) : Bitmap(rows);
+    }
+
+    Bitmap DictionaryColumn::selectBetween(std::string_view low, std::string_view high) const {
+        return selectCodes(bound(low, false), bound(high, true));
+    }
+
+    Bitmap DictionaryColumn::selectIn(std::span<const std::string_view> candidates) const {
+        // Pertenencia por código: la lista se resuelve contra el diccionario una vez
+        std::vector<uint8_t> member(entries.size(), 0);
+        for (const std::string_view candidate : candidates) {
+            if (const auto code = find(candidate)) {
+                member[*code] = 1;
+            }
+        }
+        return std::visit([&](const auto& values) {
+            return selectRows(values, [&member](uint32_t code) { return member[code] != 0; });
+        }, codes);
+    }
+
+} // namespace db::types
@@ -0,0 +1,69 @@
+// src/core/types/kernels/DictionaryEncoding.hpp
+#ifndef DICTIONARY_ENCODING_HPP
+#define DICTIONARY_ENCODING_HPP
+
+#include "../TypeDescriptor.hpp"
+#include "../util/Bitmap.hpp"
+#include "../util/StringArena.hpp"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace db::types {
+
+    // Segmento de una columna de cadenas codificado con un diccionario ordenado:
+    // cada valor distinto recibe su posición en el orden del tipo, así que
+    // a < b si y sólo si code(a) < code(b). Igualdad, rangos e IN se traducen una
+    // vez a códigos y el filtro recorre enteros de 8, 16 o 32 bits según cuántos
+    // valores distintos haya. En CHAR/NCHAR el diccionario guarda los valores sin
+    // relleno y ordena con semántica de relleno en blanco: 'A' y 'A   ' comparten código.
+    class DictionaryColumn {
+    public:
+        // Lanza DataTypeException si el tipo no es de cadena o algún valor no cabe en él
+        [[nodiscard]] static DictionaryColumn encode(const TypeDescriptor& type,
+                                                     std::span<const std::string_view> values);
+
+        [[nodiscard]] const TypeDescriptor& getType() const noexcept { return type; }
+        [[nodiscard]] size_t size() const noexcept { return rows; }
+        [[nodiscard]] size_t getDictionarySize() const noexcept { return entries.size(); }
+        // Bytes por código: 1, 2 o 4
+        [[nodiscard]] size_t getCodeWidth() const noexcept;
+
+        [[nodiscard]] uint32_t codeAt(size_t row) const noexcept;
+        // Valor de la fila; en CHAR/NCHAR sin el relleno
+        [[nodiscard]] std::string_view valueAt(size_t row) const noexcept { return entries[codeAt(row)]; }
+        [[nodiscard]] std::string_view entry(uint32_t code) const noexcept { return entries[code]; }
+
+        // Código de `value`, si aparece en el segmento
+        [[nodiscard]] std::optional<uint32_t> find(std::string_view value) const noexcept;
+
+        [[nodiscard]] Bitmap selectEqual(std::string_view value) const;
+        // low <= valor <= high
+        [[nodiscard]] Bitmap selectBetween(std::string_view low, std::string_view high) const;
+        [[nodiscard]] Bitmap selectIn(std::span<const std::string_view> candidates) const;
+
+    private:
+        using Codes = std::variant<std::vector<uint8_t>, std::vector<uint16_t>, std::vector<uint32_t>>;
+
+        explicit DictionaryColumn(const TypeDescriptor& type) noexcept : type(type) {}
+
+        [[nodiscard]] std::string_view normalize(std::string_view value) const noexcept;
+        [[nodiscard]] bool less(std::string_view a, std::string_view b) const noexcept;
+        // Primer código >= value, o > value si `after`
+        [[nodiscard]] uint32_t bound(std::string_view value, bool after) const noexcept;
+        // Códigos en [first, last)
+        [[nodiscard]] Bitmap selectCodes(uint32_t first, uint32_t last) const;
+
+        TypeDescriptor type;
+        StringArena arena;
+        std::vector<std::string_view> entries;
+        Codes codes;
+        size_t rows = 0;
+    };
+
+} // namespace db::types
+
+#endif // DICTIONARY_ENCODING_HPP
@@ -0,0 +1,197 @@
+// src/core/types/kernels/KeyEncoding.cpp
+#include "KeyEncoding.hpp"
+#include "../exceptions/DataTypeException.hpp"
+#include "../util/BlankPadding.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace db::types {
+
+    namespace {
+        constexpr uint8_t NULL_LOW = 0x00;
+        constexpr uint8_t PRESENT = 0x01;
+        constexpr uint8_t NULL_HIGH = 0x02;
+
+        constexpr uint8_t STRING_ESCAPE = 0xFF;
+
+        void writeBigEndian(uint64_t value, size_t bytes, std::vector<uint8_t>& out) {
+            for (size_t i = bytes; i-- > 0;) {
+                out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+            }
+        }
+
+        // Con el bit de signo invertido los enteros con signo ordenan como sin signo
+        void writeSigned(int64_t value, std::vector<uint8_t>& out) {
+            writeBigEndian(static_cast<uint64_t>(value) ^ (uint64_t{1} << 63), sizeof(value), out);
+        }
+
+        void writeNumber(const KeyValue& value, std::vector<uint8_t>& out) {
+            uint8_t key[NumberValue::MAX_KEY_SIZE];
+            const size_t size = std::get<NumberValue>(value).encodeKey(key);
+            out.insert(out.end(), key, key + size);
+        }
+
+        // 0x00 dentro del texto pasa a 00 FF y el final es 00 00, que queda por
+        // debajo de cualquier continuación: "a" < "a\0" < "ab"
+        void writeBytes(std::string_view text, std::vector<uint8_t>& out) {
+            out.reserve(out.size() + text.size() + 2);
+            for (size_t start = 0; start <= text.size();) {
+                const size_t zero = std::min(text.find('\0', start), text.size());
+                out.insert(out.end(), text.begin() + static_cast<ptrdiff_t>(start),
+                           text.begin() + static_cast<ptrdiff_t>(zero));
+                out.push_back(0x00);
+                out.push_back(zero == text.size() ? 0x00 : STRING_ESCAPE);
+                start = zero + 1;
+            }
+        }
+
+        void writeString(const KeyValue& value, std::vector<uint8_t>& out) {
+            writeBytes(std::get<std::string_view>(value), out);
+        }
+
+        // Semántica de relleno en blanco: el final del valor equivale a infinitos
+        // espacios, así que lo que sigue a un espacio (o al final) ordena según quede
+        // por debajo o por encima de 0x20. Los bytes mayores que el espacio se copian
+        // tal cual; el resto va en grupos de longitud fija que empiezan por una clase
+        // menor que 0x21:
+        //   01 c         byte c < 0x20 sin espacios delante
+        //   02 k(4) c    k espacios y después c < 0x20: con más espacios, mayor
+        //   03           fin del valor
+        //   04 ~k(4) c   k espacios y después c > 0x20: con más espacios, menor
+        constexpr uint8_t PAD_LOW = 0x01;
+        constexpr uint8_t PAD_SPACES_LOW = 0x02;
+        constexpr uint8_t PAD_END = 0x03;
+        constexpr uint8_t PAD_SPACES_HIGH = 0x04;
+
+        void writePaddedString(const KeyValue& value, std::vector<uint8_t>& out) {
+            const std::string_view text = trimPadding(std::get<std::string_view>(value));
+            out.reserve(out.size() + text.size() + 1);
+            uint32_t spaces = 0;
+            for (const char c : text) {
+                const auto byte = static_cast<uint8_t>(c);
+                if (byte == ' ') {
+                    ++spaces;
+                    continue;
+                }
+                if (byte < ' ') {
+                    if (spaces == 0) {
+                        out.push_back(PAD_LOW);
+                    } else {
+                        out.push_back(PAD_SPACES_LOW);
+                        writeBigEndian(spaces, sizeof(spaces), out);
+                    }
+                } else if (spaces > 0) {
+                    out.push_back(PAD_SPACES_HIGH);
+                    writeBigEndian(static_cast<uint32_t>(~spaces), sizeof(spaces), out);
+                }
+                out.push_back(byte);
+                spaces = 0;
+            }
+            out.push_back(PAD_END);
+        }
+
+        void writeDate(const KeyValue& value, std::vector<uint8_t>& out) {
+            writeSigned(std::get<DateValue>(value).getEpochSeconds(), out);
+        }
+
+        void writeTimestamp(const KeyValue& value, std::vector<uint8_t>& out) {
+            const TimestampValue& timestamp = std::get<TimestampValue>(value);
+            writeSigned(timestamp.getUtcSeconds(), out);
+            writeBigEndian(static_cast<uint32_t>(timestamp.getNanos()), sizeof(uint32_t), out);
+        }
+    } // namespace
+
+    KeyEncoder::KeyEncoder(std::vector<KeyColumn> columns) : columns(std::move(columns)) {
+        plans.reserve(this->columns.size());
+        for (const KeyColumn& column : this->columns) {
+            Plan plan{};
+            switch (column.type.kind) {
+                case TypeKind::NUMBER:
+                    plan.writer = writeNumber;
+                    plan.alternative = 1;
+                    break;
+                case TypeKind::VARCHAR2:
+                case TypeKind::NVARCHAR2:
+                    plan.writer = writeString;
+                    plan.alternative = 2;
+                    break;
+                case TypeKind::CHAR:
+                case TypeKind::NCHAR:
+                    plan.writer = writePaddedString;
+                    plan.alternative = 2;
+                    break;
+                case TypeKind::DATE:
+                    plan.writer = writeDate;
+                    plan.alternative = 3;
+                    break;
+                case TypeKind::TIMESTAMP:
+                    plan.writer = writeTimestamp;
+                    plan.alternative = 4;
+                    break;
+                default:
+                    throw DataTypeException("Unsupported type kind in key column");
+            }
+            plan.descending = column.direction == SortDirection::DESCENDING;
+            const bool nullsFirst = column.nulls == NullPlacement::DEFAULT ? plan.descending
+                                                                            : column.nulls == NullPlacement::FIRST;
+            plan.nullMarker = nullsFirst ? NULL_LOW : NULL_HIGH;
+            plans.push_back(plan);
+        }
+    }
+
+    void KeyEncoder::append(std::span<const KeyValue> row, std::vector<uint8_t>& out) const {
+        if (row.size() != plans.size()) {
+            throw DataTypeException("Key row has " + std::to_string(row.size()) + " values, expected "
+                                    + std::to_string(plans.size()));
+        }
+        for (size_t c = 0; c < plans.size(); ++c) {
+            const Plan& plan = plans[c];
+            const KeyValue& value = row[c];
+            if (value.index() == 0) {
+                out.push_back(plan.nullMarker);
+                continue;
+            }
+            if (value.index() != plan.alternative) {
+                throw DataTypeException("Key value does not match the type of column " + std::to_string(c));
+            }
+            out.push_back(PRESENT);
+            const size_t start = out.size();
+            plan.writer(value, out);
+            if (plan.descending) {
+                std::for_each(out.begin() + static_cast<ptrdiff_t>(start), out.end(),
+                              [](uint8_t& byte) { byte = static_cast<uint8_t>(~byte); });
+            }
+        }
+    }
+
+    std::vector<uint8_t> KeyEncoder::encode(std::span<const KeyValue> row) const {
+        std::vector<uint8_t> key;
+        append(row, key);
+        return key;
+    }
+
+    void KeyEncoder::encodeBatch(std::span<const KeyValue> rows, KeyBatch& out) const {
+        const size_t width = plans.size();
+        if (width == 0 || rows.size() % width != 0) {
+            throw DataTypeException("Key batch size is not a multiple of the column count");
+        }
+        const size_t count = rows.size() / width;
+        out.bytes.clear();
+        out.ends.clear();
+        out.ends.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            append(rows.subspan(i * width, width), out.bytes);
+            out.ends.push_back(static_cast<uint32_t>(out.bytes.size()));
+        }
+    }
+
+    int KeyEncoder::compare(std::span<const uint8_t> a, std::span<const uint8_t> b) noexcept {
+        const size_t common = std::min(a.size(), b.size());
+        const int order = common == 0 ? 0 : std::memcmp(a.data(), b.data(), common);
+        if (order != 0) {
+            return order < 0 ? -1 : 1;
+        }
+        return (a.size() > b.size()) - (a.size() < b.size());
+    }
+
+} // namespace db::types
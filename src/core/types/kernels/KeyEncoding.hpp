@@ -0,0 +1,91 @@
+// src/core/types/kernels/KeyEncoding.hpp
+#ifndef KEY_ENCODING_HPP
+#define KEY_ENCODING_HPP
+
+#include "../TypeDescriptor.hpp"
+#include "../values/NumberValue.hpp"
+#include "../values/DateValue.hpp"
+#include "../values/TimestampValue.hpp"
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace db::types {
+
+    enum class SortDirection : uint8_t { ASCENDING, DESCENDING };
+
+    // DEFAULT sigue a Oracle: NULL al final en ASC y al principio en DESC
+    enum class NullPlacement : uint8_t { DEFAULT, FIRST, LAST };
+
+    struct KeyColumn {
+        TypeDescriptor type;
+        SortDirection direction = SortDirection::ASCENDING;
+        NullPlacement nulls = NullPlacement::DEFAULT;
+    };
+
+    // Valor de una columna de la clave; monostate es NULL. Las cadenas sirven
+    // para VARCHAR2, CHAR, NCHAR y NVARCHAR2.
+    using KeyValue = std::variant<std::monostate, NumberValue, std::string_view, DateValue, TimestampValue>;
+
+    // Claves de un lote una tras otra; ends[i] es el final de la clave i
+    struct KeyBatch {
+        std::vector<uint8_t> bytes;
+        std::vector<uint32_t> ends;
+
+        [[nodiscard]] size_t size() const noexcept { return ends.size(); }
+        [[nodiscard]] std::span<const uint8_t> key(size_t index) const noexcept {
+            const uint32_t start = index == 0 ? 0 : ends[index - 1];
+            return {bytes.data() + start, ends[index] - start};
+        }
+    };
+
+    // Codifica una clave de varias columnas en bytes cuyo orden con memcmp es el
+    // orden SQL de la clave, así que ordenar o buscar en un índice no necesita
+    // comparadores por tipo. Cada columna escribe un byte de presencia (el NULL
+    // queda por debajo o por encima de cualquier valor) y después su valor en una
+    // forma que ninguna otra codificación de la columna tiene como prefijo; en DESC
+    // esos bytes se invierten.
+    //   NUMBER     NumberValue::encodeKey: base 100 con terminador (1.50 y 1.5 coinciden)
+    //   VARCHAR2   bytes con 0x00 escapado como 00 FF y terminados en 00 00;
+    //   NVARCHAR2  UTF-8 conserva el orden de los puntos de código
+    //   CHAR/NCHAR el final cuenta como espacios infinitos: 'A' y 'A  ' dan la misma
+    //              clave y 'A\t' < 'A' < 'A B' < 'AB', como compareBlankPadded
+    //   DATE       segundos desde 1970 en big endian con el bit de signo invertido
+    //   TIMESTAMP  instante UTC (segundos y nanosegundos); el desplazamiento no cuenta
+    class KeyEncoder {
+    public:
+        explicit KeyEncoder(std::vector<KeyColumn> columns);
+
+        [[nodiscard]] size_t getColumnCount() const noexcept { return columns.size(); }
+        [[nodiscard]] const std::vector<KeyColumn>& getColumns() const noexcept { return columns; }
+
+        // Añade a `out` la clave de una fila. Lanza DataTypeException si la fila no
+        // tiene una entrada por columna o un valor no es del tipo de su columna.
+        void append(std::span<const KeyValue> row, std::vector<uint8_t>& out) const;
+        [[nodiscard]] std::vector<uint8_t> encode(std::span<const KeyValue> row) const;
+
+        // `rows` son getColumnCount() valores por fila, fila tras fila
+        void encodeBatch(std::span<const KeyValue> rows, KeyBatch& out) const;
+
+        // Mismo resultado que comparar las filas columna a columna: -1, 0 o 1
+        [[nodiscard]] static int compare(std::span<const uint8_t> a, std::span<const uint8_t> b) noexcept;
+
+    private:
+        using Writer = void (*)(const KeyValue& value, std::vector<uint8_t>& out);
+
+        struct Plan {
+            Writer writer;
+            uint8_t alternative;  // Índice esperado en KeyValue
+            uint8_t nullMarker;
+            bool descending;
+        };
+
+        std::vector<KeyColumn> columns;
+        std::vector<Plan> plans;
+    };
+
+} // namespace db::types
+
+#endif // KEY_ENCODING_HPP
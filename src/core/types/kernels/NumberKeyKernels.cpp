@@ -0,0 +1,38 @@
+// src/core/types/kernels/NumberKeyKernels.cpp
+#include "NumberKeyKernels.hpp"
+
+namespace db::types {
+
+    void NumberKeyKernels::checkSizes(size_t count, size_t outBytes, size_t endCount) {
+        if (outBytes < count * NumberValue::MAX_KEY_SIZE || endCount < count) {
+            throw DataTypeException("Output span is smaller than input");
+        }
+    }
+
+    size_t NumberKeyKernels::encodeBatch(std::span<const NumberValue> values, std::span<uint8_t> out,
+                                         std::span<uint32_t> ends) {
+        checkSizes(values.size(), out.size(), ends.size());
+        size_t offset = 0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            offset += values[i].encodeKey(out.subspan(offset));
+            ends[i] = static_cast<uint32_t>(offset);
+        }
+        return offset;
+    }
+
+    void NumberKeyKernels::decodeBatch(std::span<const uint8_t> keys, std::span<const uint32_t> ends,
+                                       std::span<NumberValue> out) {
+        if (out.size() < ends.size()) {
+            throw DataTypeException("Output span is smaller than input");
+        }
+        uint32_t start = 0;
+        for (size_t i = 0; i < ends.size(); ++i) {
+            if (ends[i] < start || ends[i] > keys.size()) {
+                throw DataTypeException("Malformed NUMBER key");
+            }
+            out[i] = NumberValue::decodeKey(keys.subspan(start, ends[i] - start));
+            start = ends[i];
+        }
+    }
+
+} // namespace db::types
@@ -0,0 +1,49 @@
+// src/core/types/kernels/NumberKeyKernels.hpp
+#ifndef NUMBER_KEY_KERNELS_HPP
+#define NUMBER_KEY_KERNELS_HPP
+
+#include "../NumberType.hpp"
+#include "../util/Int128.hpp"
+#include "../values/NumberValue.hpp"
+#include <cstdint>
+#include <span>
+
+namespace db::types {
+
+    // Claves de índice NUMBER por columnas (ver NumberValue::encodeKey). Las
+    // claves se escriben una tras otra; ends[i] es el final de la clave i.
+    class NumberKeyKernels {
+    public:
+        NumberKeyKernels() = delete;
+
+        // Requiere out.size() >= values.size() * NumberValue::MAX_KEY_SIZE. Devuelve el total escrito.
+        static size_t encodeBatch(std::span<const NumberValue> values, std::span<uint8_t> out,
+                                  std::span<uint32_t> ends);
+
+        // Desde el almacenamiento nativo de la columna (int64_t en NUMBER(18)),
+        // valores escalados por 10^s del tipo
+        template<typename T>
+        static size_t encodeBatch(const NumberType& column, std::span<const T> values, std::span<uint8_t> out,
+                                  std::span<uint32_t> ends) {
+            checkSizes(values.size(), out.size(), ends.size());
+            size_t offset = 0;
+            for (size_t i = 0; i < values.size(); ++i) {
+                const auto value = static_cast<int128_t>(values[i]);
+                offset += NumberValue::fromScaled(absoluteValue(value), column.getScale(), value < 0)
+                              .encodeKey(out.subspan(offset));
+                ends[i] = static_cast<uint32_t>(offset);
+            }
+            return offset;
+        }
+
+        // Para recorridos que sólo leen el índice. Lanza si una clave está mal formada.
+        static void decodeBatch(std::span<const uint8_t> keys, std::span<const uint32_t> ends,
+                                std::span<NumberValue> out);
+
+    private:
+        static void checkSizes(size_t count, size_t outBytes, size_t endCount);
+    };
+
+} // namespace db::types
+
+#endif // NUMBER_KEY_KERNELS_HPP
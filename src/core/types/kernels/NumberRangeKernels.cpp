@@ -0,0 +1,99 @@
+// src/core/types/kernels/NumberRangeKernels.cpp
+#include "NumberRangeKernels.hpp"
+#include <algorithm>
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace db::types {
+
+    namespace {
+        void clearWords(std::span<uint64_t> failed, size_t count) noexcept {
+            std::fill_n(failed.begin(), Bitmap::wordsFor(count), uint64_t{0});
+        }
+
+        size_t countFailed(std::span<const uint64_t> failed, size_t count) noexcept {
+            size_t total = 0;
+            for (size_t w = 0; w < Bitmap::wordsFor(count); ++w) {
+                total += static_cast<size_t>(std::popcount(failed[w]));
+            }
+            return total;
+        }
+
+        // Los saltos de 2 y 4 dividen 64, así que cada grupo cae en una sola palabra
+        inline void storeMask(std::span<uint64_t> failed, size_t index, uint64_t mask) noexcept {
+            failed[index / Bitmap::BITS_PER_WORD] |= mask << (index % Bitmap::BITS_PER_WORD);
+        }
+    } // namespace
+
+    size_t NumberRangeKernels::findOutOfRange(const NumberType& type, std::span<const double> values,
+                                              std::span<uint64_t> failed) noexcept {
+        const auto bounds = NumberRangeBounds::of(type);
+        const size_t count = values.size();
+        clearWords(failed, count);
+        size_t i = 0;
+
+#if defined(__AVX2__)
+        const __m256d factor = _mm256_set1_pd(bounds.scaleFactor);
+        const __m256d limit = _mm256_set1_pd(bounds.scaledLimit);
+        const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+        for (; i + 4 <= count; i += 4) {
+            const __m256d scaled = _mm256_and_pd(_mm256_mul_pd(_mm256_loadu_pd(values.data() + i), factor), absMask);
+            const int inRange = _mm256_movemask_pd(_mm256_cmp_pd(scaled, limit, _CMP_LT_OQ));
+            storeMask(failed, i, static_cast<uint64_t>(~inRange & 0xF));
+        }
+#elif defined(__SSE2__)
+        const __m128d factor = _mm_set1_pd(bounds.scaleFactor);
+        const __m128d limit = _mm_set1_pd(bounds.scaledLimit);
+        const __m128d absMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+        for (; i + 2 <= count; i += 2) {
+            const __m128d scaled = _mm_and_pd(_mm_mul_pd(_mm_loadu_pd(values.data() + i), factor), absMask);
+            const int inRange = _mm_movemask_pd(_mm_cmplt_pd(scaled, limit));
+            storeMask(failed, i, static_cast<uint64_t>(~inRange & 0x3));
+        }
+#endif
+        for (; i < count; ++i) {
+            storeMask(failed, i, bounds.contains(values[i]) ? 0 : 1);
+        }
+        return countFailed(failed, count);
+    }
+
+    size_t NumberRangeKernels::findOutOfRange(const NumberType& type, std::span<const int64_t> values,
+                                              std::span<uint64_t> failed) noexcept {
+        const auto bounds = NumberRangeBounds::of(type);
+        const size_t count = values.size();
+        clearWords(failed, count);
+        size_t i = 0;
+
+#if defined(__AVX2__)
+        const __m256i upper = _mm256_set1_epi64x(bounds.integerMax);
+        const __m256i lower = _mm256_set1_epi64x(bounds.integerMin);
+        for (; i + 4 <= count; i += 4) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values.data() + i));
+            const __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi64(v, upper), _mm256_cmpgt_epi64(lower, v));
+            storeMask(failed, i, static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(outside))));
+        }
+#endif
+        // Sin AVX2 el bucle escalar sin saltos se vectoriza bien por el compilador
+        for (; i < count; ++i) {
+            const int64_t v = values[i];
+            storeMask(failed, i, static_cast<uint64_t>((v > bounds.integerMax) | (v < bounds.integerMin)));
+        }
+        return countFailed(failed, count);
+    }
+
+    size_t NumberRangeKernels::findOutOfRange(const NumberType& type, std::span<const NumberValue> values,
+                                              std::span<uint64_t> failed) noexcept {
+        const size_t count = values.size();
+        clearWords(failed, count);
+        for (size_t i = 0; i < count; ++i) {
+            storeMask(failed, i, values[i].fitsIn(type) ? 0 : 1);
+        }
+        return countFailed(failed, count);
+    }
+
+} // namespace db::types
@@ -0,0 +1,73 @@
+// src/core/types/kernels/NumberRangeKernels.hpp
+#ifndef NUMBER_RANGE_KERNELS_HPP
+#define NUMBER_RANGE_KERNELS_HPP
+
+#include "../NumberType.hpp"
+#include "../values/NumberValue.hpp"
+#include "../util/Bitmap.hpp"
+#include "../util/PowersOfTen.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace db::types {
+
+    // Límites de NUMBER(p,s) calculados una sola vez a partir de tablas constexpr.
+    // Un double v cabe si round(|v| * 10^s) <= 10^p - 1, que equivale a
+    // |v| * 10^s < 10^p - 0.5 con el redondeo de Oracle (mitad alejándose de cero).
+    struct NumberRangeBounds {
+        double scaleFactor;
+        double scaledLimit;
+        // Rango para enteros; con 19 o más dígitos enteros cabe cualquier int64
+        int64_t integerMin;
+        int64_t integerMax;
+
+        [[nodiscard]] static constexpr NumberRangeBounds of(const NumberType& type) noexcept {
+            const size_t precision = type.getPrecision();
+            const size_t scale = type.getScale();
+            const size_t integerDigits = precision - scale;
+            const bool limited = integerDigits <= MAX_INT64_POWER_OF_TEN;
+            return {
+                POW10_DOUBLE[scale],
+                POW10_DOUBLE[precision] - 0.5,
+                limited ? 1 - POW10_I64[integerDigits] : std::numeric_limits<int64_t>::min(),
+                limited ? POW10_I64[integerDigits] - 1 : std::numeric_limits<int64_t>::max()
+            };
+        }
+
+        [[nodiscard]] constexpr bool contains(int64_t value) const noexcept {
+            return value >= integerMin && value <= integerMax;
+        }
+
+        [[nodiscard]] bool contains(double value) const noexcept {
+            // NaN no cumple la comparación y queda fuera de rango
+            return std::fabs(value * scaleFactor) < scaledLimit;
+        }
+    };
+
+    // Validación de rango por lotes para cargas masivas. Cada kernel marca con
+    // un bit a 1 los valores que no caben en el tipo y devuelve cuántos son.
+    class NumberRangeKernels {
+    public:
+        NumberRangeKernels() = delete;
+
+        // failed debe tener al menos Bitmap::wordsFor(values.size()) palabras
+        static size_t findOutOfRange(const NumberType& type, std::span<const double> values,
+                                     std::span<uint64_t> failed) noexcept;
+        static size_t findOutOfRange(const NumberType& type, std::span<const int64_t> values,
+                                     std::span<uint64_t> failed) noexcept;
+        static size_t findOutOfRange(const NumberType& type, std::span<const NumberValue> values,
+                                     std::span<uint64_t> failed) noexcept;
+
+        template<typename T>
+        [[nodiscard]] static Bitmap findOutOfRange(const NumberType& type, std::span<const T> values) {
+            Bitmap failed(values.size());
+            findOutOfRange(type, values, failed.words());
+            return failed;
+        }
+    };
+
+} // namespace db::types
+
+#endif // NUMBER_RANGE_KERNELS_HPP
@@ -0,0 +1,91 @@
+// src/core/types/kernels/NumberStorageKernels.hpp
+#ifndef NUMBER_STORAGE_KERNELS_HPP
+#define NUMBER_STORAGE_KERNELS_HPP
+
+#include "../NumberType.hpp"
+#include "../PhysicalWidth.hpp"
+#include "../values/NumberValue.hpp"
+#include "../values/Decimal128.hpp"
+#include "../util/Bitmap.hpp"
+#include "DecimalArithmetic.hpp"
+#include <algorithm>
+#include <span>
+
+namespace db::types {
+
+    // Kernels sobre columnas NUMBER guardadas en su ancho nativo (ver
+    // NumberType::getPhysicalLayout). T es int32_t, int64_t o int128_t y los
+    // valores están escalados por 10^s del tipo de la columna.
+    class NumberStorageKernels {
+    public:
+        NumberStorageKernels() = delete;
+
+        // Convierte valores exactos al entero escalado de la columna; lanza si alguno no cabe
+        template<typename T>
+        static void pack(const NumberType& column, std::span<const NumberValue> values, std::span<T> out) {
+            checkWidth<T>(column);
+            checkSizes(values.size(), out.size());
+            for (size_t i = 0; i < values.size(); ++i) {
+                const NumberValue scaled = values[i].coerceTo(column);
+                const auto magnitude = static_cast<int128_t>(scaled.getCoefficient());
+                out[i] = static_cast<T>(scaled.isNegative() ? -magnitude : magnitude);
+            }
+        }
+
+        template<typename T>
+        static void unpack(const NumberType& column, std::span<const T> values, std::span<NumberValue> out) {
+            checkSizes(values.size(), out.size());
+            for (size_t i = 0; i < values.size(); ++i) {
+                const auto value = static_cast<int128_t>(values[i]);
+                out[i] = NumberValue::fromScaled(absoluteValue(value), column.getScale(), value < 0);
+            }
+        }
+
+        // SUM en un acumulador de 128 bits; int32 e int64 no pueden desbordarlo
+        template<typename T>
+        static Decimal128 sum(const NumberType& column, std::span<const T> values, const NumberType& result) {
+            if constexpr (sizeof(T) == sizeof(int128_t)) {
+                return DecimalArithmetic::sum(values, column.getScale(), result);
+            } else {
+                int128_t total = 0;
+                for (const T value : values) {
+                    total += value;
+                }
+                return DecimalArithmetic::rescale(Decimal128{total, column.getScale()}, result);
+            }
+        }
+
+        // Marca low <= v <= high; límites ya escalados a la columna. Sin saltos para vectorizar.
+        template<typename T>
+        static Bitmap selectBetween(std::span<const T> values, T low, T high) {
+            Bitmap selected(values.size());
+            auto words = selected.words();
+            for (size_t base = 0; base < values.size(); base += Bitmap::BITS_PER_WORD) {
+                const size_t end = std::min(values.size(), base + Bitmap::BITS_PER_WORD);
+                uint64_t word = 0;
+                for (size_t i = base; i < end; ++i) {
+                    word |= static_cast<uint64_t>((values[i] >= low) & (values[i] <= high)) << (i - base);
+                }
+                words[base / Bitmap::BITS_PER_WORD] = word;
+            }
+            return selected;
+        }
+
+    private:
+        template<typename T>
+        static void checkWidth(const NumberType& column) {
+            if (sizeof(T) < column.getPhysicalLayout().size) {
+                throw DataTypeException("Storage type too narrow for " + column.getName());
+            }
+        }
+
+        static void checkSizes(size_t input, size_t output) {
+            if (output < input) {
+                throw DataTypeException("Output span is smaller than input");
+            }
+        }
+    };
+
+} // namespace db::types
+
+#endif // NUMBER_STORAGE_KERNELS_HPP
@@ -0,0 +1,173 @@
+// src/core/types/kernels/PaddingKernels.cpp
+#include "PaddingKernels.hpp"
+#include "../TypeDispatch.hpp"
+#include "../util/BlankPadding.hpp"
+#include "../util/Utf8.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+namespace db::types {
+
+    namespace {
+        // Espacios que faltan hasta la longitud declarada, o `valid` a false si no cabe
+        struct Padding {
+            bool valid;
+            size_t count;
+        };
+
+        Padding measure(const CharType& type, std::string_view value) noexcept {
+            const size_t length = type.getLength();
+            return {value.size() <= length, value.size() <= length ? length - value.size() : 0};
+        }
+
+        // En NCHAR la longitud se cuenta en caracteres; la validación ya los cuenta
+        Padding measure(const NCharType& type, std::string_view value) noexcept {
+            const Utf8Validation utf8 = validateUtf8(value);
+            const bool valid = utf8.valid && utf8.codePoints <= type.getLength();
+            return {valid, valid ? type.getLength() - utf8.codePoints : 0};
+        }
+
+        size_t writePadded(std::string_view value, size_t padding, char* out) noexcept {
+            if (!value.empty()) {
+                std::memcpy(out, value.data(), value.size());
+            }
+            std::memset(out + value.size(), CharType::PADDING_CHAR, padding);
+            return value.size() + padding;
+        }
+
+        // `emit(i, value, padding)` escribe una fila válida y `skip(i)` marca una inválida
+        template<typename Type, typename Emit, typename Skip>
+        size_t padEach(const Type& type, std::span<const std::string_view> values, std::span<uint64_t> invalid,
+                       Emit emit, Skip skip) {
+            const size_t count = values.size();
+            size_t total = 0;
+            for (size_t base = 0; base < count; base += Bitmap::BITS_PER_WORD) {
+                const size_t end = std::min(count, base + Bitmap::BITS_PER_WORD);
+                uint64_t word = 0;
+                for (size_t i = base; i < end; ++i) {
+                    const Padding padding = measure(type, values[i]);
+                    if (padding.valid) {
+                        emit(i, values[i], padding.count);
+                    } else {
+                        word |= uint64_t{1} << (i - base);
+                        skip(i);
+                    }
+                }
+                invalid[base / Bitmap::BITS_PER_WORD] = word;
+                total += static_cast<size_t>(std::popcount(word));
+            }
+            return total;
+        }
+
+        template<typename Type>
+        constexpr bool IS_BLANK_PADDED = std::is_same_v<Type, CharType> || std::is_same_v<Type, NCharType>;
+
+        template<typename Type>
+        size_t widthOf(const Type& type) noexcept {
+            if constexpr (std::is_same_v<Type, NCharType>) {
+                return type.getLength() * MAX_UTF8_BYTES_PER_CHAR;
+            } else {
+                return type.getLength();
+            }
+        }
+
+        // Resuelve CHAR o NCHAR una vez por lote; cualquier otro tipo lanza
+        template<typename Result = size_t, typename Body>
+        Result withPaddedType(const TypeDescriptor& type, Body body) {
+            return dispatchType(type, [&](const auto& concrete) -> Result {
+                using Concrete = std::decay_t<decltype(concrete)>;
+                if constexpr (IS_BLANK_PADDED<Concrete>) {
+                    return body(concrete);
+                } else {
+                    throw DataTypeException(concrete.getName() + " is not a blank-padded type");
+                }
+            });
+        }
+    } // namespace
+
+    size_t PaddingKernels::slotWidth(const TypeDescriptor& type) {
+        return withPaddedType(type, [](const auto& concrete) { return widthOf(concrete); });
+    }
+
+    size_t PaddingKernels::padToSlots(const TypeDescriptor& type, std::span<const std::string_view> values,
+                                      std::span<char> out, std::span<uint32_t> lengths,
+                                      std::span<uint64_t> invalid) {
+        return withPaddedType(type, [&](const auto& concrete) {
+            const size_t width = widthOf(concrete);
+            if (out.size() / width < values.size() || lengths.size() < values.size()) {
+                throw DataTypeException("Output span is smaller than input");
+            }
+            return padEach(
+                concrete, values, invalid,
+                [&](size_t i, std::string_view value, size_t padding) {
+                    lengths[i] = static_cast<uint32_t>(writePadded(value, padding, out.data() + i * width));
+                },
+                [&](size_t i) { lengths[i] = 0; });
+        });
+    }
+
+    size_t PaddingKernels::padToArena(const TypeDescriptor& type, std::span<const std::string_view> values,
+                                      StringArena& arena, std::span<std::string_view> out,
+                                      std::span<uint64_t> invalid) {
+        return withPaddedType(type, [&](const auto& concrete) {
+            if (out.size() < values.size()) {
+                throw DataTypeException("Output span is smaller than input");
+            }
+            return padEach(
+                concrete, values, invalid,
+                [&](size_t i, std::string_view value, size_t padding) {
+                    char* slot = arena.allocate(value.size() + padding);
+                    out[i] = {slot, writePadded(value, padding, slot)};
+                },
+                [&](size_t i) { out[i] = {}; });
+        });
+    }
+
+    size_t PaddingKernels::trimToCompact(const TypeDescriptor& type, std::span<const std::string_view> values,
+                                         StringArena& arena, std::span<CompactString> out,
+                                         std::span<uint64_t> invalid) {
+        return withPaddedType(type, [&](const auto& concrete) {
+            if (out.size() < values.size()) {
+                throw DataTypeException("Output span is smaller than input");
+            }
+            return padEach(
+                concrete, values, invalid,
+                [&](size_t i, std::string_view value, size_t) {
+                    out[i] = CompactString::make(trimPadding(value, CharType::PADDING_CHAR), arena);
+                },
+                [&](size_t i) { out[i] = {}; });
+        });
+    }
+
+    size_t PaddingKernels::padToSlots(const TypeDescriptor& type, std::span<const CompactString> stored,
+                                      std::span<char> out, std::span<uint32_t> lengths,
+                                      std::span<uint64_t> invalid) {
+        return withPaddedType(type, [&](const auto& concrete) {
+            const size_t width = widthOf(concrete);
+            if (out.size() / width < stored.size() || lengths.size() < stored.size()) {
+                throw DataTypeException("Output span is smaller than input");
+            }
+            const size_t count = stored.size();
+            size_t total = 0;
+            for (size_t base = 0; base < count; base += Bitmap::BITS_PER_WORD) {
+                const size_t end = std::min(count, base + Bitmap::BITS_PER_WORD);
+                uint64_t word = 0;
+                for (size_t i = base; i < end; ++i) {
+                    const std::string_view value = stored[i].view();
+                    if (const auto padding = concrete.paddingFor(value)) {
+                        lengths[i] = static_cast<uint32_t>(writePadded(value, *padding, out.data() + i * width));
+                    } else {
+                        lengths[i] = 0;
+                        word |= uint64_t{1} << (i - base);
+                    }
+                }
+                invalid[base / Bitmap::BITS_PER_WORD] = word;
+                total += static_cast<size_t>(std::popcount(word));
+            }
+            return total;
+        });
+    }
+
+} // namespace db::types
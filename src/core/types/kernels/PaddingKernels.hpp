@@ -0,0 +1,56 @@
+// src/core/types/kernels/PaddingKernels.hpp
+#ifndef PADDING_KERNELS_HPP
+#define PADDING_KERNELS_HPP
+
+#include "../TypeDescriptor.hpp"
+#include "../util/Bitmap.hpp"
+#include "../util/StringArena.hpp"
+#include "../values/CompactString.hpp"
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace db::types {
+
+    // Relleno por lotes de CHAR(n)/NCHAR(n) sin un std::string por fila: cada
+    // valor se copia una vez y los espacios que faltan se escriben con un único
+    // memset, directamente en un buffer de columna del llamador o en una arena.
+    // Las filas que no caben se marcan en `invalid` (Bitmap::wordsFor(n)
+    // palabras) y se devuelve cuántas hay; nunca se lanza por fila.
+    class PaddingKernels {
+    public:
+        PaddingKernels() = delete;
+
+        // Bytes por hueco: n en CHAR(n) y n * MAX_UTF8_BYTES_PER_CHAR en NCHAR(n).
+        // Lanza si el descriptor no es CHAR ni NCHAR.
+        static size_t slotWidth(const TypeDescriptor& type);
+
+        // La fila i ocupa out[i * slotWidth(type)...] y lengths[i] bytes de ese hueco
+        // (siempre n en CHAR); el resto del hueco no se toca. Una fila inválida deja
+        // longitud 0. Lanza una sola vez si `out` o `lengths` se quedan cortos.
+        static size_t padToSlots(const TypeDescriptor& type, std::span<const std::string_view> values,
+                                 std::span<char> out, std::span<uint32_t> lengths, std::span<uint64_t> invalid);
+
+        // Cada valor rellenado se reserva justo en `arena`; out[i] queda vacío si la
+        // fila no es válida y vive mientras la arena no se reinicie.
+        static size_t padToArena(const TypeDescriptor& type, std::span<const std::string_view> values,
+                                 StringArena& arena, std::span<std::string_view> out,
+                                 std::span<uint64_t> invalid);
+
+        // Carga en forma recortada: valida igual que arriba, quita el relleno final
+        // y deja cada valor en un CompactString (en línea hasta 12 bytes, si no en
+        // `arena`). La longitud declarada la sigue dando el tipo.
+        static size_t trimToCompact(const TypeDescriptor& type, std::span<const std::string_view> values,
+                                    StringArena& arena, std::span<CompactString> out,
+                                    std::span<uint64_t> invalid);
+
+        // Lectura de lo que guardó trimToCompact (o tryMakeValue del tipo): mismos
+        // huecos que padToSlots sin volver a validar el UTF-8. Un valor que no cabe
+        // (de una columna más ancha) se marca en `invalid` como arriba.
+        static size_t padToSlots(const TypeDescriptor& type, std::span<const CompactString> stored,
+                                 std::span<char> out, std::span<uint32_t> lengths, std::span<uint64_t> invalid);
+    };
+
+} // namespace db::types
+
+#endif // PADDING_KERNELS_HPP
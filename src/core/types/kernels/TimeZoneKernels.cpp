@@ -0,0 +1,59 @@
+// src/core/types/kernels/TimeZoneKernels.cpp
+#include "TimeZoneKernels.hpp"
+
+namespace db::types {
+
+    namespace {
+        class IntervalCursor {
+        public:
+            explicit IntervalCursor(const TimeZone& zone) noexcept
+                : zone(zone), interval{1, 1, 0} {}
+
+            [[nodiscard]] int offsetAt(int64_t utcSeconds) noexcept {
+                if (!interval.contains(utcSeconds)) {
+                    interval = zone.intervalAt(utcSeconds);
+                }
+                return interval.offsetMinutes;
+            }
+
+        private:
+            const TimeZone& zone;
+            TimeZone::Interval interval;
+        };
+
+        void checkSizes(size_t input, size_t output) {
+            if (output < input) {
+                throw DataTypeException("Output span is smaller than input");
+            }
+        }
+    } // namespace
+
+    void TimeZoneKernels::toLocalSeconds(const TimeZone& zone, std::span<const int64_t> utcSeconds,
+                                         std::span<int64_t> localSeconds) {
+        checkSizes(utcSeconds.size(), localSeconds.size());
+        IntervalCursor cursor(zone);
+        for (size_t i = 0; i < utcSeconds.size(); ++i) {
+            localSeconds[i] = utcSeconds[i] + cursor.offsetAt(utcSeconds[i]) * int64_t{60};
+        }
+    }
+
+    void TimeZoneKernels::atTimeZone(const TimeZone& zone, std::span<const TimestampValue> values,
+                                     std::span<TimestampValue> out) {
+        checkSizes(values.size(), out.size());
+        IntervalCursor cursor(zone);
+        for (size_t i = 0; i < values.size(); ++i) {
+            out[i] = values[i].atOffset(cursor.offsetAt(values[i].getUtcSeconds()), zone.getId());
+        }
+    }
+
+    void TimeZoneKernels::toLocalDates(const TimeZone& zone, std::span<const TimestampValue> values,
+                                       std::span<DateValue> out) {
+        checkSizes(values.size(), out.size());
+        IntervalCursor cursor(zone);
+        for (size_t i = 0; i < values.size(); ++i) {
+            const int64_t utc = values[i].getUtcSeconds();
+            out[i] = DateValue{utc + cursor.offsetAt(utc) * int64_t{60}};
+        }
+    }
+
+} // namespace db::types
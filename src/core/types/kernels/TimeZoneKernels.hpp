@@ -0,0 +1,35 @@
+// src/core/types/kernels/TimeZoneKernels.hpp
+#ifndef TIME_ZONE_KERNELS_HPP
+#define TIME_ZONE_KERNELS_HPP
+
+#include "../util/TimeZone.hpp"
+#include "../values/DateValue.hpp"
+#include "../values/TimestampValue.hpp"
+#include <cstdint>
+#include <span>
+
+namespace db::types {
+
+    // Conversión por columnas de instantes UTC a la hora local de una región. Se
+    // recuerda el tramo sin transiciones de la fila anterior, así que en columnas
+    // de fechas cercanas cada fila es una comparación y una suma; solo al cruzar un
+    // cambio de hora se busca en la tabla de transiciones de la zona.
+    class TimeZoneKernels {
+    public:
+        TimeZoneKernels() = delete;
+
+        static void toLocalSeconds(const TimeZone& zone, std::span<const int64_t> utcSeconds,
+                                   std::span<int64_t> localSeconds);
+
+        // AT TIME ZONE: mismo instante con el desplazamiento y la región de `zone`
+        static void atTimeZone(const TimeZone& zone, std::span<const TimestampValue> values,
+                               std::span<TimestampValue> out);
+
+        // Hora local en `zone` truncada a DATE, p. ej. para la zona de la sesión
+        static void toLocalDates(const TimeZone& zone, std::span<const TimestampValue> values,
+                                 std::span<DateValue> out);
+    };
+
+} // namespace db::types
+
+#endif // TIME_ZONE_KERNELS_HPP
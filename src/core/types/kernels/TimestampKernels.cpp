@@ -0,0 +1,133 @@
+// src/core/types/kernels/TimestampKernels.cpp
+#include "TimestampKernels.hpp"
+#include <algorithm>
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace db::types {
+
+    namespace {
+        struct OrderMasks {
+            uint32_t less;
+            uint32_t greater;
+        };
+
+        // Sin saltos: primero segundos y, si empatan, nanosegundos
+        inline OrderMasks compareScalar(const TimestampValue& value, const TimestampValue& constant) noexcept {
+            const int64_t s = value.getUtcSeconds();
+            const int64_t ks = constant.getUtcSeconds();
+            const int32_t n = value.getNanos();
+            const int32_t kn = constant.getNanos();
+            return {static_cast<uint32_t>((s < ks) | ((s == ks) & (n < kn))),
+                    static_cast<uint32_t>((s > ks) | ((s == ks) & (n > kn)))};
+        }
+
+#if defined(__AVX2__)
+        // Cada registro lleva dos valores como [segundos, nanos|offset] por valor. La
+        // máscara deja sólo los nanosegundos en la palabra impar, que son siempre
+        // positivos y se comparan como int64. Devuelve un bit por valor.
+        struct PairComparator {
+            __m256i key;
+            __m256i nanosMask;
+
+            explicit PairComparator(const TimestampValue& constant) noexcept
+                : key(_mm256_setr_epi64x(constant.getUtcSeconds(), constant.getNanos(),
+                                         constant.getUtcSeconds(), constant.getNanos()))
+                , nanosMask(_mm256_setr_epi64x(-1, 0xFFFFFFFFLL, -1, 0xFFFFFFFFLL)) {}
+
+            [[nodiscard]] OrderMasks compare(const TimestampValue* pair) const noexcept {
+                const __m256i v = _mm256_and_si256(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pair)), nanosMask);
+                const auto gt = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(v, key))));
+                const auto lt = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(key, v))));
+                const auto eq = static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v, key))));
+                return {compress((lt | (eq & (lt >> 1))) & 0b0101), compress((gt | (eq & (gt >> 1))) & 0b0101)};
+            }
+
+            // Bits 0 y 2 (palabra de segundos de cada valor) a bits 0 y 1
+            static uint32_t compress(uint32_t mask) noexcept {
+                return (mask & 1u) | ((mask >> 1) & 2u);
+            }
+        };
+#endif
+    } // namespace
+
+    void TimestampKernels::compareBatch(std::span<const TimestampValue> values, const TimestampValue& constant,
+                                        std::span<int8_t> results) noexcept {
+        const size_t count = std::min(values.size(), results.size());
+        size_t i = 0;
+
+#if defined(__AVX2__)
+        const PairComparator comparator(constant);
+        for (; i + 2 <= count; i += 2) {
+            const OrderMasks masks = comparator.compare(values.data() + i);
+            results[i] = static_cast<int8_t>(static_cast<int>(masks.greater & 1u) - static_cast<int>(masks.less & 1u));
+            results[i + 1] = static_cast<int8_t>(static_cast<int>(masks.greater >> 1) - static_cast<int>(masks.less >> 1));
+        }
+#endif
+        for (; i < count; ++i) {
+            const OrderMasks masks = compareScalar(values[i], constant);
+            results[i] = static_cast<int8_t>(static_cast<int>(masks.greater) - static_cast<int>(masks.less));
+        }
+    }
+
+    Bitmap TimestampKernels::selectBetween(std::span<const TimestampValue> values,
+                                           const TimestampValue& low, const TimestampValue& high) {
+        Bitmap selected(values.size());
+        auto words = selected.words();
+        const size_t count = values.size();
+
+#if defined(__AVX2__)
+        const PairComparator lower(low);
+        const PairComparator upper(high);
+#endif
+        for (size_t base = 0; base < count; base += Bitmap::BITS_PER_WORD) {
+            const size_t end = std::min(count, base + Bitmap::BITS_PER_WORD);
+            uint64_t word = 0;
+            size_t i = base;
+#if defined(__AVX2__)
+            for (; i + 2 <= end; i += 2) {
+                const uint32_t outside = lower.compare(values.data() + i).less
+                                         | upper.compare(values.data() + i).greater;
+                word |= static_cast<uint64_t>(~outside & 0b11u) << (i - base);
+            }
+#endif
+            for (; i < end; ++i) {
+                const uint32_t outside = compareScalar(values[i], low).less | compareScalar(values[i], high).greater;
+                word |= static_cast<uint64_t>(outside ^ 1u) << (i - base);
+            }
+            words[base / Bitmap::BITS_PER_WORD] = word;
+        }
+        return selected;
+    }
+
+    size_t TimestampKernels::validate(const TimestampType& type, const TimestampFieldColumns<const int>& fields,
+                                      std::span<uint64_t> invalid, std::span<TimestampError> errors) noexcept {
+        const size_t count = fields.size();
+        const int precision = static_cast<int>(type.getPrecision());
+        const bool hasOffsets = !fields.tzOffset.empty();
+        // La presencia de zona es propiedad de la columna: se decide una vez, no por fila
+        const bool presenceMismatch = type.hasTimeZone() != hasOffsets;
+        size_t total = 0;
+        for (size_t base = 0; base < count; base += Bitmap::BITS_PER_WORD) {
+            const size_t end = std::min(count, base + Bitmap::BITS_PER_WORD);
+            uint64_t word = 0;
+            for (size_t i = base; i < end; ++i) {
+                TimestampError error = TimestampType::checkFields(
+                    precision, fields.year[i], fields.month[i], fields.day[i],
+                    fields.hour[i], fields.minute[i], fields.second[i], fields.fraction[i],
+                    hasOffsets ? fields.tzOffset[i] : 0);
+                error = presenceMismatch ? TimestampError::TIME_ZONE_PRESENCE : error;
+                errors[i] = error;
+                word |= static_cast<uint64_t>(error != TimestampError::NONE) << (i - base);
+            }
+            invalid[base / Bitmap::BITS_PER_WORD] = word;
+            total += static_cast<size_t>(std::popcount(word));
+        }
+        return total;
+    }
+
+} // namespace db::types
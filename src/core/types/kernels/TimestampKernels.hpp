@@ -0,0 +1,38 @@
+// src/core/types/kernels/TimestampKernels.hpp
+#ifndef TIMESTAMP_KERNELS_HPP
+#define TIMESTAMP_KERNELS_HPP
+
+#include "../values/TimestampValue.hpp"
+#include "../util/Bitmap.hpp"
+#include <cstdint>
+#include <span>
+
+namespace db::types {
+
+    // Comparación por lotes de columnas TIMESTAMP y TIMESTAMP WITH TIME ZONE.
+    // Ambas guardan el instante UTC en TimestampValue, así que el mismo kernel
+    // sirve para las dos y el desplazamiento no interviene en el orden.
+    class TimestampKernels {
+    public:
+        TimestampKernels() = delete;
+
+        // results[i] = -1, 0 o 1 según values[i] sea anterior, igual o posterior a constant
+        static void compareBatch(std::span<const TimestampValue> values, const TimestampValue& constant,
+                                 std::span<int8_t> results) noexcept;
+
+        [[nodiscard]] static Bitmap selectBetween(std::span<const TimestampValue> values,
+                                                  const TimestampValue& low, const TimestampValue& high);
+
+        // Valida filas de campos para `type` sin lanzar. Marca en `invalid` las filas
+        // rechazadas, escribe en `errors` el motivo de cada fila (NONE si es válida)
+        // y devuelve cuántas se rechazaron. `fields.tzOffset` debe estar vacío si el
+        // tipo no tiene zona horaria; si no coincide, todas las filas se rechazan.
+        // Como en DateKernels::findInvalid, `invalid` necesita Bitmap::wordsFor(n)
+        // palabras y `errors` n posiciones.
+        static size_t validate(const TimestampType& type, const TimestampFieldColumns<const int>& fields,
+                               std::span<uint64_t> invalid, std::span<TimestampError> errors) noexcept;
+    };
+
+} // namespace db::types
+
+#endif // TIMESTAMP_KERNELS_HPP
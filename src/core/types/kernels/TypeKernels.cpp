@@ -0,0 +1,59 @@
+// src/core/types/kernels/TypeKernels.cpp
+#include "TypeKernels.hpp"
+#include "NumberRangeKernels.hpp"
+#include "../TypeDispatch.hpp"
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <type_traits>
+
+namespace db::types {
+
+    namespace {
+        template<typename Type>
+        concept StringType = requires(const Type& type, std::string_view value) {
+            { type.isValidValue(value) } -> std::same_as<bool>;
+        };
+
+        // Se instancia una vez por tipo de cadena: isValidValue se inlinea en el bucle
+        template<StringType Type>
+        size_t findInvalidStrings(const Type& type, std::span<const std::string_view> values,
+                                  std::span<uint64_t> invalid) noexcept {
+            const size_t count = values.size();
+            size_t total = 0;
+            for (size_t base = 0; base < count; base += Bitmap::BITS_PER_WORD) {
+                const size_t end = std::min(count, base + Bitmap::BITS_PER_WORD);
+                uint64_t word = 0;
+                for (size_t i = base; i < end; ++i) {
+                    word |= static_cast<uint64_t>(!type.isValidValue(values[i])) << (i - base);
+                }
+                invalid[base / Bitmap::BITS_PER_WORD] = word;
+                total += static_cast<size_t>(std::popcount(word));
+            }
+            return total;
+        }
+    } // namespace
+
+    size_t TypeKernels::findInvalid(const TypeDescriptor& type, std::span<const std::string_view> values,
+                                    std::span<uint64_t> invalid) {
+        return dispatchType(type, [&](const auto& concrete) -> size_t {
+            if constexpr (StringType<std::decay_t<decltype(concrete)>>) {
+                return findInvalidStrings(concrete, values, invalid);
+            } else {
+                throw DataTypeException(concrete.getName() + " does not hold character data");
+            }
+        });
+    }
+
+    size_t TypeKernels::findInvalid(const TypeDescriptor& type, std::span<const double> values,
+                                    std::span<uint64_t> invalid) {
+        return dispatchType(type, [&](const auto& concrete) -> size_t {
+            if constexpr (std::is_same_v<std::decay_t<decltype(concrete)>, NumberType>) {
+                return NumberRangeKernels::findOutOfRange(concrete, values, invalid);
+            } else {
+                throw DataTypeException(concrete.getName() + " does not hold numeric data");
+            }
+        });
+    }
+
+} // namespace db::types
@@ -0,0 +1,32 @@
+// src/core/types/kernels/TypeKernels.hpp
+#ifndef TYPE_KERNELS_HPP
+#define TYPE_KERNELS_HPP
+
+#include "../TypeDescriptor.hpp"
+#include "../util/Bitmap.hpp"
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace db::types {
+
+    // Validación por lotes a partir de un TypeDescriptor: el tipo concreto se
+    // resuelve una vez por llamada (ver dispatchType) y el bucle usa sus métodos
+    // sin llamadas virtuales. `invalid` necesita Bitmap::wordsFor(n) palabras.
+    class TypeKernels {
+    public:
+        TypeKernels() = delete;
+
+        // Cadenas que no caben en VARCHAR2/CHAR/NCHAR/NVARCHAR2 (o UTF-8 mal formado en
+        // los nacionales). Lanza una sola vez si el descriptor no es de cadena.
+        static size_t findInvalid(const TypeDescriptor& type, std::span<const std::string_view> values,
+                                  std::span<uint64_t> invalid);
+
+        // Valores fuera del rango de un NUMBER(p,s); lanza si el descriptor no es NUMBER
+        static size_t findInvalid(const TypeDescriptor& type, std::span<const double> values,
+                                  std::span<uint64_t> invalid);
+    };
+
+} // namespace db::types
+
+#endif // TYPE_KERNELS_HPP
@@ -0,0 +1,244 @@
+// src/core/types/schema/StaticSchema.hpp
+#ifndef STATIC_SCHEMA_HPP
+#define STATIC_SCHEMA_HPP
+
+#include "TypeTraits.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <span>
+#include <string_view>
+#include <tuple>
+
+namespace db::types {
+
+    // Nombre de columna como parámetro de plantilla: Column<"amount", Number<10,2>>
+    template<size_t N>
+    struct ColumnName {
+        char value[N];
+
+        constexpr ColumnName(const char (&text)[N]) noexcept {
+            std::copy_n(text, N, value);
+        }
+
+        [[nodiscard]] constexpr std::string_view view() const noexcept { return {value, N - 1}; }
+    };
+
+    template<ColumnName Name, typename Type>
+    struct Column {
+        static constexpr std::string_view NAME = Name.view();
+        using Traits = TypeTraits<Type>;
+        using Storage = typename Traits::Storage;
+        using Value = typename Traits::Value;
+    };
+
+    // Esquema de una tabla conocido en compilación. La fila es un bloque de
+    // ROW_SIZE bytes: bitmap de nulos al principio y después cada columna en su
+    // desplazamiento, colocadas de mayor a menor alineación para no dejar huecos.
+    // Desplazamientos, tamaños, descriptores y comparadores se resuelven en
+    // compilación, así que insertar una fila no interpreta tipos en ejecución.
+    template<typename... Columns>
+    class StaticSchema {
+    public:
+        static constexpr size_t COLUMN_COUNT = sizeof...(Columns);
+        static_assert(COLUMN_COUNT > 0, "A schema needs at least one column");
+
+        template<size_t I>
+        using ColumnAt = std::tuple_element_t<I, std::tuple<Columns...>>;
+        template<size_t I>
+        using StorageAt = typename ColumnAt<I>::Storage;
+        template<size_t I>
+        using ValueAt = typename ColumnAt<I>::Value;
+
+        static constexpr std::array<std::string_view, COLUMN_COUNT> NAMES = {Columns::NAME...};
+        static constexpr std::array<TypeDescriptor, COLUMN_COUNT> DESCRIPTORS = {Columns::Traits::DESCRIPTOR...};
+        static constexpr std::array<size_t, COLUMN_COUNT> SIZES = {sizeof(typename Columns::Storage)...};
+        static constexpr std::array<size_t, COLUMN_COUNT> ALIGNMENTS = {alignof(typename Columns::Storage)...};
+
+        static constexpr size_t NULL_BITMAP_OFFSET = 0;
+        static constexpr size_t NULL_BITMAP_SIZE = (COLUMN_COUNT + 7) / 8;
+        static constexpr size_t ALIGNMENT = std::max({alignof(typename Columns::Storage)...});
+
+    private:
+        static constexpr size_t alignUp(size_t offset, size_t alignment) noexcept {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+
+        struct Layout {
+            std::array<size_t, COLUMN_COUNT> offsets{};
+            size_t end = 0;
+        };
+
+        static constexpr Layout computeLayout() noexcept {
+            // Inserción estable por alineación descendente (std::stable_sort no es constexpr)
+            std::array<size_t, COLUMN_COUNT> order{};
+            for (size_t i = 0; i < COLUMN_COUNT; ++i) {
+                size_t j = i;
+                for (; j > 0 && ALIGNMENTS[order[j - 1]] < ALIGNMENTS[i]; --j) {
+                    order[j] = order[j - 1];
+                }
+                order[j] = i;
+            }
+            Layout layout;
+            size_t offset = NULL_BITMAP_OFFSET + NULL_BITMAP_SIZE;
+            for (const size_t column : order) {
+                offset = alignUp(offset, ALIGNMENTS[column]);
+                layout.offsets[column] = offset;
+                offset += SIZES[column];
+            }
+            layout.end = offset;
+            return layout;
+        }
+
+        static constexpr Layout LAYOUT = computeLayout();
+
+    public:
+        static constexpr std::array<size_t, COLUMN_COUNT> OFFSETS = LAYOUT.offsets;
+        static constexpr size_t ROW_SIZE = alignUp(LAYOUT.end, ALIGNMENT);
+
+        template<ColumnName Name>
+        static constexpr size_t indexOf() noexcept {
+            constexpr size_t index = [] {
+                for (size_t i = 0; i < COLUMN_COUNT; ++i) {
+                    if (NAMES[i] == Name.view()) {
+                        return i;
+                    }
+                }
+                return COLUMN_COUNT;
+            }();
+            static_assert(index < COLUMN_COUNT, "Unknown column name");
+            return index;
+        }
+
+        // Fila empaquetada; recién creada tiene todas las columnas a NULL
+        class Row {
+        public:
+            Row() noexcept {
+                for (size_t i = 0; i < COLUMN_COUNT; ++i) {
+                    bytes[NULL_BITMAP_OFFSET + i / 8] |= static_cast<std::byte>(1u << (i % 8));
+                }
+            }
+
+            template<size_t I>
+            [[nodiscard]] bool isNull() const noexcept {
+                static_assert(I < COLUMN_COUNT);
+                return (bytes[NULL_BITMAP_OFFSET + I / 8] & static_cast<std::byte>(1u << (I % 8))) != std::byte{0};
+            }
+
+            template<size_t I>
+            void setNull() noexcept {
+                static_assert(I < COLUMN_COUNT);
+                bytes[NULL_BITMAP_OFFSET + I / 8] |= static_cast<std::byte>(1u << (I % 8));
+            }
+
+            // Representación guardada; sin sentido si la columna es NULL
+            template<size_t I>
+            [[nodiscard]] const StorageAt<I>& getStored() const noexcept {
+                return *std::launder(reinterpret_cast<const StorageAt<I>*>(bytes.data() + OFFSETS[I]));
+            }
+
+            template<size_t I>
+            void setStored(const StorageAt<I>& stored) noexcept {
+                std::memcpy(bytes.data() + OFFSETS[I], &stored, sizeof(StorageAt<I>));
+                bytes[NULL_BITMAP_OFFSET + I / 8] &= ~static_cast<std::byte>(1u << (I % 8));
+            }
+
+            template<size_t I>
+            [[nodiscard]] ValueAt<I> get() const {
+                return ColumnAt<I>::Traits::decode(getStored<I>());
+            }
+
+            // Valida con los límites del tipo; la fila no cambia si hay error
+            template<size_t I>
+            Expected<void> trySet(const ValueAt<I>& value) {
+                const auto stored = ColumnAt<I>::Traits::encode(value);
+                if (!stored) {
+                    return stored.error();
+                }
+                setStored<I>(*stored);
+                return {};
+            }
+
+            template<size_t I>
+            void set(const ValueAt<I>& value) {
+                trySet<I>(value).value();
+            }
+
+            template<ColumnName Name>
+            [[nodiscard]] bool isNull() const noexcept { return isNull<indexOf<Name>()>(); }
+            template<ColumnName Name>
+            void setNull() noexcept { setNull<indexOf<Name>()>(); }
+            template<ColumnName Name>
+            [[nodiscard]] auto get() const { return get<indexOf<Name>()>(); }
+            template<ColumnName Name>
+            Expected<void> trySet(const ValueAt<indexOf<Name>()>& value) { return trySet<indexOf<Name>()>(value); }
+            template<ColumnName Name>
+            void set(const ValueAt<indexOf<Name>()>& value) { set<indexOf<Name>()>(value); }
+
+            [[nodiscard]] std::span<const std::byte, ROW_SIZE> data() const noexcept { return bytes; }
+
+        private:
+            alignas(ALIGNMENT) std::array<std::byte, ROW_SIZE> bytes{};
+        };
+
+        static_assert(sizeof(Row) == ROW_SIZE);
+
+        // Orden de la columna I con los NULL al final, como ORDER BY ... ASC
+        template<size_t I>
+        [[nodiscard]] static int compare(const Row& a, const Row& b) noexcept {
+            const bool aNull = a.template isNull<I>();
+            const bool bNull = b.template isNull<I>();
+            if (aNull || bNull) {
+                return static_cast<int>(aNull) - static_cast<int>(bNull);
+            }
+            return ColumnAt<I>::Traits::compare(a.template getStored<I>(), b.template getStored<I>());
+        }
+
+        // Compara columna a columna en el orden del esquema
+        [[nodiscard]] static int compare(const Row& a, const Row& b) noexcept {
+            return compareFrom<0>(a, b);
+        }
+
+        // La fila ya está en su formato de disco: codificar es copiar ROW_SIZE bytes
+        static void encode(const Row& row, std::span<std::byte> out) {
+            if (out.size() < ROW_SIZE) {
+                throw DataTypeException("Output span is smaller than row size");
+            }
+            std::memcpy(out.data(), row.data().data(), ROW_SIZE);
+        }
+
+        static void encodeBatch(std::span<const Row> rows, std::span<std::byte> out) {
+            if (out.size() < rows.size() * ROW_SIZE) {
+                throw DataTypeException("Output span is smaller than input");
+            }
+            for (size_t i = 0; i < rows.size(); ++i) {
+                std::memcpy(out.data() + i * ROW_SIZE, rows[i].data().data(), ROW_SIZE);
+            }
+        }
+
+        [[nodiscard]] static Row decode(std::span<const std::byte> in) {
+            if (in.size() < ROW_SIZE) {
+                throw DataTypeException("Input span is smaller than row size");
+            }
+            Row row;
+            std::memcpy(static_cast<void*>(&row), in.data(), ROW_SIZE);
+            return row;
+        }
+
+    private:
+        template<size_t I>
+        static int compareFrom(const Row& a, const Row& b) noexcept {
+            if constexpr (I == COLUMN_COUNT) {
+                return 0;
+            } else {
+                const int order = compare<I>(a, b);
+                return order != 0 ? order : compareFrom<I + 1>(a, b);
+            }
+        }
+    };
+
+} // namespace db::types
+
+#endif // STATIC_SCHEMA_HPP
@@ -0,0 +1,286 @@
+// src/core/types/schema/TypeTraits.hpp
+#ifndef TYPE_TRAITS_HPP
+#define TYPE_TRAITS_HPP
+
+#include "../NumberType.hpp"
+#include "../Varchar2Type.hpp"
+#include "../CharType.hpp"
+#include "../NCharType.hpp"
+#include "../NVarchar2Type.hpp"
+#include "../TypeDescriptor.hpp"
+#include "../PhysicalWidth.hpp"
+#include "../util/BlankPadding.hpp"
+#include "../util/Expected.hpp"
+#include "../util/TimeZone.hpp"
+#include "../util/Utf8.hpp"
+#include "../values/NumberValue.hpp"
+#include "../values/DateValue.hpp"
+#include "../values/TimestampValue.hpp"
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace db::types {
+
+    // Tipos de columna conocidos en compilación. Los límites se comprueban con las
+    // mismas funciones constexpr que usan los constructores de cada DataType.
+    template<size_t P, size_t S = 0>
+    struct Number {
+        static_assert(NumberType::checkPrecisionScale(P, S).hasValue(), "Invalid NUMBER(p,s)");
+    };
+    template<size_t N>
+    struct Varchar2 {
+        static_assert(Varchar2Type::checkLength(N).hasValue(), "Invalid VARCHAR2 length");
+    };
+    template<size_t N = 1>
+    struct Char {
+        static_assert(CharType::checkLength(N).hasValue(), "Invalid CHAR length");
+    };
+    template<size_t N = 1>
+    struct NChar {
+        static_assert(NCharType::checkLength(N).hasValue(), "Invalid NCHAR length");
+    };
+    template<size_t N>
+    struct NVarchar2 {
+        static_assert(NVarchar2Type::checkLength(N).hasValue(), "Invalid NVARCHAR2 length");
+    };
+    struct Date {};
+    template<int P = 6, bool WithTimeZone = false>
+    struct Timestamp {
+        static_assert(P >= 0 && P <= TimestampType::MAX_PRECISION, "Invalid TIMESTAMP precision");
+    };
+    template<int P = 6>
+    using TimestampTZ = Timestamp<P, true>;
+
+    // Cadena de longitud variable guardada en línea: hasta Capacity bytes
+    template<size_t Capacity>
+    struct InlineString {
+        uint16_t length;
+        char data[Capacity];
+
+        [[nodiscard]] constexpr std::string_view view() const noexcept { return {data, length}; }
+    };
+
+    // Cadena de longitud fija ya rellenada con espacios
+    template<size_t N>
+    struct PaddedString {
+        char data[N];
+
+        [[nodiscard]] constexpr std::string_view view() const noexcept { return {data, N}; }
+    };
+
+    // Lo que el esquema estático necesita de cada tipo de columna:
+    //   Storage      representación en la fila (trivialmente copiable)
+    //   Value        forma de entrada y salida (NumberValue, string_view...)
+    //   DESCRIPTOR   TypeDescriptor equivalente
+    //   encode       Value -> Storage validando los límites del tipo, sin lanzar
+    //   decode       Storage -> Value
+    //   compare      orden del tipo sobre Storage: -1, 0 o 1
+    template<typename Type>
+    struct TypeTraits;
+
+    template<size_t P, size_t S>
+    struct TypeTraits<Number<P, S>> {
+        static constexpr PhysicalLayout LAYOUT = makePhysicalLayout(P, S);
+        using Storage = physical_storage_t<LAYOUT.width>;
+        using Value = NumberValue;
+        static constexpr TypeDescriptor DESCRIPTOR = TypeDescriptor::number(P, S);
+
+        static Expected<Storage> encode(const NumberValue& value) {
+            const NumberType type(true, P, S);
+            if (!value.fitsIn(type)) {
+                return TypeError(TypeErrorCode::VALUE_OUT_OF_RANGE);
+            }
+            const NumberValue scaled = value.coerceTo(type);
+            const auto magnitude = static_cast<int128_t>(scaled.getCoefficient());
+            return static_cast<Storage>(scaled.isNegative() ? -magnitude : magnitude);
+        }
+
+        static NumberValue decode(const Storage& stored) {
+            const auto value = static_cast<int128_t>(stored);
+            return NumberValue::fromScaled(absoluteValue(value), S, value < 0);
+        }
+
+        // Misma escala en toda la columna: el orden es el de los enteros
+        static constexpr int compare(const Storage& a, const Storage& b) noexcept {
+            return (a > b) - (a < b);
+        }
+    };
+
+    namespace detail {
+        template<typename Storage>
+        constexpr int compareViews(const Storage& a, const Storage& b) noexcept {
+            const int order = a.view().compare(b.view());
+            return (order > 0) - (order < 0);
+        }
+
+        template<size_t Capacity>
+        InlineString<Capacity> copyInline(std::string_view value) noexcept {
+            InlineString<Capacity> stored{};
+            stored.length = static_cast<uint16_t>(value.size());
+            std::memcpy(stored.data, value.data(), value.size());
+            return stored;
+        }
+    } // namespace detail
+
+    template<size_t N>
+    struct TypeTraits<Varchar2<N>> {
+        using Storage = InlineString<N>;
+        using Value = std::string_view;
+        static constexpr TypeDescriptor DESCRIPTOR = TypeDescriptor::varchar2(N);
+
+        static Expected<Storage> encode(std::string_view value) noexcept {
+            if (value.size() > N) {
+                return TypeError(TypeErrorCode::VALUE_TOO_LONG, N);
+            }
+            return detail::copyInline<N>(value);
+        }
+
+        static std::string_view decode(const Storage& stored) noexcept { return stored.view(); }
+
+        static constexpr int compare(const Storage& a, const Storage& b) noexcept {
+            return detail::compareViews(a, b);
+        }
+    };
+
+    template<size_t N>
+    struct TypeTraits<Char<N>> {
+        using Storage = PaddedString<N>;
+        using Value = std::string_view;
+        static constexpr TypeDescriptor DESCRIPTOR = TypeDescriptor::charType(N);
+
+        static Expected<Storage> encode(std::string_view value) noexcept {
+            if (value.size() > N) {
+                return TypeError(TypeErrorCode::VALUE_TOO_LONG, N);
+            }
+            Storage stored;
+            std::memcpy(stored.data, value.data(), value.size());
+            std::memset(stored.data + value.size(), CharType::PADDING_CHAR, N - value.size());
+            return stored;
+        }
+
+        static std::string_view decode(const Storage& stored) noexcept { return stored.view(); }
+
+        // Ambos lados tienen el mismo relleno, así que basta comparar los bytes
+        static int compare(const Storage& a, const Storage& b) noexcept {
+            const int order = std::memcmp(a.data, b.data, N);
+            return (order > 0) - (order < 0);
+        }
+    };
+
+    template<size_t N>
+    struct TypeTraits<NChar<N>> {
+        using Storage = InlineString<N * MAX_UTF8_BYTES_PER_CHAR>;
+        using Value = std::string_view;
+        static constexpr TypeDescriptor DESCRIPTOR = TypeDescriptor::nchar(N);
+
+        static Expected<Storage> encode(std::string_view value) noexcept {
+            const Utf8Validation utf8 = validateUtf8(value);
+            if (!utf8.valid) {
+                return TypeError(TypeErrorCode::INVALID_UTF8, static_cast<uint32_t>(utf8.errorOffset));
+            }
+            if (utf8.codePoints > N) {
+                return TypeError(TypeErrorCode::VALUE_TOO_MANY_CHARACTERS, N);
+            }
+            Storage stored = detail::copyInline<N * MAX_UTF8_BYTES_PER_CHAR>(value);
+            const size_t padding = N - utf8.codePoints;
+            std::memset(stored.data + value.size(), ' ', padding);
+            stored.length = static_cast<uint16_t>(value.size() + padding);
+            return stored;
+        }
+
+        static std::string_view decode(const Storage& stored) noexcept { return stored.view(); }
+
+        // UTF-8 conserva el orden de los puntos de código; el relleno no cuenta
+        static int compare(const Storage& a, const Storage& b) noexcept {
+            return compareBlankPadded(a.view(), b.view(), ' ');
+        }
+    };
+
+    template<size_t N>
+    struct TypeTraits<NVarchar2<N>> {
+        using Storage = InlineString<N * MAX_UTF8_BYTES_PER_CHAR>;
+        using Value = std::string_view;
+        static constexpr TypeDescriptor DESCRIPTOR = TypeDescriptor::nvarchar2(N);
+
+        static Expected<Storage> encode(std::string_view value) noexcept {
+            const Utf8Validation utf8 = validateUtf8(value);
+            if (!utf8.valid) {
+                return TypeError(TypeErrorCode::INVALID_UTF8, static_cast<uint32_t>(utf8.errorOffset));
+            }
+            if (utf8.codePoints > N) {
+                return TypeError(TypeErrorCode::VALUE_TOO_MANY_CHARACTERS, N);
+            }
+            return detail::copyInline<N * MAX_UTF8_BYTES_PER_CHAR>(value);
+        }
+
+        static std::string_view decode(const Storage& stored) noexcept { return stored.view(); }
+
+        static constexpr int compare(const Storage& a, const Storage& b) noexcept {
+            return detail::compareViews(a, b);
+        }
+    };
+
+    template<>
+    struct TypeTraits<Date> {
+        using Storage = DateValue;
+        using Value = DateValue;
+        static constexpr TypeDescriptor DESCRIPTOR = TypeDescriptor::date();
+
+        static constexpr Expected<Storage> encode(const DateValue& value) noexcept {
+            if (!value.isInRange()) {
+                return TypeError(TypeErrorCode::INVALID_DATE);
+            }
+            return value;
+        }
+
+        static constexpr DateValue decode(const Storage& stored) noexcept { return stored; }
+
+        static constexpr int compare(const Storage& a, const Storage& b) noexcept {
+            return (a > b) - (a < b);
+        }
+    };
+
+    template<int P, bool WithTimeZone>
+    struct TypeTraits<Timestamp<P, WithTimeZone>> {
+        using Storage = TimestampValue;
+        using Value = TimestampValue;
+        static constexpr TypeDescriptor DESCRIPTOR = TypeDescriptor::timestamp(P, WithTimeZone);
+
+        // Primer y último segundo local con año en [MIN_YEAR, MAX_YEAR]
+        static constexpr int64_t MIN_LOCAL_SECONDS = daysFromCivil(TimestampType::MIN_YEAR, 1, 1) * SECONDS_PER_DAY;
+        static constexpr int64_t MAX_LOCAL_SECONDS =
+            daysFromCivil(TimestampType::MAX_YEAR + 1, 1, 1) * SECONDS_PER_DAY - 1;
+
+        // Sin zona sólo se admite el desplazamiento 0 sin región; el año local debe
+        // estar en rango y los nanosegundos caber en la precisión de la columna
+        static constexpr Expected<Storage> encode(const TimestampValue& value) noexcept {
+            if (!WithTimeZone
+                && (value.getOffsetMinutes() != 0 || value.getZoneId() != TimeZone::FIXED_OFFSET_ID)) {
+                return invalid(TimestampError::TIME_ZONE_PRESENCE);
+            }
+            const int64_t local = value.getUtcSeconds() + value.getOffsetMinutes() * int64_t{60};
+            if (local < MIN_LOCAL_SECONDS || local > MAX_LOCAL_SECONDS) {
+                return invalid(TimestampError::YEAR);
+            }
+            if (value.getNanos() % static_cast<int32_t>(POW10_I64[TimestampType::MAX_PRECISION - P]) != 0) {
+                return invalid(TimestampError::FRACTION);
+            }
+            return value;
+        }
+
+        static constexpr TimestampValue decode(const Storage& stored) noexcept { return stored; }
+
+        static constexpr int compare(const Storage& a, const Storage& b) noexcept {
+            return (a > b) - (a < b);
+        }
+
+    private:
+        static constexpr TypeError invalid(TimestampError reason) noexcept {
+            return TypeError(TypeErrorCode::INVALID_TIMESTAMP, 0, static_cast<uint8_t>(reason));
+        }
+    };
+
+} // namespace db::types
+
+#endif // TYPE_TRAITS_HPP
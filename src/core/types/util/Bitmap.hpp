@@ -0,0 +1,86 @@
+// src/core/types/util/Bitmap.hpp
+#ifndef BITMAP_HPP
+#define BITMAP_HPP
+
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace db::types {
+
+    // Bitmap de tamaño fijo en palabras de 64 bits, pensado para resultados de
+    // kernels por lotes (valores inválidos, filas seleccionadas, nulos...).
+    class Bitmap {
+    public:
+        static constexpr size_t BITS_PER_WORD = 64;
+
+        Bitmap() = default;
+
+        explicit Bitmap(size_t length, bool value = false)
+            : bits(wordsFor(length), value ? ~uint64_t{0} : 0), length(length) {
+            clearTail();
+        }
+
+        [[nodiscard]] static constexpr size_t wordsFor(size_t length) noexcept {
+            return (length + BITS_PER_WORD - 1) / BITS_PER_WORD;
+        }
+
+        [[nodiscard]] size_t size() const noexcept { return length; }
+
+        [[nodiscard]] bool test(size_t index) const noexcept {
+            return (bits[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1;
+        }
+
+        void set(size_t index, bool value = true) noexcept {
+            const uint64_t mask = uint64_t{1} << (index % BITS_PER_WORD);
+            if (value) {
+                bits[index / BITS_PER_WORD] |= mask;
+            } else {
+                bits[index / BITS_PER_WORD] &= ~mask;
+            }
+        }
+
+        [[nodiscard]] size_t count() const noexcept {
+            size_t total = 0;
+            for (const uint64_t word : bits) {
+                total += static_cast<size_t>(std::popcount(word));
+            }
+            return total;
+        }
+
+        [[nodiscard]] bool none() const noexcept { return count() == 0; }
+        [[nodiscard]] bool any() const noexcept { return !none(); }
+
+        [[nodiscard]] std::span<uint64_t> words() noexcept { return bits; }
+        [[nodiscard]] std::span<const uint64_t> words() const noexcept { return bits; }
+
+        // Índices de los bits activos, en orden (vector de selección)
+        [[nodiscard]] std::vector<uint32_t> toSelection() const {
+            std::vector<uint32_t> selection;
+            selection.reserve(count());
+            for (size_t w = 0; w < bits.size(); ++w) {
+                uint64_t word = bits[w];
+                while (word != 0) {
+                    const auto bit = static_cast<size_t>(std::countr_zero(word));
+                    selection.push_back(static_cast<uint32_t>(w * BITS_PER_WORD + bit));
+                    word &= word - 1;
+                }
+            }
+            return selection;
+        }
+
+    private:
+        void clearTail() noexcept {
+            if (length % BITS_PER_WORD != 0) {
+                bits.back() &= (uint64_t{1} << (length % BITS_PER_WORD)) - 1;
+            }
+        }
+
+        std::vector<uint64_t> bits;
+        size_t length = 0;
+    };
+
+} // namespace db::types
+
+#endif // BITMAP_HPP
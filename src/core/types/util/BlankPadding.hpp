@@ -0,0 +1,82 @@
+// src/core/types/util/BlankPadding.hpp
+#ifndef BLANK_PADDING_HPP
+#define BLANK_PADDING_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace db::types {
+
+    // Longitud sin los espacios finales de relleno. Recorre desde el final en
+    // bloques de 16 bytes con SSE2, que es donde se acumula el relleno de CHAR(n).
+    [[nodiscard]] inline size_t trimmedLength(const char* data, size_t length, char pad = ' ') noexcept {
+#if defined(__SSE2__)
+        const __m128i padding = _mm_set1_epi8(pad);
+        while (length >= 16) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + length - 16));
+            const auto notPadding = static_cast<uint32_t>(~_mm_movemask_epi8(_mm_cmpeq_epi8(block, padding)) & 0xFFFF);
+            if (notPadding != 0) {
+                // Posición del último byte que no es relleno dentro del bloque
+                return length - 16 + static_cast<size_t>(31 - std::countl_zero(notPadding)) + 1;
+            }
+            length -= 16;
+        }
+#else
+        // Sin SSE2 se comparan 8 bytes de golpe
+        uint64_t padWord;
+        std::memset(&padWord, pad, sizeof(padWord));
+        while (length >= 8) {
+            uint64_t word;
+            std::memcpy(&word, data + length - 8, sizeof(word));
+            if (word != padWord) {
+                break;
+            }
+            length -= 8;
+        }
+#endif
+        while (length > 0 && data[length - 1] == pad) {
+            --length;
+        }
+        return length;
+    }
+
+    [[nodiscard]] inline std::string_view trimPadding(std::string_view value, char pad = ' ') noexcept {
+        return value.substr(0, trimmedLength(value.data(), value.size(), pad));
+    }
+
+    // Comparación con semántica de relleno en blanco: la cadena más corta se
+    // compara como si estuviera rellenada con `pad`. Devuelve -1, 0 o 1.
+    [[nodiscard]] inline int compareBlankPadded(std::string_view a, std::string_view b, char pad = ' ') noexcept {
+        a = trimPadding(a, pad);
+        b = trimPadding(b, pad);
+        const size_t common = a.size() < b.size() ? a.size() : b.size();
+        if (common > 0) {
+            const int prefix = std::memcmp(a.data(), b.data(), common);
+            if (prefix != 0) {
+                return prefix < 0 ? -1 : 1;
+            }
+        }
+        if (a.size() == b.size()) {
+            return 0;
+        }
+        // El resto de la más larga se compara contra el relleno implícito de la otra
+        const std::string_view rest = a.size() > b.size() ? a.substr(common) : b.substr(common);
+        const int sign = a.size() > b.size() ? 1 : -1;
+        for (const char c : rest) {
+            if (c != pad) {
+                return static_cast<unsigned char>(c) < static_cast<unsigned char>(pad) ? -sign : sign;
+            }
+        }
+        return 0;
+    }
+
+} // namespace db::types
+
+#endif // BLANK_PADDING_HPP
@@ -0,0 +1,70 @@
+// src/core/types/util/CivilCalendar.hpp
+#ifndef CIVIL_CALENDAR_HPP
+#define CIVIL_CALENDAR_HPP
+
+#include <cstdint>
+
+namespace db::types {
+
+    // Calendario gregoriano proléptico con años astronómicos (año 0 = 1 BC),
+    // igual que std::chrono. Algoritmos days_from_civil/civil_from_days de
+    // Howard Hinnant; los años se desplazan 4800 (múltiplo de 400) para que
+    // las eras sean siempre positivas y no haga falta ramificar por el signo.
+    inline constexpr int64_t SECONDS_PER_DAY = 86400;
+
+    struct CivilDate {
+        int year;
+        int month;
+        int day;
+    };
+
+    namespace detail {
+        inline constexpr int64_t CIVIL_YEAR_SHIFT = 4800;
+        inline constexpr int64_t CIVIL_DAY_SHIFT = CIVIL_YEAR_SHIFT / 400 * 146097;
+    }
+
+    [[nodiscard]] constexpr bool isLeapYear(int64_t year) noexcept {
+        return (year % 4 == 0) & ((year % 100 != 0) | (year % 400 == 0));
+    }
+
+    [[nodiscard]] constexpr int daysInMonth(int64_t year, int month) noexcept {
+        return month == 2 ? 28 + static_cast<int>(isLeapYear(year)) : 30 + ((month + (month >> 3)) & 1);
+    }
+
+    // Días desde 1970-01-01. Válido para años >= -4799.
+    [[nodiscard]] constexpr int64_t daysFromCivil(int64_t year, int month, int day) noexcept {
+        const int64_t y = year + detail::CIVIL_YEAR_SHIFT - (month <= 2);
+        const int64_t era = y / 400;
+        const int64_t yearOfEra = y - era * 400;
+        const int64_t shiftedMonth = month + (month > 2 ? -3 : 9);
+        const int64_t dayOfYear = (153 * shiftedMonth + 2) / 5 + day - 1;
+        const int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+        return era * 146097 + dayOfEra - 719468 - detail::CIVIL_DAY_SHIFT;
+    }
+
+    [[nodiscard]] constexpr CivilDate civilFromDays(int64_t days) noexcept {
+        const int64_t z = days + 719468 + detail::CIVIL_DAY_SHIFT;
+        const int64_t era = z / 146097;
+        const int64_t dayOfEra = z - era * 146097;
+        const int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+        const int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+        const int64_t shiftedMonth = (5 * dayOfYear + 2) / 153;
+        const int64_t day = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1;
+        const int64_t month = shiftedMonth + (shiftedMonth < 10 ? 3 : -9);
+        const int64_t year = yearOfEra + era * 400 - detail::CIVIL_YEAR_SHIFT + (month <= 2);
+        return {static_cast<int>(year), static_cast<int>(month), static_cast<int>(day)};
+    }
+
+    // División entera hacia -infinito, para separar días y segundos de instantes negativos
+    [[nodiscard]] constexpr int64_t floorDiv(int64_t value, int64_t divisor) noexcept {
+        const int64_t quotient = value / divisor;
+        return quotient - ((value % divisor != 0) & ((value < 0) != (divisor < 0)));
+    }
+
+    [[nodiscard]] constexpr int64_t floorMod(int64_t value, int64_t divisor) noexcept {
+        return value - floorDiv(value, divisor) * divisor;
+    }
+
+} // namespace db::types
+
+#endif // CIVIL_CALENDAR_HPP
@@ -0,0 +1,60 @@
+// src/core/types/util/DigitWriter.hpp
+#ifndef DIGIT_WRITER_HPP
+#define DIGIT_WRITER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace db::types {
+
+    namespace detail {
+        constexpr std::array<char, 200> makeDigitPairs() noexcept {
+            std::array<char, 200> pairs{};
+            for (int i = 0; i < 100; ++i) {
+                pairs[2 * i] = static_cast<char>('0' + i / 10);
+                pairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+            }
+            return pairs;
+        }
+    } // namespace detail
+
+    // "00".."99" contiguos: cada par de dígitos se copia con una sola carga
+    inline constexpr auto DIGIT_PAIRS = detail::makeDigitPairs();
+
+    // Escribe value (< 100) con dos dígitos y devuelve el final
+    inline char* writeTwoDigits(char* out, uint32_t value) noexcept {
+        out[0] = DIGIT_PAIRS[2 * value];
+        out[1] = DIGIT_PAIRS[2 * value + 1];
+        return out + 2;
+    }
+
+    // Escribe value en decimal con al menos minWidth dígitos (ceros a la izquierda)
+    // sin pasar por std::string; devuelve el final de lo escrito
+    inline char* writeDigits(char* out, uint64_t value, size_t minWidth) noexcept {
+        char scratch[20];
+        char* cursor = scratch + sizeof(scratch);
+        while (value >= 100) {
+            cursor -= 2;
+            writeTwoDigits(cursor, static_cast<uint32_t>(value % 100));
+            value /= 100;
+        }
+        if (value >= 10) {
+            cursor -= 2;
+            writeTwoDigits(cursor, static_cast<uint32_t>(value));
+        } else {
+            *--cursor = static_cast<char>('0' + value);
+        }
+        size_t digits = static_cast<size_t>(scratch + sizeof(scratch) - cursor);
+        for (; digits < minWidth; ++digits) {
+            *out++ = '0';
+        }
+        for (; cursor < scratch + sizeof(scratch); ++cursor) {
+            *out++ = *cursor;
+        }
+        return out;
+    }
+
+} // namespace db::types
+
+#endif // DIGIT_WRITER_HPP
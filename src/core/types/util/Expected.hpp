@@ -0,0 +1,87 @@
+// src/core/types/util/Expected.hpp
+#ifndef EXPECTED_HPP
+#define EXPECTED_HPP
+
+#include "../exceptions/DataTypeException.hpp"
+#include "../exceptions/TypeError.hpp"
+#include <source_location>
+#include <utility>
+#include <variant>
+
+namespace db::types {
+
+    // Subconjunto de std::expected<T, TypeError> (C++23) para la API sin
+    // excepciones de los tipos. value() sobre un error lanza DataTypeException,
+    // así que la API con excepciones se escribe encima de ésta.
+    template<typename T>
+    class [[nodiscard]] Expected {
+    public:
+        constexpr Expected(const T& value) : storage(std::in_place_index<0>, value) {}
+        constexpr Expected(T&& value) : storage(std::in_place_index<0>, std::move(value)) {}
+        constexpr Expected(TypeError error) noexcept : storage(std::in_place_index<1>, error) {}
+
+        [[nodiscard]] constexpr bool hasValue() const noexcept { return storage.index() == 0; }
+        constexpr explicit operator bool() const noexcept { return hasValue(); }
+
+        [[nodiscard]] constexpr const TypeError& error() const noexcept { return *std::get_if<1>(&storage); }
+
+        constexpr T& operator*() & noexcept { return *std::get_if<0>(&storage); }
+        constexpr const T& operator*() const& noexcept { return *std::get_if<0>(&storage); }
+        constexpr T&& operator*() && noexcept { return std::move(*std::get_if<0>(&storage)); }
+        constexpr T* operator->() noexcept { return std::get_if<0>(&storage); }
+        constexpr const T* operator->() const noexcept { return std::get_if<0>(&storage); }
+
+        constexpr T& value(const std::source_location& location = std::source_location::current()) & {
+            throwIfError(location);
+            return **this;
+        }
+        constexpr const T& value(const std::source_location& location = std::source_location::current()) const& {
+            throwIfError(location);
+            return **this;
+        }
+        constexpr T&& value(const std::source_location& location = std::source_location::current()) && {
+            throwIfError(location);
+            return std::move(**this);
+        }
+
+        template<typename U>
+        [[nodiscard]] constexpr T valueOr(U&& fallback) const& {
+            return hasValue() ? **this : static_cast<T>(std::forward<U>(fallback));
+        }
+
+    private:
+        std::variant<T, TypeError> storage;
+
+        constexpr void throwIfError(const std::source_location& location) const {
+            if (!hasValue()) {
+                throw DataTypeException(error(), location);
+            }
+        }
+    };
+
+    // Resultado de una comprobación que sólo puede fallar
+    template<>
+    class [[nodiscard]] Expected<void> {
+    public:
+        constexpr Expected() noexcept = default;
+        constexpr Expected(TypeError error) noexcept : failed(true), error_(error) {}
+
+        [[nodiscard]] constexpr bool hasValue() const noexcept { return !failed; }
+        constexpr explicit operator bool() const noexcept { return hasValue(); }
+
+        [[nodiscard]] constexpr const TypeError& error() const noexcept { return error_; }
+
+        constexpr void value(const std::source_location& location = std::source_location::current()) const {
+            if (failed) {
+                throw DataTypeException(error_, location);
+            }
+        }
+
+    private:
+        bool failed = false;
+        TypeError error_;
+    };
+
+} // namespace db::types
+
+#endif // EXPECTED_HPP
@@ -0,0 +1,31 @@
+// src/core/types/util/Int128.hpp
+#ifndef INT128_HPP
+#define INT128_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+namespace db::types {
+
+    // Enteros de 128 bits (extensión de GCC/Clang). Con CMAKE_CXX_EXTENSIONS OFF
+    // no son std::integral, así que se tratan siempre de forma explícita.
+    __extension__ typedef __int128 int128_t;
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    // Número de dígitos decimales de un valor sin signo (0 tiene 1 dígito)
+    [[nodiscard]] constexpr size_t decimalDigits(uint128_t value) noexcept {
+        size_t digits = 1;
+        while (value >= 10) {
+            value /= 10;
+            ++digits;
+        }
+        return digits;
+    }
+
+    [[nodiscard]] constexpr uint128_t absoluteValue(int128_t value) noexcept {
+        return value < 0 ? uint128_t{0} - static_cast<uint128_t>(value) : static_cast<uint128_t>(value);
+    }
+
+} // namespace db::types
+
+#endif // INT128_HPP
@@ -0,0 +1,55 @@
+// src/core/types/util/PowersOfTen.hpp
+#ifndef POWERS_OF_TEN_HPP
+#define POWERS_OF_TEN_HPP
+
+#include "Int128.hpp"
+#include <array>
+
+namespace db::types {
+
+    // Tablas de potencias de diez calculadas en compilación. Cubren todo el
+    // rango de NUMBER: precisión y escala hasta NumberType::MAX_PRECISION.
+    inline constexpr size_t MAX_POWER_OF_TEN = 38;
+    inline constexpr size_t MAX_INT64_POWER_OF_TEN = 18;
+
+    namespace detail {
+        template<typename T, size_t N>
+        constexpr std::array<T, N + 1> makePowersOfTen() noexcept {
+            std::array<T, N + 1> table{};
+            T value = 1;
+            for (size_t i = 0; i <= N; ++i) {
+                table[i] = value;
+                if (i < N) value *= 10;
+            }
+            return table;
+        }
+
+        // Se convierte desde la tabla exacta de 128 bits para que cada entrada sea
+        // el double más cercano a 10^i (multiplicar en double acumula error a partir de 10^23).
+        constexpr std::array<double, MAX_POWER_OF_TEN + 1> makeDoublePowersOfTen() noexcept {
+            const auto exact = makePowersOfTen<uint128_t, MAX_POWER_OF_TEN>();
+            std::array<double, MAX_POWER_OF_TEN + 1> table{};
+            for (size_t i = 0; i <= MAX_POWER_OF_TEN; ++i) {
+                table[i] = static_cast<double>(exact[i]);
+            }
+            return table;
+        }
+
+        constexpr std::array<double, MAX_POWER_OF_TEN + 1> makeNegativePowersOfTen() noexcept {
+            const auto powers = makeDoublePowersOfTen();
+            std::array<double, MAX_POWER_OF_TEN + 1> table{};
+            for (size_t i = 0; i <= MAX_POWER_OF_TEN; ++i) {
+                table[i] = 1.0 / powers[i];
+            }
+            return table;
+        }
+    } // namespace detail
+
+    inline constexpr auto POW10_U128 = detail::makePowersOfTen<uint128_t, MAX_POWER_OF_TEN>();
+    inline constexpr auto POW10_I64 = detail::makePowersOfTen<int64_t, MAX_INT64_POWER_OF_TEN>();
+    inline constexpr auto POW10_DOUBLE = detail::makeDoublePowersOfTen();
+    inline constexpr auto NEG_POW10_DOUBLE = detail::makeNegativePowersOfTen();
+
+} // namespace db::types
+
+#endif // POWERS_OF_TEN_HPP
@@ -0,0 +1,75 @@
+// src/core/types/util/StringArena.hpp
+#ifndef STRING_ARENA_HPP
+#define STRING_ARENA_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace db::types {
+
+    // Arena de bytes por avance de puntero: cada reserva es sumar al cursor y sólo
+    // se pide memoria al sistema una vez por bloque. No hay liberación individual;
+    // reset() suelta todo de golpe, típicamente al terminar un lote o un segmento.
+    class StringArena {
+    public:
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+        explicit StringArena(size_t blockSize = DEFAULT_BLOCK_SIZE) noexcept : blockSize(blockSize) {}
+        StringArena(const StringArena&) = delete;
+        StringArena& operator=(const StringArena&) = delete;
+        StringArena(StringArena&&) noexcept = default;
+        StringArena& operator=(StringArena&&) noexcept = default;
+
+        // Memoria sin inicializar que vive hasta reset() o la destrucción de la arena
+        [[nodiscard]] char* allocate(size_t size) {
+            // Las reservas grandes van a su propio bloque para no desperdiciar el actual
+            if (size > blockSize / 4) {
+                blocks.push_back(std::make_unique_for_overwrite<char[]>(size));
+                used += size;
+                return blocks.back().get();
+            }
+            if (size > remaining) {
+                blocks.push_back(std::make_unique_for_overwrite<char[]>(blockSize));
+                cursor = blocks.back().get();
+                remaining = blockSize;
+            }
+            char* out = cursor;
+            cursor += size;
+            remaining -= size;
+            used += size;
+            return out;
+        }
+
+        [[nodiscard]] std::string_view copy(std::string_view text) {
+            if (text.empty()) {
+                return {};
+            }
+            char* out = allocate(text.size());
+            std::memcpy(out, text.data(), text.size());
+            return {out, text.size()};
+        }
+
+        void reset() noexcept {
+            blocks.clear();
+            cursor = nullptr;
+            remaining = 0;
+            used = 0;
+        }
+
+        [[nodiscard]] size_t bytesUsed() const noexcept { return used; }
+        [[nodiscard]] size_t blockCount() const noexcept { return blocks.size(); }
+
+    private:
+        std::vector<std::unique_ptr<char[]>> blocks;
+        char* cursor = nullptr;
+        size_t remaining = 0;
+        size_t used = 0;
+        size_t blockSize;
+    };
+
+} // namespace db::types
+
+#endif // STRING_ARENA_HPP
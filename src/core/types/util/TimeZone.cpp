@@ -0,0 +1,304 @@
+// src/core/types/util/TimeZone.cpp
+#include "TimeZone.hpp"
+#include "CivilCalendar.hpp"
+#include "../exceptions/DataTypeException.hpp"
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <span>
+#include <string>
+
+namespace db::types {
+
+    namespace {
+        // Hora de una regla expresada en UTC (UE) o en la hora estándar local (EE. UU., Australia...)
+        enum class TimeReference : uint8_t { UTC, STANDARD };
+
+        constexpr int8_t LAST_WEEK = 5;
+
+        // Domingo `week` (1-4, o LAST_WEEK para el último) de `month`, a `seconds` del inicio del día
+        struct RuleDate {
+            uint8_t month;
+            int8_t week;
+            uint8_t weekday;  // 0 es domingo
+            int32_t seconds;
+            TimeReference reference;
+        };
+
+        struct DstRule {
+            RuleDate start;
+            RuleDate end;
+            int16_t saveMinutes;
+        };
+
+        // Reglas vigentes hasta el año `untilYear` (exclusivo)
+        struct ZoneEra {
+            int16_t untilYear;
+            int16_t standardOffset;
+            const DstRule* rule;
+        };
+
+        constexpr int16_t FOREVER = std::numeric_limits<int16_t>::max();
+
+        constexpr DstRule EU_1981{{3, LAST_WEEK, 0, 3600, TimeReference::UTC},
+                                  {9, LAST_WEEK, 0, 3600, TimeReference::UTC}, 60};
+        constexpr DstRule EU_1996{{3, LAST_WEEK, 0, 3600, TimeReference::UTC},
+                                  {10, LAST_WEEK, 0, 3600, TimeReference::UTC}, 60};
+        // El fin a las 02:00 de verano es la 01:00 estándar
+        constexpr DstRule US_1967{{4, LAST_WEEK, 0, 7200, TimeReference::STANDARD},
+                                  {10, LAST_WEEK, 0, 3600, TimeReference::STANDARD}, 60};
+        constexpr DstRule US_1987{{4, 1, 0, 7200, TimeReference::STANDARD},
+                                  {10, LAST_WEEK, 0, 3600, TimeReference::STANDARD}, 60};
+        constexpr DstRule US_2007{{3, 2, 0, 7200, TimeReference::STANDARD},
+                                  {11, 1, 0, 3600, TimeReference::STANDARD}, 60};
+        constexpr DstRule MX_1996{{4, 1, 0, 7200, TimeReference::STANDARD},
+                                  {10, LAST_WEEK, 0, 3600, TimeReference::STANDARD}, 60};
+        // Hemisferio sur: el verano empieza en un año y termina en el siguiente
+        constexpr DstRule AU_1987{{10, LAST_WEEK, 0, 7200, TimeReference::STANDARD},
+                                  {3, LAST_WEEK, 0, 7200, TimeReference::STANDARD}, 60};
+        constexpr DstRule AU_2008{{10, 1, 0, 7200, TimeReference::STANDARD},
+                                  {4, 1, 0, 7200, TimeReference::STANDARD}, 60};
+        constexpr DstRule NZ_2007{{9, LAST_WEEK, 0, 7200, TimeReference::STANDARD},
+                                  {4, 1, 0, 7200, TimeReference::STANDARD}, 60};
+
+        constexpr ZoneEra UTC_ERAS[] = {{FOREVER, 0, nullptr}};
+        constexpr ZoneEra WESTERN_EUROPE_ERAS[] = {{1981, 0, nullptr}, {1996, 0, &EU_1981}, {FOREVER, 0, &EU_1996}};
+        constexpr ZoneEra CENTRAL_EUROPE_ERAS[] = {{1981, 60, nullptr}, {1996, 60, &EU_1981}, {FOREVER, 60, &EU_1996}};
+        constexpr ZoneEra EASTERN_EUROPE_ERAS[] = {{1981, 120, nullptr}, {1996, 120, &EU_1981}, {FOREVER, 120, &EU_1996}};
+        constexpr ZoneEra US_EASTERN_ERAS[] = {
+            {1967, -300, nullptr}, {1987, -300, &US_1967}, {2007, -300, &US_1987}, {FOREVER, -300, &US_2007}};
+        constexpr ZoneEra US_CENTRAL_ERAS[] = {
+            {1967, -360, nullptr}, {1987, -360, &US_1967}, {2007, -360, &US_1987}, {FOREVER, -360, &US_2007}};
+        constexpr ZoneEra US_MOUNTAIN_ERAS[] = {
+            {1967, -420, nullptr}, {1987, -420, &US_1967}, {2007, -420, &US_1987}, {FOREVER, -420, &US_2007}};
+        constexpr ZoneEra US_PACIFIC_ERAS[] = {
+            {1967, -480, nullptr}, {1987, -480, &US_1967}, {2007, -480, &US_1987}, {FOREVER, -480, &US_2007}};
+        constexpr ZoneEra MEXICO_CITY_ERAS[] = {{1996, -360, nullptr}, {2023, -360, &MX_1996}, {FOREVER, -360, nullptr}};
+        constexpr ZoneEra SYDNEY_ERAS[] = {{1987, 600, nullptr}, {2008, 600, &AU_1987}, {FOREVER, 600, &AU_2008}};
+        constexpr ZoneEra AUCKLAND_ERAS[] = {{2007, 720, nullptr}, {FOREVER, 720, &NZ_2007}};
+        constexpr ZoneEra MINUS_0700_ERAS[] = {{FOREVER, -420, nullptr}};
+        constexpr ZoneEra MINUS_0500_ERAS[] = {{FOREVER, -300, nullptr}};
+        constexpr ZoneEra MINUS_0300_ERAS[] = {{FOREVER, -180, nullptr}};
+        constexpr ZoneEra PLUS_0200_ERAS[] = {{FOREVER, 120, nullptr}};
+        constexpr ZoneEra PLUS_0300_ERAS[] = {{FOREVER, 180, nullptr}};
+        constexpr ZoneEra PLUS_0400_ERAS[] = {{FOREVER, 240, nullptr}};
+        constexpr ZoneEra PLUS_0530_ERAS[] = {{FOREVER, 330, nullptr}};
+        constexpr ZoneEra PLUS_0800_ERAS[] = {{FOREVER, 480, nullptr}};
+        constexpr ZoneEra PLUS_0900_ERAS[] = {{FOREVER, 540, nullptr}};
+
+        constexpr int FIRST_CACHED_YEAR = 1900;
+        constexpr int END_CACHED_YEAR = 2100;
+        // Entre dos transiciones de una zona siempre hay más de un día
+        constexpr int64_t LOCAL_SEARCH_WINDOW = SECONDS_PER_DAY;
+
+        bool equalsIgnoreCase(std::string_view a, std::string_view b) noexcept {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+                return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+            });
+        }
+
+        int64_t ruleDay(int year, const RuleDate& date) noexcept {
+            const int64_t first = daysFromCivil(year, date.month, 1);
+            if (date.week == LAST_WEEK) {
+                const int64_t last = first + daysInMonth(year, date.month) - 1;
+                return last - floorMod(floorMod(last + 4, 7) - date.weekday, 7);
+            }
+            return first + floorMod(date.weekday - floorMod(first + 4, 7), 7) + 7 * (date.week - 1);
+        }
+
+        int64_t ruleInstant(int year, const RuleDate& date, int standardOffset) noexcept {
+            const int64_t local = ruleDay(year, date) * SECONDS_PER_DAY + date.seconds;
+            return date.reference == TimeReference::UTC ? local : local - standardOffset * int64_t{60};
+        }
+    } // namespace
+
+    struct TimeZone::Zone {
+        std::string_view name;
+        std::span<const ZoneEra> eras;
+
+        // El año se calcula con el desplazamiento estándar de la primera era para que
+        // el cambio de era caiga siempre en el mismo instante
+        [[nodiscard]] int yearOf(int64_t utcSeconds) const noexcept {
+            const int64_t local = utcSeconds + eras.front().standardOffset * int64_t{60};
+            return civilFromDays(floorDiv(local, SECONDS_PER_DAY)).year;
+        }
+
+        [[nodiscard]] int64_t yearStart(int year) const noexcept {
+            return daysFromCivil(year, 1, 1) * SECONDS_PER_DAY - eras.front().standardOffset * int64_t{60};
+        }
+
+        [[nodiscard]] const ZoneEra& eraFor(int year) const noexcept {
+            for (const ZoneEra& era : eras) {
+                if (year < era.untilYear) {
+                    return era;
+                }
+            }
+            return eras.back();
+        }
+    };
+
+    namespace {
+        constexpr std::pair<std::string_view, std::span<const ZoneEra>> ZONE_TABLE[] = {
+            {"UTC", UTC_ERAS},
+            {"Europe/London", WESTERN_EUROPE_ERAS},
+            {"Europe/Lisbon", WESTERN_EUROPE_ERAS},
+            {"Europe/Dublin", WESTERN_EUROPE_ERAS},
+            {"Europe/Madrid", CENTRAL_EUROPE_ERAS},
+            {"Europe/Paris", CENTRAL_EUROPE_ERAS},
+            {"Europe/Berlin", CENTRAL_EUROPE_ERAS},
+            {"Europe/Rome", CENTRAL_EUROPE_ERAS},
+            {"Europe/Amsterdam", CENTRAL_EUROPE_ERAS},
+            {"Europe/Brussels", CENTRAL_EUROPE_ERAS},
+            {"Europe/Athens", EASTERN_EUROPE_ERAS},
+            {"Europe/Helsinki", EASTERN_EUROPE_ERAS},
+            {"Europe/Istanbul", PLUS_0300_ERAS},
+            {"America/New_York", US_EASTERN_ERAS},
+            {"America/Chicago", US_CENTRAL_ERAS},
+            {"America/Denver", US_MOUNTAIN_ERAS},
+            {"America/Phoenix", MINUS_0700_ERAS},
+            {"America/Los_Angeles", US_PACIFIC_ERAS},
+            {"America/Mexico_City", MEXICO_CITY_ERAS},
+            {"America/Lima", MINUS_0500_ERAS},
+            {"America/Bogota", MINUS_0500_ERAS},
+            {"America/Argentina/Buenos_Aires", MINUS_0300_ERAS},
+            {"Africa/Johannesburg", PLUS_0200_ERAS},
+            {"Asia/Dubai", PLUS_0400_ERAS},
+            {"Asia/Kolkata", PLUS_0530_ERAS},
+            {"Asia/Shanghai", PLUS_0800_ERAS},
+            {"Asia/Singapore", PLUS_0800_ERAS},
+            {"Asia/Tokyo", PLUS_0900_ERAS},
+            {"Australia/Sydney", SYDNEY_ERAS},
+            {"Pacific/Auckland", AUCKLAND_ERAS}
+        };
+
+        constexpr bool namesFit() {
+            for (const auto& [name, eras] : ZONE_TABLE) {
+                if (name.size() > TimeZone::MAX_NAME_LENGTH) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        static_assert(namesFit());
+    } // namespace
+
+    const std::vector<std::unique_ptr<const TimeZone>>& TimeZone::registry() {
+        // Descriptores y zonas viven hasta el final del programa
+        static const std::vector<Zone> descriptors = [] {
+            std::vector<Zone> result;
+            for (const auto& [name, eras] : ZONE_TABLE) {
+                result.push_back({name, eras});
+            }
+            return result;
+        }();
+        static const auto zones = [] {
+            std::vector<std::unique_ptr<const TimeZone>> result;
+            for (size_t i = 0; i < descriptors.size(); ++i) {
+                result.emplace_back(new TimeZone(descriptors[i].name, static_cast<uint16_t>(i + 1), descriptors[i]));
+            }
+            return result;
+        }();
+        return zones;
+    }
+
+    const TimeZone* TimeZone::find(std::string_view name) noexcept {
+        for (const auto& zone : registry()) {
+            if (equalsIgnoreCase(zone->name, name)) {
+                return zone.get();
+            }
+        }
+        return nullptr;
+    }
+
+    const TimeZone& TimeZone::get(std::string_view name) {
+        const TimeZone* zone = find(name);
+        if (zone == nullptr) {
+            throw DataTypeException("Unknown time zone region: " + std::string(name));
+        }
+        return *zone;
+    }
+
+    const TimeZone* TimeZone::byId(uint16_t id) noexcept {
+        const auto& zones = registry();
+        return id == FIXED_OFFSET_ID || id > zones.size() ? nullptr : zones[id - 1].get();
+    }
+
+    std::vector<std::string_view> TimeZone::availableNames() {
+        std::vector<std::string_view> names;
+        for (const auto& zone : registry()) {
+            names.push_back(zone->name);
+        }
+        return names;
+    }
+
+    int TimeZone::offsetFromRules(int64_t utcSeconds) const noexcept {
+        const int year = zone.yearOf(utcSeconds);
+        const ZoneEra& era = zone.eraFor(year);
+        if (era.rule == nullptr) {
+            return era.standardOffset;
+        }
+        const int64_t start = ruleInstant(year, era.rule->start, era.standardOffset);
+        const int64_t end = ruleInstant(year, era.rule->end, era.standardOffset);
+        const bool daylight = start < end ? (utcSeconds >= start && utcSeconds < end)
+                                          : (utcSeconds >= start || utcSeconds < end);
+        return era.standardOffset + (daylight ? era.rule->saveMinutes : 0);
+    }
+
+    void TimeZone::buildTransitions() const {
+        cachedStart = zone.yearStart(FIRST_CACHED_YEAR);
+        cachedEnd = zone.yearStart(END_CACHED_YEAR);
+        initialOffset = offsetFromRules(cachedStart);
+
+        int32_t current = initialOffset;
+        for (int year = FIRST_CACHED_YEAR; year < END_CACHED_YEAR; ++year) {
+            // Los únicos instantes donde puede cambiar el desplazamiento: cambio de era
+            // (inicio de año) y los dos cambios de hora de la regla del año
+            int64_t candidates[3] = {zone.yearStart(year), 0, 0};
+            size_t count = 1;
+            const ZoneEra& era = zone.eraFor(year);
+            if (era.rule != nullptr) {
+                candidates[count++] = ruleInstant(year, era.rule->start, era.standardOffset);
+                candidates[count++] = ruleInstant(year, era.rule->end, era.standardOffset);
+            }
+            std::sort(candidates, candidates + count);
+            for (size_t i = 0; i < count; ++i) {
+                const int32_t offset = offsetFromRules(candidates[i]);
+                if (offset != current && candidates[i] > cachedStart && candidates[i] < cachedEnd) {
+                    transitions.push_back({candidates[i], offset});
+                    current = offset;
+                }
+            }
+        }
+    }
+
+    TimeZone::Interval TimeZone::intervalAt(int64_t utcSeconds) const noexcept {
+        std::call_once(built, [this] { buildTransitions(); });
+        if (utcSeconds < cachedStart || utcSeconds >= cachedEnd) {
+            // Fuera de la caché el tramo se reduce al propio instante
+            return {utcSeconds, utcSeconds + 1, offsetFromRules(utcSeconds)};
+        }
+        const auto next = std::upper_bound(transitions.begin(), transitions.end(), utcSeconds,
+                                           [](int64_t value, const Transition& t) { return value < t.utc; });
+        const int64_t start = next == transitions.begin() ? cachedStart : std::prev(next)->utc;
+        const int64_t end = next == transitions.end() ? cachedEnd : next->utc;
+        const int offset = next == transitions.begin() ? initialOffset : std::prev(next)->offsetAfter;
+        return {start, end, offset};
+    }
+
+    int TimeZone::offsetAt(int64_t utcSeconds) const noexcept {
+        return intervalAt(utcSeconds).offsetMinutes;
+    }
+
+    int TimeZone::offsetForLocal(int64_t localSeconds) const noexcept {
+        const int before = offsetAt(localSeconds - LOCAL_SEARCH_WINDOW);
+        const int after = offsetAt(localSeconds + LOCAL_SEARCH_WINDOW);
+        if (before == after || offsetAt(localSeconds - before * int64_t{60}) == before) {
+            return before;
+        }
+        if (offsetAt(localSeconds - after * int64_t{60}) == after) {
+            return after;
+        }
+        return before;
+    }
+
+} // namespace db::types
@@ -0,0 +1,83 @@
+// src/core/types/util/TimeZone.hpp
+#ifndef TIME_ZONE_HPP
+#define TIME_ZONE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace db::types {
+
+    // Región horaria de la base de datos embebida (Europe/Madrid, America/Lima...).
+    // Cada zona se describe con eras de reglas compiladas en la librería: no se lee
+    // el zoneinfo del sistema. Las transiciones de 1900 a 2100 se calculan la
+    // primera vez que se usa la zona y se cachean; fuera de ese rango se evalúan
+    // las reglas directamente. Los años anteriores a la primera era con reglas
+    // usan solo el desplazamiento estándar.
+    class TimeZone {
+    public:
+        static constexpr uint16_t FIXED_OFFSET_ID = 0;  // Id reservado para desplazamientos fijos
+        static constexpr size_t MAX_NAME_LENGTH = 32;
+
+        // Tramo [start, end) de segundos UTC con un desplazamiento constante
+        struct Interval {
+            int64_t start;
+            int64_t end;
+            int offsetMinutes;
+
+            [[nodiscard]] bool contains(int64_t utcSeconds) const noexcept {
+                return utcSeconds >= start && utcSeconds < end;
+            }
+        };
+
+        // Nombres sin distinguir mayúsculas; nullptr o DataTypeException si no existe
+        [[nodiscard]] static const TimeZone* find(std::string_view name) noexcept;
+        [[nodiscard]] static const TimeZone& get(std::string_view name);
+        [[nodiscard]] static const TimeZone* byId(uint16_t id) noexcept;
+        [[nodiscard]] static std::vector<std::string_view> availableNames();
+
+        TimeZone(const TimeZone&) = delete;
+        TimeZone& operator=(const TimeZone&) = delete;
+
+        [[nodiscard]] std::string_view getName() const noexcept { return name; }
+        [[nodiscard]] uint16_t getId() const noexcept { return id; }
+
+        // Minutos respecto a UTC en el instante dado
+        [[nodiscard]] int offsetAt(int64_t utcSeconds) const noexcept;
+        [[nodiscard]] Interval intervalAt(int64_t utcSeconds) const noexcept;
+
+        // Desplazamiento para una hora local. En el solapamiento del cambio de hora se
+        // elige el primer instante; en el hueco, el desplazamiento anterior al cambio
+        // (la hora inexistente avanza lo que dura el hueco).
+        [[nodiscard]] int offsetForLocal(int64_t localSeconds) const noexcept;
+
+    private:
+        struct Zone;
+        struct Transition {
+            int64_t utc;
+            int32_t offsetAfter;
+        };
+
+        TimeZone(std::string_view name, uint16_t id, const Zone& zone) noexcept
+            : name(name), id(id), zone(zone) {}
+
+        static const std::vector<std::unique_ptr<const TimeZone>>& registry();
+        void buildTransitions() const;
+        [[nodiscard]] int offsetFromRules(int64_t utcSeconds) const noexcept;
+
+        std::string_view name;
+        uint16_t id;
+        const Zone& zone;
+
+        mutable std::once_flag built;
+        mutable std::vector<Transition> transitions;
+        mutable int32_t initialOffset = 0;
+        mutable int64_t cachedStart = 0;
+        mutable int64_t cachedEnd = 0;
+    };
+
+} // namespace db::types
+
+#endif // TIME_ZONE_HPP
@@ -0,0 +1,150 @@
+// src/core/types/util/Utf8.cpp
+#include "Utf8.hpp"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace db::types {
+
+    namespace {
+#if defined(__AVX2__)
+        constexpr size_t BLOCK_SIZE = 32;
+#else
+        constexpr size_t BLOCK_SIZE = 16;
+#endif
+
+        // true si los BLOCK_SIZE bytes a partir de data son ASCII
+        inline bool isAsciiBlock(const unsigned char* data) noexcept {
+#if defined(__AVX2__)
+            return _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data))) == 0;
+#elif defined(__SSE2__)
+            return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))) == 0;
+#else
+            uint64_t word0, word1;
+            std::memcpy(&word0, data, 8);
+            std::memcpy(&word1, data + 8, 8);
+            return ((word0 | word1) & 0x8080808080808080ULL) == 0;
+#endif
+        }
+
+        // Bytes que inician carácter (no son 10xxxxxx) dentro de un bloque
+        inline size_t countLeadBytes(const unsigned char* data) noexcept {
+#if defined(__AVX2__)
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            const __m256i lead = _mm256_cmpgt_epi8(block, _mm256_set1_epi8(-65));
+            return static_cast<size_t>(std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(lead))));
+#elif defined(__SSE2__)
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            const __m128i lead = _mm_cmpgt_epi8(block, _mm_set1_epi8(-65));
+            return static_cast<size_t>(std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(lead))));
+#else
+            size_t count = 0;
+            for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+                count += (data[i] & 0xC0) != 0x80 ? 1 : 0;
+            }
+            return count;
+#endif
+        }
+
+        constexpr bool isContinuation(unsigned char byte) noexcept {
+            return (byte & 0xC0) == 0x80;
+        }
+
+        // Longitud de la secuencia bien formada en data[0..available), 0 si no lo es
+        // (tabla 3-7 del estándar Unicode)
+        inline size_t sequenceLength(const unsigned char* data, size_t available) noexcept {
+            const unsigned char lead = data[0];
+            if (lead < 0x80) {
+                return 1;
+            }
+            size_t length;
+            unsigned char low = 0x80;
+            unsigned char high = 0xBF;
+            if (lead >= 0xC2 && lead <= 0xDF) {
+                length = 2;
+            } else if (lead >= 0xE0 && lead <= 0xEF) {
+                length = 3;
+                if (lead == 0xE0) low = 0xA0;         // Sin formas sobrelargas
+                else if (lead == 0xED) high = 0x9F;   // Sin sustitutos UTF-16
+            } else if (lead >= 0xF0 && lead <= 0xF4) {
+                length = 4;
+                if (lead == 0xF0) low = 0x90;
+                else if (lead == 0xF4) high = 0x8F;   // Máximo U+10FFFF
+            } else {
+                return 0;
+            }
+            if (available < length || data[1] < low || data[1] > high) {
+                return 0;
+            }
+            for (size_t i = 2; i < length; ++i) {
+                if (!isContinuation(data[i])) {
+                    return 0;
+                }
+            }
+            return length;
+        }
+    } // namespace
+
+    Utf8Validation validateUtf8(std::string_view text) noexcept {
+        const auto* data = reinterpret_cast<const unsigned char*>(text.data());
+        const size_t size = text.size();
+        size_t codePoints = 0;
+        size_t i = 0;
+        while (i < size) {
+            if (i + BLOCK_SIZE <= size && isAsciiBlock(data + i)) {
+                codePoints += BLOCK_SIZE;
+                i += BLOCK_SIZE;
+                continue;
+            }
+            // Bloque con bytes altos: se decodifica hasta cruzar el límite del bloque
+            const size_t blockEnd = i + BLOCK_SIZE < size ? i + BLOCK_SIZE : size;
+            while (i < blockEnd) {
+                const size_t length = sequenceLength(data + i, size - i);
+                if (length == 0) {
+                    return {false, codePoints, i};
+                }
+                i += length;
+                ++codePoints;
+            }
+        }
+        return {true, codePoints, size};
+    }
+
+    size_t countUtf8CodePoints(std::string_view text) noexcept {
+        const auto* data = reinterpret_cast<const unsigned char*>(text.data());
+        const size_t size = text.size();
+        size_t count = 0;
+        size_t i = 0;
+        for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE) {
+            count += countLeadBytes(data + i);
+        }
+        for (; i < size; ++i) {
+            count += isContinuation(data[i]) ? 0 : 1;
+        }
+        return count;
+    }
+
+    bool isAscii(std::string_view text) noexcept {
+        const auto* data = reinterpret_cast<const unsigned char*>(text.data());
+        const size_t size = text.size();
+        size_t i = 0;
+        for (; i + BLOCK_SIZE <= size; i += BLOCK_SIZE) {
+            if (!isAsciiBlock(data + i)) {
+                return false;
+            }
+        }
+        for (; i < size; ++i) {
+            if (data[i] >= 0x80) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace db::types
@@ -0,0 +1,32 @@
+// src/core/types/util/Utf8.hpp
+#ifndef UTF8_HPP
+#define UTF8_HPP
+
+#include <cstddef>
+#include <string_view>
+
+namespace db::types {
+
+    // NCHAR/NVARCHAR2 guardan UTF-8: cada carácter ocupa como mucho 4 bytes
+    inline constexpr size_t MAX_UTF8_BYTES_PER_CHAR = 4;
+
+    struct Utf8Validation {
+        bool valid;
+        size_t codePoints;   // Caracteres completos antes del error (o de toda la cadena)
+        size_t errorOffset;  // Byte donde empieza la secuencia mal formada; size() si es válida
+    };
+
+    // Valida UTF-8 (secuencias mínimas, sin sustitutos, hasta U+10FFFF) y cuenta
+    // caracteres en una sola pasada, sin reservar memoria. Los bloques ASCII se
+    // saltan con SSE2/AVX2; solo los bloques con bytes altos se decodifican.
+    [[nodiscard]] Utf8Validation validateUtf8(std::string_view text) noexcept;
+
+    // Cuenta caracteres sin validar: número de bytes que no son de continuación.
+    // Con texto inválido cada byte huérfano cuenta como un carácter.
+    [[nodiscard]] size_t countUtf8CodePoints(std::string_view text) noexcept;
+
+    [[nodiscard]] bool isAscii(std::string_view text) noexcept;
+
+} // namespace db::types
+
+#endif // UTF8_HPP
@@ -0,0 +1,132 @@
+// src/core/types/values/CompactString.hpp
+#ifndef COMPACT_STRING_HPP
+#define COMPACT_STRING_HPP
+
+#include "../util/StringArena.hpp"
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace db::types {
+
+    // Cadena en 16 bytes para VARCHAR2/NVARCHAR2: longitud de 4 bytes, los 4
+    // primeros bytes del texto y, detrás, o bien los 8 siguientes (hasta 12 bytes
+    // en total sin memoria aparte) o bien un puntero al texto completo en una
+    // StringArena. Los bytes sobrantes se dejan a cero, así que longitud y prefijo
+    // se comparan como una palabra de 64 bits y la mayoría de igualdades y órdenes
+    // se deciden sin seguir el puntero.
+    class CompactString {
+    public:
+        static constexpr size_t PREFIX_SIZE = 4;
+        static constexpr size_t INLINE_CAPACITY = 12;
+
+        constexpr CompactString() noexcept = default;
+
+        // Hasta INLINE_CAPACITY bytes se guardan dentro; el resto se copia en `arena`
+        [[nodiscard]] static CompactString make(std::string_view text, StringArena& arena) {
+            if (text.size() <= INLINE_CAPACITY) {
+                return reference(text);
+            }
+            return reference(arena.copy(text));
+        }
+
+        // Sin copiar: si no cabe dentro, `text` debe seguir vivo mientras se use el handle
+        [[nodiscard]] static CompactString reference(std::string_view text) noexcept {
+            CompactString value;
+            value.length = static_cast<uint32_t>(text.size());
+            if (text.size() <= INLINE_CAPACITY) {
+                std::copy_n(text.data(), text.size(), value.data);
+            } else {
+                std::copy_n(text.data(), PREFIX_SIZE, value.data);
+                const char* pointer = text.data();
+                std::memcpy(value.data + PREFIX_SIZE, &pointer, sizeof(pointer));
+            }
+            return value;
+        }
+
+        [[nodiscard]] uint32_t size() const noexcept { return length; }
+        [[nodiscard]] bool empty() const noexcept { return length == 0; }
+        [[nodiscard]] bool isInline() const noexcept { return length <= INLINE_CAPACITY; }
+
+        [[nodiscard]] std::string_view view() const noexcept {
+            return {isInline() ? data : pointer(), length};
+        }
+
+        // Longitud y prefijo: iguales en dos cadenas iguales
+        [[nodiscard]] uint64_t head() const noexcept {
+            uint32_t prefix;
+            std::memcpy(&prefix, data, sizeof(prefix));
+            return static_cast<uint64_t>(length) | static_cast<uint64_t>(prefix) << 32;
+        }
+
+        // Los 8 bytes detrás del prefijo: texto en línea o el puntero
+        [[nodiscard]] uint64_t tail() const noexcept {
+            uint64_t bytes;
+            std::memcpy(&bytes, data + PREFIX_SIZE, sizeof(bytes));
+            return bytes;
+        }
+
+        [[nodiscard]] bool startsWith(std::string_view prefix) const noexcept {
+            if (prefix.size() > length) {
+                return false;
+            }
+            const size_t head = std::min(prefix.size(), PREFIX_SIZE);
+            if (std::memcmp(data, prefix.data(), head) != 0) {
+                return false;
+            }
+            return prefix.size() <= PREFIX_SIZE
+                   || std::memcmp(view().data() + PREFIX_SIZE, prefix.data() + PREFIX_SIZE,
+                                  prefix.size() - PREFIX_SIZE) == 0;
+        }
+
+        [[nodiscard]] friend bool operator==(const CompactString& a, const CompactString& b) noexcept {
+            if (a.head() != b.head()) {
+                return false;
+            }
+            if (a.isInline()) {
+                return a.tail() == b.tail();
+            }
+            return std::memcmp(a.pointer() + PREFIX_SIZE, b.pointer() + PREFIX_SIZE, a.length - PREFIX_SIZE) == 0;
+        }
+
+        // Orden de bytes como VARCHAR2. El prefijo relleno con ceros ya decide bien
+        // cuando difiere: una cadena más corta sólo puede diferir por un cero de
+        // relleno frente a un byte mayor, y entonces es menor como debe.
+        [[nodiscard]] friend std::strong_ordering operator<=>(const CompactString& a,
+                                                              const CompactString& b) noexcept {
+            if (const int order = std::memcmp(a.data, b.data, PREFIX_SIZE); order != 0) {
+                return order <=> 0;
+            }
+            const std::string_view left = a.view();
+            const std::string_view right = b.view();
+            const size_t common = std::min(left.size(), right.size());
+            if (common > PREFIX_SIZE) {
+                if (const int order = std::memcmp(left.data() + PREFIX_SIZE, right.data() + PREFIX_SIZE,
+                                                  common - PREFIX_SIZE);
+                    order != 0) {
+                    return order <=> 0;
+                }
+            }
+            return left.size() <=> right.size();
+        }
+
+    private:
+        [[nodiscard]] const char* pointer() const noexcept {
+            const char* pointer;
+            std::memcpy(&pointer, data + PREFIX_SIZE, sizeof(pointer));
+            return pointer;
+        }
+
+        uint32_t length = 0;
+        char data[INLINE_CAPACITY] = {};
+    };
+
+    static_assert(sizeof(CompactString) == 16);
+    static_assert(std::is_trivially_copyable_v<CompactString>);
+
+} // namespace db::types
+
+#endif // COMPACT_STRING_HPP
@@ -0,0 +1,147 @@
+// src/core/types/values/DateValue.hpp
+#ifndef DATE_VALUE_HPP
+#define DATE_VALUE_HPP
+
+#include "../DateType.hpp"
+#include "../util/CivilCalendar.hpp"
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <span>
+
+namespace db::types {
+
+    struct DateFields {
+        int year;
+        int month;
+        int day;
+        int hour = 0;
+        int minute = 0;
+        int second = 0;
+    };
+
+    // Columnas de campos en formato estructura de arrays para los kernels por lotes
+    template<typename T>
+    struct DateFieldColumns {
+        std::span<T> year;
+        std::span<T> month;
+        std::span<T> day;
+        std::span<T> hour;
+        std::span<T> minute;
+        std::span<T> second;
+
+        [[nodiscard]] constexpr size_t size() const noexcept { return year.size(); }
+    };
+
+    // Valor DATE compacto: segundos desde 1970-01-01 00:00:00 en un int64.
+    // Ordenar y comparar fechas es comparar enteros.
+    //
+    // En disco se usa el formato de Oracle de DateType::BYTES_SIZE bytes:
+    // siglo+100, año+100, mes, día, hora+1, minuto+1, segundo+1. Los años antes de
+    // Cristo usan 100-siglo y 100-año (año astronómico), así que memcmp sobre dos
+    // codificaciones da el mismo orden que las fechas.
+    class DateValue {
+    public:
+        static constexpr size_t ENCODED_SIZE = DateType::BYTES_SIZE;
+        static constexpr int64_t MIN_EPOCH_SECONDS = daysFromCivil(DateType::MIN_YEAR, 1, 1) * SECONDS_PER_DAY;
+        static constexpr int64_t MAX_EPOCH_SECONDS =
+            daysFromCivil(DateType::MAX_YEAR, 12, 31) * SECONDS_PER_DAY + SECONDS_PER_DAY - 1;
+
+        constexpr DateValue() noexcept = default;
+        constexpr explicit DateValue(int64_t epochSeconds) noexcept : seconds(epochSeconds) {}
+
+        // Sin validación: los campos fuera de rango se normalizan aritméticamente
+        [[nodiscard]] static constexpr DateValue fromCivil(int year, int month, int day,
+                                                           int hour = 0, int minute = 0, int second = 0) noexcept {
+            return DateValue{daysFromCivil(year, month, day) * SECONDS_PER_DAY
+                             + hour * int64_t{3600} + minute * int64_t{60} + second};
+        }
+
+        // Valida con las reglas de DateType y lanza DataTypeException si la fecha no existe
+        [[nodiscard]] static DateValue fromFields(const DateFields& fields) {
+            if (!DateType::isValidFields(fields.year, fields.month, fields.day,
+                                         fields.hour, fields.minute, fields.second)) {
+                throw DataTypeException("Invalid date");
+            }
+            return fromCivil(fields.year, fields.month, fields.day, fields.hour, fields.minute, fields.second);
+        }
+
+        [[nodiscard]] constexpr DateFields toFields() const noexcept {
+            const int64_t days = floorDiv(seconds, SECONDS_PER_DAY);
+            const auto secondOfDay = static_cast<int>(seconds - days * SECONDS_PER_DAY);
+            const CivilDate date = civilFromDays(days);
+            return {date.year, date.month, date.day, secondOfDay / 3600, secondOfDay / 60 % 60, secondOfDay % 60};
+        }
+
+        [[nodiscard]] constexpr int64_t getEpochSeconds() const noexcept { return seconds; }
+        [[nodiscard]] constexpr int64_t getEpochDays() const noexcept { return floorDiv(seconds, SECONDS_PER_DAY); }
+
+        [[nodiscard]] constexpr bool isInRange() const noexcept {
+            return seconds >= MIN_EPOCH_SECONDS && seconds <= MAX_EPOCH_SECONDS;
+        }
+
+        // Lanza DataTypeException si la fecha cae fuera del rango de DATE o `out` es corto
+        void encode(std::span<uint8_t> out) const {
+            if (out.size() < ENCODED_SIZE) {
+                throw DataTypeException("Output span is smaller than DATE encoding");
+            }
+            if (!isInRange()) {
+                throw DataTypeException("Date out of range");
+            }
+            encodeUnchecked(out.data());
+        }
+
+        [[nodiscard]] std::array<uint8_t, ENCODED_SIZE> encode() const {
+            std::array<uint8_t, ENCODED_SIZE> bytes{};
+            encode(bytes);
+            return bytes;
+        }
+
+        static DateValue decode(std::span<const uint8_t> bytes) {
+            DateValue value;
+            if (bytes.size() != ENCODED_SIZE || !decodeUnchecked(bytes.data(), value)) {
+                throw DataTypeException("Malformed DATE encoding");
+            }
+            return value;
+        }
+
+        // Variantes sin comprobaciones para los kernels por lotes. encodeUnchecked
+        // exige isInRange(); decodeUnchecked devuelve false si los bytes no son una
+        // codificación canónica, sin lanzar.
+        constexpr void encodeUnchecked(uint8_t* out) const noexcept {
+            const DateFields fields = toFields();
+            // La división truncada de C++ da directamente 100-siglo y 100-año para años negativos
+            out[0] = static_cast<uint8_t>(100 + fields.year / 100);
+            out[1] = static_cast<uint8_t>(100 + fields.year % 100);
+            out[2] = static_cast<uint8_t>(fields.month);
+            out[3] = static_cast<uint8_t>(fields.day);
+            out[4] = static_cast<uint8_t>(fields.hour + 1);
+            out[5] = static_cast<uint8_t>(fields.minute + 1);
+            out[6] = static_cast<uint8_t>(fields.second + 1);
+        }
+
+        static constexpr bool decodeUnchecked(const uint8_t* in, DateValue& out) noexcept {
+            const int century = in[0] - 100;
+            const int yearOfCentury = in[1] - 100;
+            const int year = century * 100 + yearOfCentury;
+            const int hour = in[4] - 1;
+            const int minute = in[5] - 1;
+            const int second = in[6] - 1;
+            // Siglo y año deben llevar el mismo signo para que la forma sea única
+            const bool canonical = (yearOfCentury > -100) & (yearOfCentury < 100)
+                                   & (((century >= 0) & (yearOfCentury >= 0)) | ((century <= 0) & (yearOfCentury <= 0)));
+            out = fromCivil(year, in[2], in[3], hour, minute, second);
+            return canonical & DateType::isValidFields(year, in[2], in[3], hour, minute, second);
+        }
+
+        constexpr auto operator<=>(const DateValue&) const noexcept = default;
+
+    private:
+        int64_t seconds = 0;
+    };
+
+    static_assert(sizeof(DateValue) == sizeof(int64_t));
+
+} // namespace db::types
+
+#endif // DATE_VALUE_HPP
@@ -0,0 +1,58 @@
+// src/core/types/values/Decimal128.hpp
+#ifndef DECIMAL128_HPP
+#define DECIMAL128_HPP
+
+#include "NumberValue.hpp"
+#include "../util/Int128.hpp"
+#include <compare>
+#include <string>
+
+namespace db::types {
+
+    // Entero de 128 bits escalado por 10^-scale. Cualquier NUMBER(p,s) que acepta
+    // NumberType (p <= 38, s <= p) cabe en esta representación; es la forma de
+    // trabajo de DecimalArithmetic para operar a velocidad de entero.
+    class Decimal128 {
+    public:
+        constexpr Decimal128() noexcept = default;
+
+        // Se espera |unscaled| < 10^38 y scale <= 38, como en NumberValue
+        constexpr Decimal128(int128_t unscaled, size_t scale) noexcept
+            : unscaled(unscaled), scale(static_cast<uint8_t>(scale)) {}
+
+        static Decimal128 fromNumberValue(const NumberValue& value) noexcept {
+            const auto magnitude = static_cast<int128_t>(value.getCoefficient());
+            return {value.isNegative() ? -magnitude : magnitude, value.getScale()};
+        }
+
+        [[nodiscard]] NumberValue toNumberValue() const {
+            return NumberValue::fromScaled(absoluteValue(unscaled), scale, unscaled < 0);
+        }
+
+        [[nodiscard]] std::string toString() const {
+            return toNumberValue().toString();
+        }
+
+        [[nodiscard]] constexpr int128_t getUnscaled() const noexcept { return unscaled; }
+        [[nodiscard]] constexpr size_t getScale() const noexcept { return scale; }
+
+        // Con la misma escala basta comparar los enteros; si no, se compara el valor numérico
+        [[nodiscard]] std::strong_ordering operator<=>(const Decimal128& other) const {
+            if (scale == other.scale) {
+                return unscaled <=> other.unscaled;
+            }
+            return toNumberValue() <=> other.toNumberValue();
+        }
+
+        [[nodiscard]] bool operator==(const Decimal128& other) const {
+            return (*this <=> other) == std::strong_ordering::equal;
+        }
+
+    private:
+        int128_t unscaled = 0;
+        uint8_t scale = 0;
+    };
+
+} // namespace db::types
+
+#endif // DECIMAL128_HPP
@@ -0,0 +1,521 @@
+// src/core/types/values/NumberValue.cpp
+#include "NumberValue.hpp"
+#include "../util/PowersOfTen.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+
+namespace db::types {
+
+    namespace {
+        // Límite exclusivo del coeficiente: 10^38
+        constexpr uint128_t COEFFICIENT_LIMIT = POW10_U128[NumberValue::MAX_DIGITS];
+
+        constexpr uint8_t POSITIVE_EXPONENT_BIAS = 0xC1;
+        constexpr uint8_t NEGATIVE_EXPONENT_BIAS = 0x3E;
+        constexpr uint8_t NEGATIVE_TERMINATOR = 102;
+        // Por debajo de cualquier dígito positivo guardado (1..100)
+        constexpr uint8_t POSITIVE_TERMINATOR = 0;
+
+        constexpr bool isDigit(char c) noexcept {
+            return c >= '0' && c <= '9';
+        }
+
+        // Divide por 10^digits redondeando la mitad alejándose de cero
+        constexpr uint128_t roundDivPow10(uint128_t value, size_t digits) noexcept {
+            if (digits == 0) {
+                return value;
+            }
+            if (digits > MAX_POWER_OF_TEN) {
+                return 0;  // value < 10^38 siempre queda por debajo de la mitad
+            }
+            const uint128_t divisor = POW10_U128[digits];
+            const uint128_t quotient = value / divisor;
+            return value % divisor >= divisor / 2 ? quotient + 1 : quotient;
+        }
+
+        // floor(x / 2) también para negativos: índice del dígito base 100 de 10^x
+        constexpr int pairIndex(int decimalExponent) noexcept {
+            return decimalExponent >= 0 ? decimalExponent / 2 : -((1 - decimalExponent) / 2);
+        }
+
+        // Clave de un coeficiente < 10^18 con divisiones de 64 bits, sin pasar por
+        // los dígitos decimales: es el caso de las claves NUMBER(18) y menores
+        size_t encodeSmallKey(uint64_t coefficient, size_t scale, bool negative, uint8_t* out) noexcept {
+            if (scale % 2 != 0) {
+                coefficient *= 10;
+                ++scale;
+            }
+            int bottomPair = -static_cast<int>(scale / 2);
+            while (coefficient % 100 == 0) {
+                coefficient /= 100;
+                ++bottomPair;
+            }
+            uint8_t pairs[10];
+            int count = 0;
+            for (; coefficient != 0; coefficient /= 100) {
+                pairs[count++] = static_cast<uint8_t>(coefficient % 100);
+            }
+            const int topPair = bottomPair + count - 1;
+            if (negative) {
+                out[0] = static_cast<uint8_t>(NEGATIVE_EXPONENT_BIAS - topPair);
+                for (int i = 0; i < count; ++i) out[i + 1] = static_cast<uint8_t>(101 - pairs[count - 1 - i]);
+                out[count + 1] = NEGATIVE_TERMINATOR;
+            } else {
+                out[0] = static_cast<uint8_t>(POSITIVE_EXPONENT_BIAS + topPair);
+                for (int i = 0; i < count; ++i) out[i + 1] = static_cast<uint8_t>(pairs[count - 1 - i] + 1);
+                out[count + 1] = POSITIVE_TERMINATOR;
+            }
+            return static_cast<size_t>(count) + 2;
+        }
+
+        std::strong_ordering compareMagnitude(uint128_t a, size_t scaleA, uint128_t b, size_t scaleB) noexcept {
+            const uint128_t integerA = a / POW10_U128[scaleA];
+            const uint128_t integerB = b / POW10_U128[scaleB];
+            if (integerA != integerB) {
+                return integerA < integerB ? std::strong_ordering::less : std::strong_ordering::greater;
+            }
+            // Las fracciones son < 10^scale, así que alinearlas a la escala mayor no desborda
+            const size_t common = std::max(scaleA, scaleB);
+            const uint128_t fractionA = (a % POW10_U128[scaleA]) * POW10_U128[common - scaleA];
+            const uint128_t fractionB = (b % POW10_U128[scaleB]) * POW10_U128[common - scaleB];
+            if (fractionA != fractionB) {
+                return fractionA < fractionB ? std::strong_ordering::less : std::strong_ordering::greater;
+            }
+            return std::strong_ordering::equal;
+        }
+    } // namespace
+
+    NumberValue NumberValue::fromScaled(uint128_t coefficient, size_t scale, bool negative) {
+        if (coefficient >= COEFFICIENT_LIMIT) {
+            throw DataTypeException("Coefficient exceeds " + std::to_string(MAX_DIGITS) + " digits");
+        }
+        if (scale > MAX_SCALE) {
+            throw DataTypeException("Scale cannot exceed " + std::to_string(MAX_SCALE));
+        }
+        return {coefficient, static_cast<uint8_t>(scale), negative};
+    }
+
+    NumberValue NumberValue::fromInt64(int64_t value) noexcept {
+        return {absoluteValue(value), 0, value < 0};
+    }
+
+    NumberValue NumberValue::fromString(std::string_view text) {
+        auto parsed = tryFromString(text);
+        if (!parsed) {
+            throw DataTypeException(parsed.error().message() + ": '" + std::string(text) + "'");
+        }
+        return *parsed;
+    }
+
+    Expected<NumberValue> NumberValue::tryFromString(std::string_view text) noexcept {
+        while (!text.empty() && text.front() == ' ') text.remove_prefix(1);
+        while (!text.empty() && text.back() == ' ') text.remove_suffix(1);
+
+        size_t pos = 0;
+        bool negative = false;
+        if (pos < text.size() && (text[pos] == '+' || text[pos] == '-')) {
+            negative = text[pos] == '-';
+            ++pos;
+        }
+
+        const size_t mantissaStart = pos;
+        size_t integerDigits = 0;
+        size_t fractionDigits = 0;
+        while (pos < text.size() && isDigit(text[pos])) {
+            ++pos;
+            ++integerDigits;
+        }
+        const bool hasPoint = pos < text.size() && text[pos] == '.';
+        if (hasPoint) {
+            ++pos;
+            while (pos < text.size() && isDigit(text[pos])) {
+                ++pos;
+                ++fractionDigits;
+            }
+        }
+        if (integerDigits + fractionDigits == 0) {
+            return TypeError(TypeErrorCode::INVALID_NUMBER);
+        }
+
+        long exponent = 0;
+        if (pos < text.size() && (text[pos] == 'e' || text[pos] == 'E')) {
+            ++pos;
+            bool negativeExponent = false;
+            if (pos < text.size() && (text[pos] == '+' || text[pos] == '-')) {
+                negativeExponent = text[pos] == '-';
+                ++pos;
+            }
+            if (pos == text.size() || !isDigit(text[pos])) {
+                return TypeError(TypeErrorCode::INVALID_NUMBER);
+            }
+            while (pos < text.size() && isDigit(text[pos])) {
+                // Cualquier exponente mayor ya desborda o redondea a cero
+                exponent = std::min(exponent * 10 + (text[pos] - '0'), 100000L);
+                ++pos;
+            }
+            if (negativeExponent) {
+                exponent = -exponent;
+            }
+        }
+        if (pos != text.size()) {
+            return TypeError(TypeErrorCode::INVALID_NUMBER);
+        }
+
+        const size_t totalDigits = integerDigits + fractionDigits;
+        auto digitAt = [&](size_t i) -> unsigned {
+            const size_t offset = mantissaStart + i + (hasPoint && i >= integerDigits ? 1 : 0);
+            return static_cast<unsigned>(text[offset] - '0');
+        };
+
+        size_t first = 0;
+        while (first < totalDigits && digitAt(first) == 0) ++first;
+        if (first == totalDigits) {
+            return NumberValue{};
+        }
+        size_t last = totalDigits;
+        while (digitAt(last - 1) == 0) --last;
+
+        // valor = D * 10^power, con D = dígitos [first, last)
+        const size_t significant = last - first;
+        const long power = exponent - static_cast<long>(fractionDigits) + static_cast<long>(totalDigits - last);
+        if (static_cast<long>(significant) + power > static_cast<long>(MAX_DIGITS)) {
+            return TypeError(TypeErrorCode::VALUE_OUT_OF_RANGE);
+        }
+
+        auto accumulate = [&](size_t end) {
+            uint128_t value = 0;
+            for (size_t i = first; i < end; ++i) {
+                value = value * 10 + digitAt(i);
+            }
+            return value;
+        };
+
+        if (power >= 0) {
+            return NumberValue{accumulate(last) * POW10_U128[static_cast<size_t>(power)], 0, negative};
+        }
+
+        // Se redondea una sola vez, descartando lo necesario para respetar
+        // tanto el máximo de dígitos como la escala máxima.
+        size_t scale = static_cast<size_t>(-power);
+        size_t drop = 0;
+        if (significant > MAX_DIGITS) drop = significant - MAX_DIGITS;
+        if (scale > MAX_SCALE) drop = std::max(drop, scale - MAX_SCALE);
+        if (drop > significant) {
+            return NumberValue{};
+        }
+
+        uint128_t coefficient = accumulate(last - drop);
+        if (drop > 0 && digitAt(last - drop) >= 5) {
+            ++coefficient;
+        }
+        scale -= drop;
+        // El acarreo del redondeo puede dejar ceros finales (9.99... -> 10.00...)
+        while (scale > 0 && coefficient % 10 == 0) {
+            coefficient /= 10;
+            --scale;
+        }
+        if (coefficient >= COEFFICIENT_LIMIT) {
+            return TypeError(TypeErrorCode::VALUE_OUT_OF_RANGE);
+        }
+        return NumberValue{coefficient, static_cast<uint8_t>(scale), negative};
+    }
+
+    NumberValue NumberValue::fromDouble(double value) {
+        if (!std::isfinite(value)) {
+            throw DataTypeException("Cannot convert non-finite double to NUMBER");
+        }
+        char buffer[32];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        return fromString(std::string_view(buffer, static_cast<size_t>(result.ptr - buffer)));
+    }
+
+    size_t NumberValue::getIntegerDigits() const noexcept {
+        if (coefficient == 0) {
+            return 0;
+        }
+        const size_t digits = decimalDigits(coefficient);
+        return digits > scale ? digits - scale : 0;
+    }
+
+    NumberValue NumberValue::roundToScale(size_t newScale) const {
+        if (newScale > MAX_SCALE) {
+            throw DataTypeException("Scale cannot exceed " + std::to_string(MAX_SCALE));
+        }
+        if (newScale >= scale) {
+            const size_t extra = newScale - scale;
+            if (coefficient >= POW10_U128[MAX_DIGITS - extra]) {
+                throw DataTypeException("Value exceeds maximum NUMBER precision");
+            }
+            return {coefficient * POW10_U128[extra], static_cast<uint8_t>(newScale), negative};
+        }
+        return {roundDivPow10(coefficient, scale - newScale), static_cast<uint8_t>(newScale), negative};
+    }
+
+    bool NumberValue::fitsIn(const NumberType& type) const noexcept {
+        if (coefficient == 0) {
+            return true;
+        }
+        const size_t precision = type.getPrecision();
+        const size_t targetScale = type.getScale();
+        if (targetScale >= scale) {
+            const size_t extra = targetScale - scale;
+            return extra < precision && coefficient < POW10_U128[precision - extra];
+        }
+        return roundDivPow10(coefficient, scale - targetScale) < POW10_U128[precision];
+    }
+
+    NumberValue NumberValue::coerceTo(const NumberType& type) const {
+        if (!fitsIn(type)) {
+            throw DataTypeException("Value " + toString() + " does not fit in " + type.getName());
+        }
+        return roundToScale(type.getScale());
+    }
+
+    size_t NumberValue::toDecimalDigits(uint8_t* digits) const noexcept {
+        // Se parte en dos mitades de 19 dígitos para trabajar con divisiones de 64 bits
+        const uint128_t chunk = POW10_U128[19];
+        uint64_t low = static_cast<uint64_t>(coefficient % chunk);
+        uint64_t high = static_cast<uint64_t>(coefficient / chunk);
+
+        uint8_t reversed[MAX_DIGITS + 2];
+        size_t count = 0;
+        if (high == 0) {
+            do {
+                reversed[count++] = static_cast<uint8_t>(low % 10);
+                low /= 10;
+            } while (low != 0);
+        } else {
+            for (int i = 0; i < 19; ++i) {
+                reversed[count++] = static_cast<uint8_t>(low % 10);
+                low /= 10;
+            }
+            while (high != 0) {
+                reversed[count++] = static_cast<uint8_t>(high % 10);
+                high /= 10;
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            digits[i] = reversed[count - 1 - i];
+        }
+        return count;
+    }
+
+    std::string NumberValue::toString() const {
+        char text[MAX_STRING_LENGTH];
+        return {text, toChars(text)};
+    }
+
+    size_t NumberValue::toChars(std::span<char> out) const {
+        uint8_t digits[MAX_DIGITS + 2];
+        const size_t count = toDecimalDigits(digits);
+        const size_t integerDigits = count > scale ? count - scale : 1;
+        const size_t length = negative + integerDigits + (scale > 0 ? 1 + scale : 0);
+        if (out.size() < length) {
+            throw DataTypeException("Buffer too small to format NUMBER");
+        }
+
+        char* cursor = out.data();
+        if (negative) {
+            *cursor++ = '-';
+        }
+        if (count > scale) {
+            for (size_t i = 0; i < count - scale; ++i) {
+                *cursor++ = static_cast<char>('0' + digits[i]);
+            }
+        } else {
+            *cursor++ = '0';
+        }
+        if (scale > 0) {
+            *cursor++ = '.';
+            // Ceros a la izquierda de la fracción cuando el coeficiente es corto
+            for (size_t i = count; i < scale; ++i) {
+                *cursor++ = '0';
+            }
+            for (size_t i = count > scale ? count - scale : 0; i < count; ++i) {
+                *cursor++ = static_cast<char>('0' + digits[i]);
+            }
+        }
+        return length;
+    }
+
+    double NumberValue::toDouble() const noexcept {
+        const double magnitude = static_cast<double>(coefficient) / POW10_DOUBLE[scale];
+        return negative ? -magnitude : magnitude;
+    }
+
+    size_t NumberValue::encode(std::span<uint8_t> out) const {
+        if (coefficient == 0) {
+            if (out.empty()) {
+                throw DataTypeException("Buffer too small to encode NUMBER");
+            }
+            out[0] = ZERO_BYTE;
+            return 1;
+        }
+
+        uint8_t digits[MAX_DIGITS + 2];
+        const int count = static_cast<int>(toDecimalDigits(digits));
+        // Exponentes decimales del primer y último dígito
+        const int top = count - static_cast<int>(scale) - 1;
+        const int bottom = -static_cast<int>(scale);
+        const int topPair = pairIndex(top);
+        const int bottomPair = pairIndex(bottom);
+
+        auto digitAtExponent = [&](int exponent) -> int {
+            const int index = top - exponent;
+            return index >= 0 && index < count ? digits[index] : 0;
+        };
+
+        uint8_t pairs[MAX_ENCODED_SIZE];
+        size_t pairCount = 0;
+        for (int pair = topPair; pair >= bottomPair; --pair) {
+            pairs[pairCount++] = static_cast<uint8_t>(10 * digitAtExponent(2 * pair + 1) + digitAtExponent(2 * pair));
+        }
+        // Oracle no guarda dígitos base 100 nulos al final
+        while (pairs[pairCount - 1] == 0) --pairCount;
+
+        const size_t size = 1 + pairCount;
+        if (out.size() < size) {
+            throw DataTypeException("Buffer too small to encode NUMBER");
+        }
+        if (negative) {
+            out[0] = static_cast<uint8_t>(NEGATIVE_EXPONENT_BIAS - topPair);
+            for (size_t i = 0; i < pairCount; ++i) out[i + 1] = static_cast<uint8_t>(101 - pairs[i]);
+        } else {
+            out[0] = static_cast<uint8_t>(POSITIVE_EXPONENT_BIAS + topPair);
+            for (size_t i = 0; i < pairCount; ++i) out[i + 1] = static_cast<uint8_t>(pairs[i] + 1);
+        }
+        return size;
+    }
+
+    std::vector<uint8_t> NumberValue::encode() const {
+        uint8_t buffer[MAX_ENCODED_SIZE];
+        const size_t size = encode(std::span<uint8_t>(buffer));
+        return {buffer, buffer + size};
+    }
+
+    size_t NumberValue::encodedSize() const noexcept {
+        uint8_t buffer[MAX_ENCODED_SIZE];
+        return encode(std::span<uint8_t>(buffer));
+    }
+
+    size_t NumberValue::encodeKey(std::span<uint8_t> out) const {
+        uint8_t key[MAX_KEY_SIZE];
+        size_t size;
+        if (coefficient == 0) {
+            key[0] = ZERO_BYTE;
+            size = 1;
+        } else if (coefficient < POW10_U128[18]) {
+            size = encodeSmallKey(static_cast<uint64_t>(coefficient), scale, negative, key);
+        } else {
+            size = encode(std::span<uint8_t>(key, MAX_ENCODED_SIZE));
+            key[size++] = negative ? NEGATIVE_TERMINATOR : POSITIVE_TERMINATOR;
+        }
+        if (out.size() < size) {
+            throw DataTypeException("Buffer too small to encode NUMBER key");
+        }
+        std::copy_n(key, size, out.begin());
+        return size;
+    }
+
+    NumberValue NumberValue::decodeKey(std::span<const uint8_t> bytes) {
+        if (bytes.empty() || keyLength(bytes) != bytes.size()) {
+            throw DataTypeException("Malformed NUMBER key");
+        }
+        // decode acepta el terminador de los negativos; el de los positivos se quita
+        return decode(bytes[0] > ZERO_BYTE ? bytes.first(bytes.size() - 1) : bytes);
+    }
+
+    size_t NumberValue::keyLength(std::span<const uint8_t> bytes) noexcept {
+        if (bytes.empty()) {
+            return 0;
+        }
+        if (bytes[0] == ZERO_BYTE) {
+            return 1;
+        }
+        const uint8_t terminator = bytes[0] > ZERO_BYTE ? POSITIVE_TERMINATOR : NEGATIVE_TERMINATOR;
+        const size_t limit = std::min(bytes.size(), MAX_KEY_SIZE);
+        for (size_t i = 1; i < limit; ++i) {
+            if (bytes[i] == terminator) {
+                return i + 1;
+            }
+        }
+        return 0;
+    }
+
+    NumberValue NumberValue::decode(std::span<const uint8_t> bytes) {
+        if (bytes.empty()) {
+            throw DataTypeException("Cannot decode empty NUMBER");
+        }
+        if (bytes[0] == ZERO_BYTE) {
+            if (bytes.size() != 1) {
+                throw DataTypeException("Malformed NUMBER encoding");
+            }
+            return NumberValue{};
+        }
+
+        const bool negative = bytes[0] < ZERO_BYTE;
+        // Se acepta el terminador 102 que Oracle añade a los negativos
+        if (negative && bytes.size() > 1 && bytes.back() == NEGATIVE_TERMINATOR) {
+            bytes = bytes.first(bytes.size() - 1);
+        }
+        const size_t pairCount = bytes.size() - 1;
+        if (pairCount == 0 || pairCount > MAX_ENCODED_SIZE - 1) {
+            throw DataTypeException("Malformed NUMBER encoding");
+        }
+
+        const int topPair = negative ? NEGATIVE_EXPONENT_BIAS - bytes[0] : bytes[0] - POSITIVE_EXPONENT_BIAS;
+        const int bottomPair = topPair - static_cast<int>(pairCount) + 1;
+
+        uint128_t coefficient = 0;
+        size_t scale = bottomPair < 0 ? static_cast<size_t>(-2 * bottomPair) : 0;
+        for (size_t i = 0; i < pairCount; ++i) {
+            const int stored = bytes[i + 1];
+            const int pair = negative ? 101 - stored : stored - 1;
+            if (pair < 0 || pair > 99 || (i == 0 && pair == 0)) {
+                throw DataTypeException("Malformed NUMBER encoding");
+            }
+            // Un último dígito base 100 como "20" en la fracción solo aporta un decimal
+            if (i + 1 == pairCount && bottomPair < 0 && pair % 10 == 0) {
+                if (coefficient > (COEFFICIENT_LIMIT - 1 - pair / 10) / 10) {
+                    throw DataTypeException("Malformed NUMBER encoding");
+                }
+                coefficient = coefficient * 10 + static_cast<uint128_t>(pair / 10);
+                --scale;
+                continue;
+            }
+            if (coefficient > (COEFFICIENT_LIMIT - 1 - static_cast<uint128_t>(pair)) / 100) {
+                throw DataTypeException("Malformed NUMBER encoding");
+            }
+            coefficient = coefficient * 100 + static_cast<uint128_t>(pair);
+        }
+
+        if (bottomPair > 0) {
+            const auto shift = static_cast<size_t>(2 * bottomPair);
+            if (shift > MAX_DIGITS || coefficient >= POW10_U128[MAX_DIGITS - shift]) {
+                throw DataTypeException("Malformed NUMBER encoding");
+            }
+            coefficient *= POW10_U128[shift];
+        }
+        if (scale > MAX_SCALE) {
+            throw DataTypeException("Malformed NUMBER encoding");
+        }
+        return {coefficient, static_cast<uint8_t>(scale), negative};
+    }
+
+    size_t NumberValue::maxEncodedSize(const NumberType& type) noexcept {
+        if (type.getPrecision() == 0) {
+            return 1;
+        }
+        return std::min(MAX_ENCODED_SIZE, 2 + type.getPrecision() / 2);
+    }
+
+    std::strong_ordering NumberValue::operator<=>(const NumberValue& other) const noexcept {
+        if (negative != other.negative) {
+            return negative ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        const auto magnitude = compareMagnitude(coefficient, scale, other.coefficient, other.scale);
+        return negative ? 0 <=> magnitude : magnitude;
+    }
+
+} // namespace db::types
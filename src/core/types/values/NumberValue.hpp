@@ -0,0 +1,104 @@
+// src/core/types/values/NumberValue.hpp
+#ifndef NUMBER_VALUE_HPP
+#define NUMBER_VALUE_HPP
+
+#include "../NumberType.hpp"
+#include "../util/Expected.hpp"
+#include "../util/Int128.hpp"
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace db::types {
+
+    // Valor decimal exacto para columnas NUMBER(p,s).
+    // Se guarda como coeficiente entero de hasta 38 dígitos escalado por 10^-scale,
+    // por lo que nunca pasa por double. En disco usa el formato base 100 de Oracle.
+    class NumberValue {
+    public:
+        static constexpr size_t MAX_DIGITS = NumberType::MAX_PRECISION;
+        static constexpr size_t MAX_SCALE = NumberType::MAX_PRECISION;
+        // Byte de exponente + hasta 20 dígitos base 100
+        static constexpr size_t MAX_ENCODED_SIZE = 1 + (MAX_DIGITS / 2) + 1;
+        static constexpr uint8_t ZERO_BYTE = 0x80;
+        // Codificación más un terminador
+        static constexpr size_t MAX_KEY_SIZE = MAX_ENCODED_SIZE + 1;
+        // Signo, "0." y hasta MAX_DIGITS dígitos (o MAX_SCALE tras el punto)
+        static constexpr size_t MAX_STRING_LENGTH = std::max(MAX_DIGITS, MAX_SCALE) + 3;
+
+        constexpr NumberValue() noexcept = default;
+
+        // Construye desde coeficiente y escala: valor = (-1)^negative * coefficient * 10^-scale
+        static NumberValue fromScaled(uint128_t coefficient, size_t scale, bool negative = false);
+        static NumberValue fromInt64(int64_t value) noexcept;
+        // Acepta "-123.45", "+.5", "1.5E-3"; redondea a 38 dígitos si hace falta
+        static NumberValue fromString(std::string_view text);
+        // Igual que fromString sin lanzar: INVALID_NUMBER o VALUE_OUT_OF_RANGE
+        static Expected<NumberValue> tryFromString(std::string_view text) noexcept;
+        // Usa la representación decimal más corta que reproduce el double
+        static NumberValue fromDouble(double value);
+
+        [[nodiscard]] constexpr bool isZero() const noexcept { return coefficient == 0; }
+        [[nodiscard]] constexpr bool isNegative() const noexcept { return negative; }
+        [[nodiscard]] constexpr size_t getScale() const noexcept { return scale; }
+        [[nodiscard]] constexpr uint128_t getCoefficient() const noexcept { return coefficient; }
+        // Dígitos antes del punto decimal (0 para |valor| < 1)
+        [[nodiscard]] size_t getIntegerDigits() const noexcept;
+
+        // Redondeo al estilo Oracle: mitad alejándose de cero
+        [[nodiscard]] NumberValue roundToScale(size_t newScale) const;
+        // Comprueba de forma exacta si el valor cabe en NUMBER(p,s) tras redondear a s
+        [[nodiscard]] bool fitsIn(const NumberType& type) const noexcept;
+        // Redondea a la escala del tipo y lanza si excede la precisión
+        [[nodiscard]] NumberValue coerceTo(const NumberType& type) const;
+
+        [[nodiscard]] std::string toString() const;
+        // Igual que toString pero en `out`, sin reservar memoria; devuelve los bytes
+        // escritos. Lanza si `out` tiene menos de los que hacen falta.
+        size_t toChars(std::span<char> out) const;
+        [[nodiscard]] double toDouble() const noexcept;
+
+        // Formato base 100: [exponente][dígitos...], sin terminador para negativos
+        // porque la longitud la conoce quien almacena el valor.
+        size_t encode(std::span<uint8_t> out) const;
+        [[nodiscard]] std::vector<uint8_t> encode() const;
+        static NumberValue decode(std::span<const uint8_t> bytes);
+        [[nodiscard]] size_t encodedSize() const noexcept;
+
+        // Clave de índice: la codificación base 100 seguida de 0 en positivos y de
+        // 102 en negativos, así que ninguna clave es prefijo de otra y memcmp da el
+        // orden numérico. Al quitar los ceros finales 1.50 y 1.5 dan los mismos bytes.
+        size_t encodeKey(std::span<uint8_t> out) const;
+        static NumberValue decodeKey(std::span<const uint8_t> bytes);
+        // Bytes de la clave que empieza en `bytes`; 0 si no hay una clave completa
+        [[nodiscard]] static size_t keyLength(std::span<const uint8_t> bytes) noexcept;
+
+        // getSize() asume 1 + ceil(p/2) bytes; si p es par y el valor no está
+        // alineado a pares de dígitos hace falta un dígito base 100 más.
+        [[nodiscard]] static size_t maxEncodedSize(const NumberType& type) noexcept;
+
+        // Comparación numérica: 1.50 == 1.5
+        [[nodiscard]] std::strong_ordering operator<=>(const NumberValue& other) const noexcept;
+        [[nodiscard]] bool operator==(const NumberValue& other) const noexcept {
+            return (*this <=> other) == std::strong_ordering::equal;
+        }
+
+    private:
+        constexpr NumberValue(uint128_t coefficient, uint8_t scale, bool negative) noexcept
+            : coefficient(coefficient), scale(scale), negative(negative && coefficient != 0) {}
+
+        // Escribe los dígitos decimales del coeficiente (más significativo primero)
+        size_t toDecimalDigits(uint8_t* digits) const noexcept;
+
+        uint128_t coefficient = 0;
+        uint8_t scale = 0;
+        bool negative = false;
+    };
+
+} // namespace db::types
+
+#endif // NUMBER_VALUE_HPP
@@ -0,0 +1,158 @@
+// src/core/types/values/TimestampValue.hpp
+#ifndef TIMESTAMP_VALUE_HPP
+#define TIMESTAMP_VALUE_HPP
+
+#include "../TimestampType.hpp"
+#include "../util/CivilCalendar.hpp"
+#include "../util/PowersOfTen.hpp"
+#include "../util/TimeZone.hpp"
+#include <compare>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace db::types {
+
+    // Campos de pared de un TIMESTAMP. `fraction` va en unidades de la precisión
+    // de la columna, como en TimestampType; `tzOffset` en minutos respecto a UTC.
+    struct TimestampFields {
+        int year;
+        int month;
+        int day;
+        int hour = 0;
+        int minute = 0;
+        int second = 0;
+        int fraction = 0;
+        std::optional<int> tzOffset = std::nullopt;
+    };
+
+    // Campos de TIMESTAMP en columnas separadas (structure of arrays), como
+    // DateFieldColumns. `tzOffset` queda vacío en columnas sin zona horaria.
+    template<typename T>
+    struct TimestampFieldColumns {
+        std::span<T> year;
+        std::span<T> month;
+        std::span<T> day;
+        std::span<T> hour;
+        std::span<T> minute;
+        std::span<T> second;
+        std::span<T> fraction;
+        std::span<T> tzOffset;
+
+        [[nodiscard]] constexpr size_t size() const noexcept { return year.size(); }
+    };
+
+    // Instante normalizado a UTC: segundos desde 1970-01-01 más nanosegundos
+    // [0, 10^9), junto al desplazamiento original para poder reconstruir la hora
+    // local. Un int64 de nanosegundos sólo cubre ±292 años, así que el rango
+    // -4712..9999 necesita los dos campos. El orden y la igualdad ignoran el
+    // desplazamiento: dos TIMESTAMP WITH TIME ZONE son iguales si son el mismo instante.
+    // Si el valor se creó con una región (TimeZone), se guarda también su id.
+    class TimestampValue {
+    public:
+        static constexpr int32_t NANOS_PER_SECOND = 1'000'000'000;
+
+        constexpr TimestampValue() noexcept = default;
+
+        // Sin validación: los campos fuera de rango se normalizan aritméticamente
+        [[nodiscard]] static constexpr TimestampValue fromCivil(int year, int month, int day,
+                                                                int hour, int minute, int second,
+                                                                int64_t nanos = 0, int offsetMinutes = 0) noexcept {
+            const int64_t local = daysFromCivil(year, month, day) * SECONDS_PER_DAY
+                                  + hour * int64_t{3600} + minute * int64_t{60} + second;
+            const int64_t carry = floorDiv(nanos, NANOS_PER_SECOND);
+            return TimestampValue{local - offsetMinutes * int64_t{60} + carry,
+                                  static_cast<int32_t>(nanos - carry * NANOS_PER_SECOND),
+                                  static_cast<int16_t>(offsetMinutes)};
+        }
+
+        // Instante ya en UTC; los nanosegundos fuera de [0, 10^9) se llevan a los segundos
+        [[nodiscard]] static constexpr TimestampValue fromUtc(int64_t utcSeconds, int64_t nanos = 0,
+                                                              int offsetMinutes = 0) noexcept {
+            const int64_t carry = floorDiv(nanos, NANOS_PER_SECOND);
+            return TimestampValue{utcSeconds + carry, static_cast<int32_t>(nanos - carry * NANOS_PER_SECOND),
+                                  static_cast<int16_t>(offsetMinutes)};
+        }
+
+        // Hora local en una región; el desplazamiento sale de sus reglas de horario de
+        // verano. Una hora que cae en un salto se lee con el desplazamiento anterior y
+        // el valor queda con el del instante resultante (02:30 +01:00 -> 03:30 +02:00).
+        [[nodiscard]] static TimestampValue fromLocal(const TimeZone& zone, int year, int month, int day,
+                                                      int hour, int minute, int second, int64_t nanos = 0) noexcept {
+            const int64_t local = daysFromCivil(year, month, day) * SECONDS_PER_DAY
+                                  + hour * int64_t{3600} + minute * int64_t{60} + second;
+            const TimestampValue instant = fromUtc(local - zone.offsetForLocal(local) * int64_t{60}, nanos);
+            return instant.atOffset(zone.offsetAt(instant.seconds), zone.getId());
+        }
+
+        // El mismo instante visto en otra región (AT TIME ZONE)
+        [[nodiscard]] TimestampValue atZone(const TimeZone& region) const noexcept {
+            return atOffset(region.offsetAt(seconds), region.getId());
+        }
+
+        [[nodiscard]] constexpr TimestampValue atOffset(int offsetMinutes,
+                                                        uint16_t zoneId = TimeZone::FIXED_OFFSET_ID) const noexcept {
+            TimestampValue value{seconds, nanos, static_cast<int16_t>(offsetMinutes)};
+            value.zone = zoneId;
+            return value;
+        }
+
+        // Valida con las reglas de `type` y lanza DataTypeException si el instante no existe
+        [[nodiscard]] static TimestampValue fromFields(const TimestampType& type, const TimestampFields& fields) {
+            if (!type.isValidTimestamp(fields.year, fields.month, fields.day, fields.hour, fields.minute,
+                                       fields.second, fields.fraction, fields.tzOffset)) {
+                throw DataTypeException("Invalid timestamp");
+            }
+            return fromCivil(fields.year, fields.month, fields.day, fields.hour, fields.minute, fields.second,
+                             fields.fraction * fractionUnit(type.getPrecision()), fields.tzOffset.value_or(0));
+        }
+
+        // Hora local en el desplazamiento original; la fracción se trunca a la precisión de `type`
+        [[nodiscard]] TimestampFields toFields(const TimestampType& type) const noexcept {
+            const int64_t local = seconds + offset * int64_t{60};
+            const int64_t days = floorDiv(local, SECONDS_PER_DAY);
+            const auto secondOfDay = static_cast<int>(local - days * SECONDS_PER_DAY);
+            const CivilDate date = civilFromDays(days);
+            return {date.year, date.month, date.day, secondOfDay / 3600, secondOfDay / 60 % 60, secondOfDay % 60,
+                    static_cast<int>(nanos / fractionUnit(type.getPrecision())),
+                    type.hasTimeZone() ? std::optional<int>{offset} : std::nullopt};
+        }
+
+        [[nodiscard]] constexpr int64_t getUtcSeconds() const noexcept { return seconds; }
+        [[nodiscard]] constexpr int32_t getNanos() const noexcept { return nanos; }
+        [[nodiscard]] constexpr int getOffsetMinutes() const noexcept { return offset; }
+        // TimeZone::FIXED_OFFSET_ID si solo se conoce el desplazamiento
+        [[nodiscard]] constexpr uint16_t getZoneId() const noexcept { return zone; }
+
+        [[nodiscard]] constexpr std::strong_ordering operator<=>(const TimestampValue& other) const noexcept {
+            if (const auto order = seconds <=> other.seconds; order != 0) {
+                return order;
+            }
+            return nanos <=> other.nanos;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const TimestampValue& other) const noexcept {
+            return seconds == other.seconds && nanos == other.nanos;
+        }
+
+    private:
+        constexpr TimestampValue(int64_t seconds, int32_t nanos, int16_t offset) noexcept
+            : seconds(seconds), nanos(nanos), offset(offset) {}
+
+        static constexpr int64_t fractionUnit(int precision) noexcept {
+            return POW10_I64[TimestampType::MAX_PRECISION - precision];
+        }
+
+        int64_t seconds = 0;
+        int32_t nanos = 0;
+        int16_t offset = 0;
+        // Ocupa el relleno: los kernels leen el valor como dos palabras de 64 bits y
+        // solo comparan los 32 bits bajos de la segunda
+        uint16_t zone = TimeZone::FIXED_OFFSET_ID;
+    };
+
+    static_assert(sizeof(TimestampValue) == 2 * sizeof(int64_t));
+
+} // namespace db::types
+
+#endif // TIMESTAMP_VALUE_HPP
@@ -0,0 +1,204 @@
+// tests/core/types/CastKernelsTest.cpp
+#include "CastKernelsTest.hpp"
+#include <string>
+#include <vector>
+
+namespace db::types::test {
+
+    namespace {
+        std::vector<std::string> toStrings(const CastColumn& column) {
+            const auto views = std::get<std::span<const std::string_view>>(column);
+            return {views.begin(), views.end()};
+        }
+    } // namespace
+
+    TEST_F(CastKernelsTest, WideningCastsShouldBeNoOps) {
+        EXPECT_TRUE(CastPlan::of(TypeDescriptor::number(10, 0), TypeDescriptor::number(12, 0))->isNoOp());
+        EXPECT_TRUE(CastPlan::of(TypeDescriptor::number(10, 2), TypeDescriptor::number(12, 4))->isNoOp());
+        EXPECT_TRUE(CastPlan::of(TypeDescriptor::varchar2(10), TypeDescriptor::varchar2(20))->isNoOp());
+        EXPECT_TRUE(CastPlan::of(TypeDescriptor::charType(5), TypeDescriptor::charType(5))->isNoOp());
+        EXPECT_TRUE(CastPlan::of(TypeDescriptor::date(), TypeDescriptor::date(false))->isNoOp());
+        EXPECT_TRUE(CastPlan::of(TypeDescriptor::timestamp(3, true), TypeDescriptor::timestamp(6, true))->isNoOp());
+
+        EXPECT_FALSE(CastPlan::of(TypeDescriptor::number(10, 2), TypeDescriptor::number(10, 4))->isNoOp());
+        EXPECT_FALSE(CastPlan::of(TypeDescriptor::varchar2(20), TypeDescriptor::varchar2(10))->isNoOp());
+        EXPECT_FALSE(CastPlan::of(TypeDescriptor::charType(5), TypeDescriptor::charType(8))->isNoOp());
+        EXPECT_FALSE(CastPlan::of(TypeDescriptor::timestamp(6, false), TypeDescriptor::timestamp(6, true))->isNoOp());
+
+        // Sin conversión la salida es la misma memoria que la entrada
+        const std::vector<NumberValue> numbers = {NumberValue::fromInt64(7), NumberValue::fromInt64(-3)};
+        const auto plan = CastPlan::of(TypeDescriptor::number(10, 0), TypeDescriptor::number(12, 0)).value();
+        CastBuffer buffer;
+        std::vector<uint64_t> failed(1, ~uint64_t{0});
+        std::vector<TypeError> errors(numbers.size());
+        const CastResult result = plan.apply(std::span<const NumberValue>(numbers), buffer, failed, errors);
+        EXPECT_EQ(result.failed, 0u);
+        EXPECT_EQ(failed[0], 0u);
+        EXPECT_EQ(std::get<std::span<const NumberValue>>(result.values).data(), numbers.data());
+    }
+
+    TEST_F(CastKernelsTest, UnsupportedPairsShouldReturnError) {
+        const auto plan = CastPlan::of(TypeDescriptor::date(), TypeDescriptor::number(10, 0));
+        ASSERT_FALSE(plan);
+        EXPECT_EQ(plan.error().code(), TypeErrorCode::UNSUPPORTED_CAST);
+        EXPECT_EQ(plan.error().reason(), static_cast<uint8_t>(TypeKind::DATE));
+        EXPECT_EQ(plan.error().detail(), static_cast<uint32_t>(TypeKind::NUMBER));
+        EXPECT_FALSE(CastPlan::of(TypeDescriptor::number(5, 0), TypeDescriptor::timestamp(6, false)));
+    }
+
+    TEST_F(CastKernelsTest, VarcharToNumberShouldReportErrorsPerRow) {
+        const std::vector<std::string_view> texts = {" 12.345 ", "abc", "99999", "-0.5", "1E2"};
+        const auto plan = CastPlan::of(TypeDescriptor::varchar2(20), TypeDescriptor::number(5, 2)).value();
+        CastBuffer buffer;
+        std::vector<uint64_t> failed(1);
+        std::vector<TypeError> errors(texts.size());
+        const CastResult result = plan.apply(std::span<const std::string_view>(texts), buffer, failed, errors);
+
+        EXPECT_EQ(result.failed, 2u);
+        EXPECT_EQ(failed[0], 0b00110u);
+        EXPECT_EQ(errors[1].code(), TypeErrorCode::INVALID_NUMBER);
+        EXPECT_EQ(errors[2].code(), TypeErrorCode::VALUE_OUT_OF_RANGE);
+
+        const auto numbers = std::get<std::span<const NumberValue>>(result.values);
+        ASSERT_EQ(numbers.size(), texts.size());
+        EXPECT_EQ(numbers[0].toString(), "12.35");
+        EXPECT_TRUE(numbers[1].isZero());
+        EXPECT_EQ(numbers[3], NumberValue::fromString("-0.5"));
+        EXPECT_EQ(numbers[4], NumberValue::fromInt64(100));
+
+        EXPECT_THROW(static_cast<void>(plan.applyOrThrow(std::span<const std::string_view>(texts), buffer)),
+                     DataTypeException);
+    }
+
+    TEST_F(CastKernelsTest, NumberCastsShouldRoundAndCheckPrecision) {
+        const std::vector<NumberValue> numbers = {NumberValue::fromString("123.456"), NumberValue::fromString("-9.995"),
+                                                  NumberValue::fromString("12345.6")};
+        const auto plan = CastPlan::of(TypeDescriptor::number(6, 2), TypeDescriptor::number(5, 2)).value();
+        EXPECT_FALSE(plan.isNoOp());
+        CastBuffer buffer;
+        std::vector<uint64_t> failed(1);
+        std::vector<TypeError> errors(numbers.size());
+        const CastResult result = plan.apply(std::span<const NumberValue>(numbers), buffer, failed, errors);
+        EXPECT_EQ(result.failed, 1u);
+        EXPECT_EQ(failed[0], 0b100u);
+        const auto out = std::get<std::span<const NumberValue>>(result.values);
+        EXPECT_EQ(out[0].toString(), "123.46");
+        EXPECT_EQ(out[1].toString(), "-10.00");
+
+        // NUMBER -> CHAR rellena y NUMBER -> VARCHAR2 comprueba la longitud
+        const auto toChar = CastPlan::of(TypeDescriptor::number(6, 2), TypeDescriptor::charType(8)).value();
+        const auto text = toStrings(toChar.applyOrThrow(std::span<const NumberValue>(numbers.data(), 2), buffer));
+        EXPECT_EQ(text, (std::vector<std::string>{"123.456 ", "-9.995  "}));
+
+        const auto toVarchar = CastPlan::of(TypeDescriptor::number(6, 2), TypeDescriptor::varchar2(6)).value();
+        const CastResult narrow = toVarchar.apply(std::span<const NumberValue>(numbers), buffer, failed, errors);
+        EXPECT_EQ(narrow.failed, 2u);
+        EXPECT_EQ(errors[0].code(), TypeErrorCode::VALUE_TOO_LONG);
+        EXPECT_EQ(toStrings(narrow.values)[2], "");
+    }
+
+    TEST_F(CastKernelsTest, CharToVarcharShouldTrimPadding) {
+        const std::vector<std::string_view> texts = {"ab   ", "abcde", "     "};
+        CastBuffer buffer;
+        const auto plan = CastPlan::of(TypeDescriptor::charType(5), TypeDescriptor::varchar2(10)).value();
+        EXPECT_EQ(toStrings(plan.applyOrThrow(std::span<const std::string_view>(texts), buffer)),
+                  (std::vector<std::string>{"ab", "abcde", ""}));
+
+        // El relleno no cuenta para la longitud del destino
+        const auto shorter = CastPlan::of(TypeDescriptor::charType(5), TypeDescriptor::charType(3)).value();
+        std::vector<uint64_t> failed(1);
+        std::vector<TypeError> errors(texts.size());
+        const CastResult result = shorter.apply(std::span<const std::string_view>(texts), buffer, failed, errors);
+        EXPECT_EQ(failed[0], 0b010u);
+        EXPECT_EQ(toStrings(result.values), (std::vector<std::string>{"ab ", "", "   "}));
+
+        const std::vector<std::string_view> national = {"ñandú", "\xC3"};
+        const auto toNChar = CastPlan::of(TypeDescriptor::varchar2(10), TypeDescriptor::nchar(6)).value();
+        const CastResult padded = toNChar.apply(std::span<const std::string_view>(national), buffer, failed, errors);
+        EXPECT_EQ(padded.failed, 1u);
+        EXPECT_EQ(errors[1].code(), TypeErrorCode::INVALID_UTF8);
+        EXPECT_EQ(toStrings(padded.values)[0], "ñandú ");
+    }
+
+    TEST_F(CastKernelsTest, DateAndTimestampCastsShouldRoundTrip) {
+        const std::vector<std::string_view> texts = {"2024-02-29 13:45:10.1234567", "2024-03-01", "2023-02-29 00:00:00"};
+        CastBuffer buffer;
+        std::vector<uint64_t> failed(1);
+        std::vector<TypeError> errors(texts.size());
+
+        const auto toTimestamp = CastPlan::of(TypeDescriptor::varchar2(40), TypeDescriptor::timestamp(3, false)).value();
+        const CastResult parsed = toTimestamp.apply(std::span<const std::string_view>(texts), buffer, failed, errors);
+        EXPECT_EQ(parsed.failed, 2u);
+        EXPECT_EQ(errors[2].code(), TypeErrorCode::INVALID_TIMESTAMP);
+        const std::vector<TimestampValue> timestamps = {
+            std::get<std::span<const TimestampValue>>(parsed.values)[0]};
+        EXPECT_EQ(timestamps[0], TimestampValue::fromCivil(2024, 2, 29, 13, 45, 10, 123'000'000));
+
+        const auto toDate = CastPlan::of(TypeDescriptor::varchar2(40), TypeDescriptor::date()).value();
+        const std::vector<std::string_view> dateTexts(texts.begin() + 1, texts.end());
+        const CastResult dates = toDate.apply(std::span<const std::string_view>(dateTexts), buffer, failed, errors);
+        EXPECT_EQ(dates.failed, 1u);
+        EXPECT_EQ(errors[1].code(), TypeErrorCode::INVALID_DATE);
+        EXPECT_EQ(std::get<std::span<const DateValue>>(dates.values)[0], DateValue::fromCivil(2024, 3, 1));
+
+        // TIMESTAMP -> DATE se queda con la hora local y DATE -> TIMESTAMP la recupera
+        const std::vector<TimestampValue> zoned = {TimestampValue::fromCivil(2024, 1, 1, 23, 30, 0, 500'000'000, -120)};
+        const auto timestampToDate = CastPlan::of(TypeDescriptor::timestamp(6, true), TypeDescriptor::date()).value();
+        const auto local = std::get<std::span<const DateValue>>(
+            timestampToDate.applyOrThrow(std::span<const TimestampValue>(zoned), buffer));
+        EXPECT_EQ(local[0], DateValue::fromCivil(2024, 1, 1, 23, 30, 0));
+        const std::vector<DateValue> localDates(local.begin(), local.end());
+        const auto dateToTimestamp = CastPlan::of(TypeDescriptor::date(), TypeDescriptor::timestamp(0, false)).value();
+        EXPECT_EQ(std::get<std::span<const TimestampValue>>(
+                      dateToTimestamp.applyOrThrow(std::span<const DateValue>(localDates), buffer))[0],
+                  TimestampValue::fromCivil(2024, 1, 1, 23, 30, 0));
+
+        // Quitar la zona conserva la hora local; bajar la precisión redondea
+        const auto dropZone = CastPlan::of(TypeDescriptor::timestamp(6, true), TypeDescriptor::timestamp(0, false)).value();
+        EXPECT_EQ(std::get<std::span<const TimestampValue>>(
+                      dropZone.applyOrThrow(std::span<const TimestampValue>(zoned), buffer))[0],
+                  TimestampValue::fromCivil(2024, 1, 1, 23, 30, 1));
+
+        const auto toText = CastPlan::of(TypeDescriptor::timestamp(3, false), TypeDescriptor::varchar2(30)).value();
+        EXPECT_EQ(toStrings(toText.applyOrThrow(std::span<const TimestampValue>(timestamps), buffer)),
+                  (std::vector<std::string>{"2024-02-29 13:45:10.123"}));
+        const auto zonedText = CastPlan::of(TypeDescriptor::timestamp(6, true), TypeDescriptor::varchar2(40)).value();
+        EXPECT_EQ(toStrings(zonedText.applyOrThrow(std::span<const TimestampValue>(zoned), buffer)),
+                  (std::vector<std::string>{"2024-01-01 23:30:00.500000 -02:00"}));
+    }
+
+    TEST_F(CastKernelsTest, ZonedTimestampCastShouldDefaultToSessionZone) {
+        const std::vector<std::string_view> texts = {"2024-01-01 10:00:00", "2024-01-01 10:00:00.25",
+                                                     "2024-01-01 10:00:00 -02:00", "2024-01-01"};
+        CastBuffer buffer;
+        std::vector<uint64_t> failed(1);
+        std::vector<TypeError> errors(texts.size());
+
+        const auto plan = CastPlan::of(TypeDescriptor::varchar2(40), TypeDescriptor::timestamp(6, true)).value();
+        const CastResult parsed = plan.apply(std::span<const std::string_view>(texts), buffer, failed, errors);
+        EXPECT_EQ(parsed.failed, 1u);
+        EXPECT_EQ(failed[0], uint64_t{1} << 3);
+        EXPECT_EQ(errors[3].code(), TypeErrorCode::INVALID_TIMESTAMP);
+        const auto values = std::get<std::span<const TimestampValue>>(parsed.values);
+        EXPECT_EQ(values[0], TimestampValue::fromCivil(2024, 1, 1, 10, 0, 0));
+        EXPECT_EQ(values[0].getOffsetMinutes(), 0);
+        EXPECT_EQ(values[1], TimestampValue::fromCivil(2024, 1, 1, 10, 0, 0, 250'000'000));
+        EXPECT_EQ(values[2], TimestampValue::fromCivil(2024, 1, 1, 10, 0, 0, 0, -120));
+        EXPECT_EQ(values[2].getOffsetMinutes(), -120);
+    }
+
+    TEST_F(CastKernelsTest, MismatchedInputShouldThrowOnce) {
+        const auto plan = CastPlan::of(TypeDescriptor::varchar2(10), TypeDescriptor::number(10, 0)).value();
+        const std::vector<NumberValue> numbers(3);
+        CastBuffer buffer;
+        std::vector<uint64_t> failed(1);
+        std::vector<TypeError> errors(3);
+        EXPECT_THROW(static_cast<void>(plan.apply(std::span<const NumberValue>(numbers), buffer, failed, errors)),
+                     DataTypeException);
+        const std::vector<std::string_view> texts(3, "1");
+        EXPECT_THROW(static_cast<void>(plan.apply(std::span<const std::string_view>(texts), buffer, failed,
+                                                  std::span<TypeError>(errors.data(), 2))),
+                     DataTypeException);
+    }
+
+} // namespace db::types::test
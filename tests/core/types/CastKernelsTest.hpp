@@ -0,0 +1,19 @@
+// tests/core/types/CastKernelsTest.hpp
+#ifndef CAST_KERNELS_TEST_HPP
+#define CAST_KERNELS_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/kernels/CastKernels.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class CastKernelsTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // CAST_KERNELS_TEST_HPP
@@ -85,6 +85,44 @@ namespace db::types::test {
         }
     }
 
+    TEST_F(CharTypeTest, CompareShouldOrderWithBlankPaddedSemantics) {
+        struct TestCase {
+            std::string value1;
+            std::string value2;
+            int expected;
+            std::string description;
+        };
+
+        const TestCase testCases[] = {
+            {"abc", "abc   ", 0, "Padding is ignored"},
+            {"", "    ", 0, "Empty equals blanks"},
+            {"abc", "abd", -1, "Differs in last character"},
+            {"abd  ", "abc", 1, "Greater with padding"},
+            {"ab", "abc", -1, "Shorter compares as padded"},
+            {"ab\t", "ab", -1, "Character below blank sorts first"},
+            {"ab", "ab\t", 1, "Blank sorts after tab"},
+            {std::string(40, 'x') + std::string(30, ' '), std::string(40, 'x'), 0, "Long padding"},
+            {std::string(40, 'x') + "y" + std::string(20, ' '), std::string(40, 'x'), 1, "Long value"}
+        };
+
+        for (const auto& tc : testCases) {
+            EXPECT_EQ(CharType::compare(tc.value1, tc.value2), tc.expected)
+                << "Failed for " << tc.description;
+        }
+    }
+
+    TEST_F(CharTypeTest, CompareBatchShouldCompareColumnAgainstConstant) {
+        const std::string_view column[] = {"ABC", "ABC       ", "ABB", "ABD  ", "AB", ""};
+        int8_t results[6];
+
+        CharType::compareBatch(column, "ABC   ", results);
+
+        const int8_t expected[] = {0, 0, -1, 1, -1, -1};
+        for (size_t i = 0; i < 6; ++i) {
+            EXPECT_EQ(results[i], expected[i]) << "Failed at index " << i;
+        }
+    }
+
     TEST_F(CharTypeTest, CloneShouldCreateExactCopy) {
         CharType original{true, 10};
         auto cloned = original.clone();
@@ -110,4 +148,40 @@ namespace db::types::test {
         EXPECT_EQ(customType->getLength(), 10);
     }
 
+    TEST_F(CharTypeTest, StoredValuesShouldBeTrimmedAndPaddedOnRead) {
+        const CharType type{true, 2000};
+        StringArena arena;
+
+        const auto yes = type.tryMakeValue("Y", arena);
+        ASSERT_TRUE(yes);
+        EXPECT_TRUE(yes->isInline());
+        EXPECT_EQ(yes->view(), "Y");
+        EXPECT_EQ(arena.bytesUsed(), 0u);
+        EXPECT_EQ(type.formatStored(*yes), type.formatValue("Y"));
+        EXPECT_EQ(type.formatStored(*yes).size(), 2000u);
+
+        // Un valor de una columna más ancha no se rellena: error en vez de desbordar
+        const CharType wide(true, 10);
+        const CharType narrow(true, 5);
+        const auto stored = wide.tryMakeValue("ABCDEFGH", arena);
+        EXPECT_EQ(narrow.tryFormatStored(*stored).error().code(), TypeErrorCode::VALUE_TOO_LONG);
+        EXPECT_EQ(narrow.paddingFor("AB").value(), 3u);
+
+        EXPECT_EQ(type.tryMakeValue("Y    ", arena)->view(), "Y");
+        EXPECT_EQ(type.tryMakeValue(std::string(2001, 'x'), arena).error().code(), TypeErrorCode::VALUE_TOO_LONG);
+    }
+
+    TEST_F(CharTypeTest, StoredValuesShouldCompareBlankPadded) {
+        const CharType type{true, 5};
+        StringArena arena;
+        const auto make = [&](std::string_view value) { return type.tryMakeValue(value, arena).value(); };
+
+        EXPECT_EQ(CharType::compare(make("AB"), make("AB   ")), 0);
+        EXPECT_EQ(CharType::compare(make("AB"), make("ABC")), -1);
+        EXPECT_EQ(CharType::compare(make("B"), make("AB")), 1);
+        // Un byte menor que el espacio ordena por debajo del relleno implícito
+        EXPECT_EQ(CharType::compare(make("A\t"), make("A")), -1);
+        EXPECT_EQ(CharType::compare(make("A"), make("A\t")), 1);
+    }
+
 } // namespace db::types::test
\ No newline at end of file
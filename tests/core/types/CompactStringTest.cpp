@@ -0,0 +1,93 @@
+// tests/core/types/CompactStringTest.cpp
+#include "CompactStringTest.hpp"
+#include <string>
+#include <vector>
+
+namespace db::types::test {
+
+    TEST_F(CompactStringTest, ShortValuesShouldStayInline) {
+        const CompactString code = CompactString::make("ACTIVE", arena);
+        EXPECT_TRUE(code.isInline());
+        EXPECT_EQ(code.view(), "ACTIVE");
+        EXPECT_EQ(CompactString::make("exactly12byt", arena).view(), "exactly12byt");
+        EXPECT_TRUE(CompactString{}.empty());
+        EXPECT_EQ(arena.bytesUsed(), 0u);
+
+        const std::string text = "a longer value that needs the arena";
+        const CompactString stored = CompactString::make(text, arena);
+        EXPECT_FALSE(stored.isInline());
+        EXPECT_EQ(stored.view(), text);
+        EXPECT_NE(stored.view().data(), text.data());
+        EXPECT_EQ(arena.bytesUsed(), text.size());
+    }
+
+    TEST_F(CompactStringTest, ComparisonShouldMatchByteOrder) {
+        const std::vector<std::string> ordered = {"", std::string("\0", 1), "a", std::string("a\0", 2), "ab",
+                                                  "abcd", "abcde", "abcdefghijkl", "abcdefghijklm",
+                                                  "abcdefghijklmn", "abce", "b", "zzzzzzzzzzzzzzzz"};
+        std::vector<CompactString> values;
+        for (const auto& text : ordered) {
+            values.push_back(CompactString::make(text, arena));
+        }
+        for (size_t i = 0; i < values.size(); ++i) {
+            for (size_t j = 0; j < values.size(); ++j) {
+                EXPECT_EQ(values[i] == values[j], i == j) << i << " vs " << j;
+                EXPECT_EQ(values[i] < values[j], i < j) << i << " vs " << j;
+            }
+        }
+        // Igualdad por contenido aunque el texto esté en otra dirección
+        const std::string copy = "abcdefghijklmn";
+        EXPECT_EQ(CompactString::reference(copy), values[9]);
+    }
+
+    TEST_F(CompactStringTest, KernelsShouldFilterOnHandles) {
+        const std::vector<std::string> texts = {"OPEN", "CLOSED", "OPEN", "ON_HOLD", "pending review by manager",
+                                                "pending review by owner", "OPENED"};
+        std::vector<CompactString> values;
+        for (const auto& text : texts) {
+            values.push_back(CompactString::make(text, arena));
+        }
+
+        EXPECT_EQ(CompactStringKernels::selectEqual(values, CompactString::make("OPEN", arena)).toSelection(),
+                  (std::vector<uint32_t>{0, 2}));
+        EXPECT_EQ(CompactStringKernels::selectEqual(values, CompactString::make("pending review by owner", arena))
+                      .toSelection(),
+                  (std::vector<uint32_t>{5}));
+        EXPECT_EQ(CompactStringKernels::selectBetween(values, CompactString::make("O", arena),
+                                                      CompactString::make("OPEN", arena)).toSelection(),
+                  (std::vector<uint32_t>{0, 2, 3}));
+        EXPECT_EQ(CompactStringKernels::selectStartsWith(values, "OPEN").toSelection(),
+                  (std::vector<uint32_t>{0, 2, 6}));
+        EXPECT_EQ(CompactStringKernels::selectStartsWith(values, "pending review by m").toSelection(),
+                  (std::vector<uint32_t>{4}));
+        EXPECT_EQ(CompactStringKernels::selectStartsWith(values, "").count(), values.size());
+    }
+
+    TEST_F(CompactStringTest, TypesShouldValidateBeforeStoring) {
+        const Varchar2Type varchar(true, 5);
+        EXPECT_EQ(varchar.tryMakeValue("hello", arena)->view(), "hello");
+        EXPECT_EQ(varchar.tryMakeValue("hello!", arena).error().code(), TypeErrorCode::VALUE_TOO_LONG);
+
+        const NVarchar2Type national(true, 13);
+        const auto stored = national.tryMakeValue("ñandú y cóndor", arena);
+        EXPECT_FALSE(stored);
+        EXPECT_EQ(stored.error().code(), TypeErrorCode::VALUE_TOO_MANY_CHARACTERS);
+        EXPECT_EQ(national.tryMakeValue("ñandú cóndor", arena)->view(), "ñandú cóndor");
+        EXPECT_EQ(national.tryMakeValue("\xFF", arena).error().code(), TypeErrorCode::INVALID_UTF8);
+    }
+
+    TEST_F(CompactStringTest, ArenaShouldReuseBlocks) {
+        StringArena small(1024);
+        for (int i = 0; i < 100; ++i) {
+            static_cast<void>(small.copy("0123456789"));
+        }
+        EXPECT_EQ(small.blockCount(), 1u);
+        static_cast<void>(small.allocate(4096));
+        EXPECT_EQ(small.blockCount(), 2u);
+        EXPECT_EQ(small.bytesUsed(), 1000u + 4096u);
+        small.reset();
+        EXPECT_EQ(small.bytesUsed(), 0u);
+        EXPECT_EQ(small.blockCount(), 0u);
+    }
+
+} // namespace db::types::test
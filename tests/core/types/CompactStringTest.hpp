@@ -0,0 +1,22 @@
+// tests/core/types/CompactStringTest.hpp
+#ifndef COMPACT_STRING_TEST_HPP
+#define COMPACT_STRING_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/Varchar2Type.hpp"
+#include "../../../src/core/types/NVarchar2Type.hpp"
+#include "../../../src/core/types/kernels/CompactStringKernels.hpp"
+
+namespace db::types::test {
+
+    class CompactStringTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+
+        StringArena arena;
+    };
+
+} // namespace db::types::test
+
+#endif // COMPACT_STRING_TEST_HPP
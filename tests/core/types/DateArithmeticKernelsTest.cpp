@@ -0,0 +1,172 @@
+// tests/core/types/DateArithmeticKernelsTest.cpp
+#include "DateArithmeticKernelsTest.hpp"
+#include <vector>
+
+namespace db::types::test {
+
+    namespace {
+        std::vector<DateValue> apply(const std::vector<DateValue>& values, auto kernel) {
+            std::vector<DateValue> out(values.size());
+            kernel(std::span<const DateValue>(values), std::span<DateValue>(out));
+            return out;
+        }
+    }
+
+    TEST_F(DateArithmeticKernelsTest, AddMonthsShouldFollowOracleRules) {
+        const std::vector<DateValue> values = {
+            DateValue::fromCivil(2024, 1, 31, 10, 30, 0),  // fin de mes
+            DateValue::fromCivil(2024, 1, 30),
+            DateValue::fromCivil(2023, 2, 28),             // fin de febrero no bisiesto
+            DateValue::fromCivil(-1, 12, 15)
+        };
+        const auto plusOne = apply(values, [](auto in, auto out) { DateArithmeticKernels::addMonths(in, 1, out); });
+        EXPECT_EQ(plusOne[0], DateValue::fromCivil(2024, 2, 29, 10, 30, 0));
+        EXPECT_EQ(plusOne[1], DateValue::fromCivil(2024, 2, 29));
+        EXPECT_EQ(plusOne[2], DateValue::fromCivil(2023, 3, 31));
+        EXPECT_EQ(plusOne[3], DateValue::fromCivil(0, 1, 15));
+
+        const std::vector<int32_t> months = {-12, -1, 12, -13};
+        std::vector<DateValue> out(values.size());
+        DateArithmeticKernels::addMonths(values, months, out);
+        EXPECT_EQ(out[0], DateValue::fromCivil(2023, 1, 31, 10, 30, 0));
+        EXPECT_EQ(out[1], DateValue::fromCivil(2023, 12, 30));
+        EXPECT_EQ(out[2], DateValue::fromCivil(2024, 2, 29));
+        EXPECT_EQ(out[3], DateValue::fromCivil(-2, 11, 15));
+    }
+
+    TEST_F(DateArithmeticKernelsTest, LastDayShouldKeepTimeOfDay) {
+        const std::vector<DateValue> values = {
+            DateValue::fromCivil(2024, 2, 3, 8, 0, 0), DateValue::fromCivil(2024, 2, 29), DateValue::fromCivil(1900, 2, 1)
+        };
+        const auto out = apply(values, [](auto in, auto o) { DateArithmeticKernels::lastDay(in, o); });
+        EXPECT_EQ(out[0], DateValue::fromCivil(2024, 2, 29, 8, 0, 0));
+        EXPECT_EQ(out[1], DateValue::fromCivil(2024, 2, 29));
+        EXPECT_EQ(out[2], DateValue::fromCivil(1900, 2, 28));
+    }
+
+    TEST_F(DateArithmeticKernelsTest, TruncAndRoundShouldUseCalendarUnits) {
+        const std::vector<DateValue> values = {
+            DateValue::fromCivil(2024, 8, 16, 12, 30, 30), DateValue::fromCivil(2024, 5, 15, 11, 29, 29)
+        };
+        struct Case {
+            DateUnit unit;
+            DateValue trunc0, round0, trunc1, round1;
+        };
+        const Case cases[] = {
+            {DateUnit::YEAR, DateValue::fromCivil(2024, 1, 1), DateValue::fromCivil(2025, 1, 1),
+             DateValue::fromCivil(2024, 1, 1), DateValue::fromCivil(2024, 1, 1)},
+            {DateUnit::QUARTER, DateValue::fromCivil(2024, 7, 1), DateValue::fromCivil(2024, 10, 1),
+             DateValue::fromCivil(2024, 4, 1), DateValue::fromCivil(2024, 4, 1)},
+            {DateUnit::MONTH, DateValue::fromCivil(2024, 8, 1), DateValue::fromCivil(2024, 9, 1),
+             DateValue::fromCivil(2024, 5, 1), DateValue::fromCivil(2024, 5, 1)},
+            {DateUnit::DAY, DateValue::fromCivil(2024, 8, 16), DateValue::fromCivil(2024, 8, 17),
+             DateValue::fromCivil(2024, 5, 15), DateValue::fromCivil(2024, 5, 15)},
+            {DateUnit::HOUR, DateValue::fromCivil(2024, 8, 16, 12, 0, 0), DateValue::fromCivil(2024, 8, 16, 13, 0, 0),
+             DateValue::fromCivil(2024, 5, 15, 11, 0, 0), DateValue::fromCivil(2024, 5, 15, 11, 0, 0)},
+            {DateUnit::MINUTE, DateValue::fromCivil(2024, 8, 16, 12, 30, 0), DateValue::fromCivil(2024, 8, 16, 12, 31, 0),
+             DateValue::fromCivil(2024, 5, 15, 11, 29, 0), DateValue::fromCivil(2024, 5, 15, 11, 29, 0)}
+        };
+        for (const auto& c : cases) {
+            const auto truncated = apply(values, [&](auto in, auto o) { DateArithmeticKernels::trunc(in, c.unit, o); });
+            const auto rounded = apply(values, [&](auto in, auto o) { DateArithmeticKernels::round(in, c.unit, o); });
+            EXPECT_EQ(truncated[0], c.trunc0) << static_cast<int>(c.unit);
+            EXPECT_EQ(rounded[0], c.round0) << static_cast<int>(c.unit);
+            EXPECT_EQ(truncated[1], c.trunc1) << static_cast<int>(c.unit);
+            EXPECT_EQ(rounded[1], c.round1) << static_cast<int>(c.unit);
+        }
+
+        // Antes de 1970 el truncado sigue yendo hacia el pasado
+        const auto beforeEpoch = apply({DateValue::fromCivil(1969, 12, 31, 23, 59, 59)},
+                                       [](auto in, auto o) { DateArithmeticKernels::trunc(in, DateUnit::DAY, o); });
+        EXPECT_EQ(beforeEpoch[0], DateValue::fromCivil(1969, 12, 31));
+    }
+
+    TEST_F(DateArithmeticKernelsTest, ExtractShouldMatchCivilFields) {
+        // Días consecutivos a lo largo de varios años para ejercitar el cursor de mes
+        std::vector<DateValue> values;
+        for (int64_t days = -800; days < 800; days += 3) {
+            values.push_back(DateValue{days * SECONDS_PER_DAY + days * 37 % SECONDS_PER_DAY});
+        }
+        std::vector<int32_t> year(values.size()), month(values.size()), day(values.size()), second(values.size());
+        std::vector<int32_t> dayOfYear(values.size()), dayOfWeek(values.size()), quarter(values.size());
+        DateArithmeticKernels::extract(values, DateField::YEAR, year);
+        DateArithmeticKernels::extract(values, DateField::MONTH, month);
+        DateArithmeticKernels::extract(values, DateField::DAY, day);
+        DateArithmeticKernels::extract(values, DateField::SECOND, second);
+        DateArithmeticKernels::extract(values, DateField::DAY_OF_YEAR, dayOfYear);
+        DateArithmeticKernels::extract(values, DateField::DAY_OF_WEEK, dayOfWeek);
+        DateArithmeticKernels::extract(values, DateField::QUARTER, quarter);
+
+        for (size_t i = 0; i < values.size(); ++i) {
+            const DateFields fields = values[i].toFields();
+            ASSERT_EQ(year[i], fields.year);
+            ASSERT_EQ(month[i], fields.month);
+            ASSERT_EQ(day[i], fields.day);
+            ASSERT_EQ(second[i], fields.second);
+            ASSERT_EQ(quarter[i], (fields.month + 2) / 3);
+            ASSERT_EQ(dayOfYear[i], values[i].getEpochDays() - daysFromCivil(fields.year, 1, 1) + 1);
+        }
+        const std::vector<DateValue> monday = {DateValue::fromCivil(2024, 1, 1), DateValue::fromCivil(2024, 1, 7)};
+        std::vector<int32_t> weekday(2);
+        DateArithmeticKernels::extract(monday, DateField::DAY_OF_WEEK, weekday);
+        EXPECT_EQ(weekday, (std::vector<int32_t>{1, 7}));
+    }
+
+    TEST_F(DateArithmeticKernelsTest, ExtractFromTimestampShouldKeepFractionAndZone) {
+        // 2023-12-31 23:30:15.25 en -02:30 es 2024-01-01 02:00:15.25 UTC
+        std::vector<TimestampValue> values = {
+            TimestampValue::fromCivil(2023, 12, 31, 23, 30, 15, 250'000'000, -150),
+            TimestampValue::fromCivil(2024, 6, 30, 8, 5, 59, 999'000'000, 330)};
+        // Más de un bloque interno
+        values.resize(600, values[1]);
+        const auto extract = [&](DateField field) {
+            std::vector<double> out(values.size());
+            DateArithmeticKernels::extract(values, field, out);
+            return out;
+        };
+
+        EXPECT_EQ(extract(DateField::YEAR)[0], 2023);
+        EXPECT_EQ(extract(DateField::DAY)[0], 31);
+        EXPECT_EQ(extract(DateField::HOUR)[0], 23);
+        EXPECT_EQ(extract(DateField::SECOND)[0], 15.25);
+        EXPECT_EQ(extract(DateField::TIMEZONE_HOUR)[0], -2);
+        EXPECT_EQ(extract(DateField::TIMEZONE_MINUTE)[0], -30);
+        EXPECT_EQ(extract(DateField::MINUTE)[599], 5);
+        EXPECT_DOUBLE_EQ(extract(DateField::SECOND)[599], 59.999);
+        EXPECT_EQ(extract(DateField::TIMEZONE_HOUR)[599], 5);
+        EXPECT_EQ(extract(DateField::TIMEZONE_MINUTE)[599], 30);
+
+        const std::vector<DateValue> dates = {DateValue::fromCivil(2024, 1, 1)};
+        std::vector<int32_t> out(1);
+        EXPECT_THROW(DateArithmeticKernels::extract(dates, DateField::TIMEZONE_HOUR, out), DataTypeException);
+    }
+
+    TEST_F(DateArithmeticKernelsTest, DifferencesShouldUseDaysAndSeconds) {
+        const std::vector<DateValue> a = {DateValue::fromCivil(2024, 3, 1, 12, 0, 0), DateValue::fromCivil(1970, 1, 1)};
+        const std::vector<DateValue> b = {DateValue::fromCivil(2024, 2, 28), DateValue::fromCivil(1970, 1, 2)};
+        std::vector<double> days(2);
+        std::vector<int64_t> seconds(2);
+        DateArithmeticKernels::daysBetween(a, b, days);
+        DateArithmeticKernels::secondsBetween(a, b, seconds);
+        EXPECT_DOUBLE_EQ(days[0], 2.5);
+        EXPECT_DOUBLE_EQ(days[1], -1.0);
+        EXPECT_EQ(seconds[0], 216000);
+
+        const std::vector<TimestampValue> ta = {TimestampValue::fromCivil(2024, 1, 1, 0, 0, 1, 250'000'000, 60)};
+        const std::vector<TimestampValue> tb = {TimestampValue::fromCivil(2023, 12, 31, 23, 0, 2, 750'000'000)};
+        std::vector<double> fractional(1);
+        DateArithmeticKernels::secondsBetween(ta, tb, fractional);
+        EXPECT_DOUBLE_EQ(fractional[0], -1.5);
+
+        std::vector<DateValue> local(1);
+        DateArithmeticKernels::toLocalDates(ta, local);
+        EXPECT_EQ(local[0], DateValue::fromCivil(2024, 1, 1, 0, 0, 1));
+    }
+
+    TEST_F(DateArithmeticKernelsTest, ShouldRejectShortOutput) {
+        const std::vector<DateValue> values(3);
+        std::vector<DateValue> out(2);
+        EXPECT_THROW(DateArithmeticKernels::lastDay(values, out), DataTypeException);
+    }
+
+} // namespace db::types::test
@@ -0,0 +1,19 @@
+// tests/core/types/DateArithmeticKernelsTest.hpp
+#ifndef DATE_ARITHMETIC_KERNELS_TEST_HPP
+#define DATE_ARITHMETIC_KERNELS_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/kernels/DateArithmeticKernels.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class DateArithmeticKernelsTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // DATE_ARITHMETIC_KERNELS_TEST_HPP
@@ -0,0 +1,151 @@
+// tests/core/types/DateTimeFormatTest.cpp
+#include "DateTimeFormatTest.hpp"
+#include <vector>
+
+namespace db::types::test {
+
+    TEST_F(DateTimeFormatTest, ShouldFormatNumericElements) {
+        const auto format = DateTimeFormat::compile("YYYY-MM-DD HH24:MI:SS.FF6 TZH:TZM");
+        const auto value = TimestampValue::fromCivil(2024, 3, 5, 7, 8, 9, 123'456'789, -330);
+        EXPECT_EQ(format.format(value), "2024-03-05 07:08:09.123456 -05:30");
+
+        EXPECT_EQ(DateTimeFormat::compile("YYYY-MM-DD\"T\"HH24:MI:SS.FF3").format(
+                      TimestampValue::fromCivil(1999, 12, 31, 23, 59, 59, 5'000'000)),
+                  "1999-12-31T23:59:59.005");
+        EXPECT_EQ(DateTimeFormat::compile("YY/DDD HH12 AM").format(DateValue::fromCivil(2024, 12, 31, 0, 30, 0)),
+                  "24/366 12 AM");
+        EXPECT_EQ(DateTimeFormat::compile("hh:mi pm").format(DateValue::fromCivil(2024, 1, 1, 13, 5, 0)),
+                  "01:05 pm");
+    }
+
+    TEST_F(DateTimeFormatTest, ShouldFormatNamesWithMaskCase) {
+        const auto date = DateValue::fromCivil(2024, 5, 15);  // miércoles
+        EXPECT_EQ(DateTimeFormat::compile("DD-MON-YYYY").format(date), "15-MAY-2024");
+        EXPECT_EQ(DateTimeFormat::compile("Dy, DD Mon YYYY").format(date), "Wed, 15 May 2024");
+        EXPECT_EQ(DateTimeFormat::compile("day month").format(date), "wednesday may      ");
+        EXPECT_EQ(DateTimeFormat::compile("FMDay, FMMonth DD").format(date), "Wednesday, May       15");
+        EXPECT_EQ(DateTimeFormat::compile("FMDD/MM/YYYY").format(DateValue::fromCivil(5, 1, 2)), "2/1/5");
+    }
+
+    TEST_F(DateTimeFormatTest, ShouldFormatEras) {
+        const auto bc = DateValue::fromCivil(-4712, 1, 1);
+        EXPECT_EQ(DateTimeFormat::compile("YYYY BC").format(bc), "4712 BC");
+        EXPECT_EQ(DateTimeFormat::compile("SYYYY").format(bc), "-4712");
+        EXPECT_EQ(DateTimeFormat::compile("SYYYY AD").format(DateValue::fromCivil(2024, 1, 1)), " 2024 AD");
+        // El año 0 no lleva BC, igual que SYYYY y DateType::formatDate
+        const auto yearZero = DateValue::fromCivil(0, 1, 1);
+        EXPECT_EQ(DateTimeFormat::compile("YYYY-MM-DD AD").format(yearZero), "0000-01-01 AD");
+        EXPECT_EQ(DateTimeFormat::compile("SYYYY").format(yearZero), " 0000");
+        EXPECT_EQ(DateType().formatDate(0, 1, 1).find("BC"), std::string::npos);
+        EXPECT_EQ(DateTimeFormat::compile("YYYY BC").format(DateValue::fromCivil(-1, 1, 1)), "0001 BC");
+    }
+
+    TEST_F(DateTimeFormatTest, ShouldRejectUnknownElements) {
+        EXPECT_THROW((void)DateTimeFormat::compile("YYYY-QQ"), DataTypeException);
+        EXPECT_THROW((void)DateTimeFormat::compile("\"unterminated"), DataTypeException);
+        EXPECT_THROW((void)DateTimeFormat::compile("YYYY").format(DateValue::fromCivil(10000, 1, 1)),
+                     DataTypeException);
+    }
+
+    TEST_F(DateTimeFormatTest, BufferApiShouldRespectMaxLength) {
+        const auto format = DateTimeFormat::compile("DD-MON-YYYY");
+        EXPECT_EQ(format.maxLength(), 11u);
+
+        char buffer[11];
+        EXPECT_EQ(format.format(DateValue::fromCivil(2024, 2, 29), buffer), 11u);
+        EXPECT_EQ(std::string_view(buffer, 11), "29-FEB-2024");
+
+        char shortBuffer[10];
+        EXPECT_THROW(format.format(DateValue::fromCivil(2024, 2, 29), shortBuffer), DataTypeException);
+    }
+
+    TEST_F(DateTimeFormatTest, BatchShouldWriteContiguousRows) {
+        const auto format = DateTimeFormat::compile("FMMonth DD");
+        const std::vector<DateValue> values = {
+            DateValue::fromCivil(2024, 5, 1), DateValue::fromCivil(2024, 9, 30), DateValue::fromCivil(2024, 12, 25)
+        };
+        std::vector<char> out(values.size() * format.maxLength());
+        std::vector<uint32_t> ends(values.size());
+
+        const size_t written = format.formatBatch(values, out, ends);
+        EXPECT_EQ(std::string_view(out.data(), written), "May 1September 30December 25");
+        EXPECT_EQ(ends, (std::vector<uint32_t>{5, 17, 28}));
+
+        const std::vector<TimestampValue> timestamps = {
+            TimestampValue::fromCivil(2024, 1, 1, 0, 0, 0, 0, 60),
+            TimestampValue::fromCivil(2024, 1, 1, 23, 0, 0, 0, -60)
+        };
+        const auto tz = DateTimeFormat::compile("DD HH24 TZH");
+        std::vector<char> tzOut(timestamps.size() * tz.maxLength());
+        std::vector<uint32_t> tzEnds(timestamps.size());
+        EXPECT_EQ(std::string_view(tzOut.data(), tz.formatBatch(timestamps, tzOut, tzEnds)), "01 00 +0101 23 -01");
+    }
+
+    TEST_F(DateTimeFormatTest, IsoFastPathShouldParseTimestamps) {
+        const auto format = DateTimeFormat::compile("YYYY-MM-DD\"T\"HH24:MI:SS.FF9 TZH:TZM");
+        EXPECT_EQ(format.parseTimestamp("2024-02-29T23:45:10.123456789 -05:00"),
+                  TimestampValue::fromCivil(2024, 3, 1, 4, 45, 10, 123'456'789));
+        EXPECT_EQ(format.parseTimestamp("2024-02-29T23:45:10.5 +01:30").getNanos(), 500'000'000);
+        EXPECT_EQ(format.parseTimestamp("2024-02-29T23:45:10.5 +01:30").getOffsetMinutes(), 90);
+
+        // Fuera de la anchura fija se cae al parser general
+        EXPECT_EQ(format.parseTimestamp("2024-2-9T3:05:10.25 +1:00"),
+                  TimestampValue::fromCivil(2024, 2, 9, 3, 5, 10, 250'000'000, 60));
+
+        EXPECT_THROW((void)format.parseTimestamp("2024-02-29 23:45:10.1 +00:00"), DataTypeException);
+        EXPECT_THROW((void)format.parseTimestamp("2023-02-29T23:45:10.1 +00:00"), DataTypeException);
+        EXPECT_THROW((void)format.parseTimestamp("2024-02-29T23:45:10.1 +15:00"), DataTypeException);
+        EXPECT_THROW((void)format.parseTimestamp("2024-02-29T23:45:10.1 +00:00 "), DataTypeException);
+        EXPECT_THROW((void)format.parseTimestamp("2024-02-29T23:45:10.1234567890 +00:00"), DataTypeException);
+    }
+
+    TEST_F(DateTimeFormatTest, ParseShouldRoundTripFormat) {
+        const char* masks[] = {
+            "YYYY-MM-DD HH24:MI:SS", "DD-MON-YYYY HH12:MI:SS AM", "Day, DD Month YYYY HH24:MI:SS BC",
+            "FMDD/MM/YYYY HH24\"h\"MI:SS", "SYYYY DDD HH24:MI:SS"
+        };
+        const DateValue dates[] = {
+            DateValue::fromCivil(2024, 5, 15, 0, 0, 0), DateValue::fromCivil(1999, 12, 31, 12, 59, 1),
+            DateValue::fromCivil(1, 1, 1, 23, 0, 59), DateValue::fromCivil(9999, 9, 3, 7, 7, 7)
+        };
+        for (const char* mask : masks) {
+            const auto format = DateTimeFormat::compile(mask);
+            for (const auto& date : dates) {
+                EXPECT_EQ(format.parseDate(format.format(date)), date) << mask << " -> " << format.format(date);
+            }
+        }
+
+        // Los años antes de Cristo necesitan BC o SYYYY en la máscara
+        const auto bc = DateValue::fromCivil(-4712, 1, 1, 12, 0, 0);
+        EXPECT_EQ(DateTimeFormat::compile(masks[2]).parseDate(DateTimeFormat::compile(masks[2]).format(bc)), bc);
+        EXPECT_EQ(DateTimeFormat::compile(masks[4]).parseDate(DateTimeFormat::compile(masks[4]).format(bc)), bc);
+
+        const auto millis = DateTimeFormat::compile("YYYY-MM-DD HH24:MI:SS.FF3");
+        const auto timestamp = TimestampValue::fromCivil(2024, 1, 1, 0, 0, 0, 7'000'000);
+        EXPECT_EQ(millis.parseTimestamp(millis.format(timestamp)), timestamp);
+
+        EXPECT_THROW((void)millis.parseDate("2024-01-01 00:00:00.007"), DataTypeException);
+        EXPECT_THROW((void)DateTimeFormat::compile("DD-MON-YYYY").parseDate("31-FOO-2024"), DataTypeException);
+        EXPECT_THROW((void)DateTimeFormat::compile("HH:MI").parseDate("13:00"), DataTypeException);
+        EXPECT_EQ(DateTimeFormat::compile("yy-mon-dd").parseDate("24-feb-29"), DateValue::fromCivil(2024, 2, 29));
+    }
+
+    TEST_F(DateTimeFormatTest, ParseBatchShouldFlagFailures) {
+        const auto format = DateTimeFormat::compile("YYYY-MM-DD HH24:MI:SS");
+        const std::vector<std::string_view> texts = {
+            "2024-01-01 00:00:00", "2024-13-01 00:00:00", "garbage", "1970-01-01 00:00:01"
+        };
+        std::vector<DateValue> out(texts.size());
+        std::vector<uint64_t> failed(1);
+
+        EXPECT_EQ(format.parseBatch(texts, out, failed), 2u);
+        EXPECT_EQ(failed[0], 0b0110u);
+        EXPECT_EQ(out[0], DateValue::fromCivil(2024, 1, 1));
+        EXPECT_EQ(out[3].getEpochSeconds(), 1);
+
+        std::vector<TimestampValue> timestamps(texts.size());
+        EXPECT_EQ(format.parseBatch(texts, timestamps, failed), 2u);
+        EXPECT_EQ(timestamps[3].getUtcSeconds(), 1);
+    }
+
+} // namespace db::types::test
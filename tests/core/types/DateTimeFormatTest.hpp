@@ -0,0 +1,20 @@
+// tests/core/types/DateTimeFormatTest.hpp
+#ifndef DATE_TIME_FORMAT_TEST_HPP
+#define DATE_TIME_FORMAT_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/kernels/DateTimeFormat.hpp"
+#include "../../../src/core/types/DateType.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class DateTimeFormatTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // DATE_TIME_FORMAT_TEST_HPP
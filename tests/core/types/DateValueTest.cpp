@@ -0,0 +1,134 @@
+// tests/core/types/DateValueTest.cpp
+#include "DateValueTest.hpp"
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace db::types::test {
+
+    TEST_F(DateValueTest, CivilConversionShouldMatchChrono) {
+        using namespace std::chrono;
+
+        // Recorre todo el rango de DATE saltando 97 días para cubrir años bisiestos y eras
+        const int64_t first = sys_days{year{DateType::MIN_YEAR} / 1 / 1}.time_since_epoch().count();
+        const int64_t last = sys_days{year{DateType::MAX_YEAR} / 12 / 31}.time_since_epoch().count();
+        for (int64_t days = first; days <= last; days += 97) {
+            const year_month_day ymd{sys_days{std::chrono::days{days}}};
+            const CivilDate civil = civilFromDays(days);
+
+            ASSERT_EQ(civil.year, static_cast<int>(ymd.year())) << "days=" << days;
+            ASSERT_EQ(civil.month, static_cast<int>(static_cast<unsigned>(ymd.month()))) << "days=" << days;
+            ASSERT_EQ(civil.day, static_cast<int>(static_cast<unsigned>(ymd.day()))) << "days=" << days;
+            ASSERT_EQ(daysFromCivil(civil.year, civil.month, civil.day), days);
+        }
+    }
+
+    TEST_F(DateValueTest, FieldsShouldRoundTrip) {
+        const DateFields cases[] = {
+            {1970, 1, 1, 0, 0, 0},
+            {1969, 12, 31, 23, 59, 59},
+            {2024, 2, 29, 12, 30, 45},
+            {-4712, 1, 1, 0, 0, 0},
+            {9999, 12, 31, 23, 59, 59}
+        };
+
+        for (const auto& fields : cases) {
+            const DateFields result = DateValue::fromFields(fields).toFields();
+            EXPECT_EQ(result.year, fields.year);
+            EXPECT_EQ(result.month, fields.month);
+            EXPECT_EQ(result.day, fields.day);
+            EXPECT_EQ(result.hour, fields.hour);
+            EXPECT_EQ(result.minute, fields.minute);
+            EXPECT_EQ(result.second, fields.second);
+        }
+        EXPECT_EQ(DateValue::fromCivil(1970, 1, 2).getEpochSeconds(), 86400);
+        EXPECT_EQ(DateValue::fromCivil(1969, 12, 31, 23, 59, 59).getEpochDays(), -1);
+    }
+
+    TEST_F(DateValueTest, FromFieldsShouldRejectInvalidDates) {
+        EXPECT_THROW((void)DateValue::fromFields({2023, 2, 29}), DataTypeException);
+        EXPECT_THROW((void)DateValue::fromFields({2024, 1, 1, 24, 0, 0}), DataTypeException);
+        EXPECT_THROW((void)DateValue::fromFields({10000, 1, 1}), DataTypeException);
+    }
+
+    TEST_F(DateValueTest, ComparisonShouldBeIntegerOrder) {
+        EXPECT_LT(DateValue::fromCivil(-1, 12, 31), DateValue::fromCivil(0, 1, 1));
+        EXPECT_LT(DateValue::fromCivil(2024, 1, 1, 0, 0, 0), DateValue::fromCivil(2024, 1, 1, 0, 0, 1));
+        EXPECT_EQ(DateValue::fromCivil(2024, 3, 1), DateValue::fromCivil(2024, 2, 30));
+    }
+
+    TEST_F(DateValueTest, BatchKernelsShouldConvertColumns) {
+        const std::vector<int> years = {2024, 2023, 1900, 2000};
+        const std::vector<int> months = {2, 2, 2, 2};
+        const std::vector<int> days = {29, 29, 29, 29};
+        const std::vector<int> zeros(4, 0);
+        const DateFieldColumns<const int> fields{years, months, days, zeros, zeros, zeros};
+
+        std::vector<uint64_t> invalid(1);
+        EXPECT_EQ(DateKernels::findInvalid(fields, invalid), 2u);
+        EXPECT_EQ(invalid[0], 0b0110u);
+
+        std::vector<DateValue> values(4);
+        DateKernels::fromFields(fields, values);
+        EXPECT_EQ(values[0], DateValue::fromCivil(2024, 2, 29));
+        EXPECT_EQ(values[3], DateValue::fromCivil(2000, 2, 29));
+
+        std::vector<int> outYear(4), outMonth(4), outDay(4), outHour(4), outMinute(4), outSecond(4);
+        DateKernels::toFields(values, DateFieldColumns<int>{outYear, outMonth, outDay, outHour, outMinute, outSecond});
+        EXPECT_EQ(outMonth[1], 3);  // 2023-02-29 se normaliza a 2023-03-01
+        EXPECT_EQ(outDay[1], 1);
+
+        const Bitmap selected = DateKernels::selectBetween(values, DateValue::fromCivil(2000, 1, 1),
+                                                           DateValue::fromCivil(2023, 12, 31));
+        EXPECT_EQ(selected.toSelection(), (std::vector<uint32_t>{1, 3}));
+    }
+
+    TEST_F(DateValueTest, ShouldEncodeOracleSevenByteFormat) {
+        using Bytes = std::array<uint8_t, DateValue::ENCODED_SIZE>;
+        EXPECT_EQ(DateValue::fromCivil(2024, 3, 15, 13, 5, 9).encode(), (Bytes{120, 124, 3, 15, 14, 6, 10}));
+        EXPECT_EQ(DateValue::fromCivil(1900, 1, 1).encode(), (Bytes{119, 100, 1, 1, 1, 1, 1}));
+        EXPECT_EQ(DateValue::fromCivil(-4712, 1, 1).encode(), (Bytes{53, 88, 1, 1, 1, 1, 1}));
+        EXPECT_EQ(DateValue::fromCivil(-1, 12, 31).encode(), (Bytes{100, 99, 12, 31, 1, 1, 1}));
+
+        const auto value = DateValue::fromCivil(9999, 12, 31, 23, 59, 59);
+        EXPECT_EQ(DateValue::decode(value.encode()), value);
+        EXPECT_THROW((void)DateValue::fromCivil(10000, 1, 1).encode(), DataTypeException);
+    }
+
+    TEST_F(DateValueTest, DecodeShouldRejectMalformedBytes) {
+        using Bytes = std::array<uint8_t, DateValue::ENCODED_SIZE>;
+        EXPECT_THROW((void)DateValue::decode(Bytes{120, 123, 2, 29, 1, 1, 1}), DataTypeException);  // 2023-02-29
+        EXPECT_THROW((void)DateValue::decode(Bytes{120, 124, 1, 1, 25, 1, 1}), DataTypeException);  // hora 24
+        EXPECT_THROW((void)DateValue::decode(Bytes{99, 150, 1, 1, 1, 1, 1}), DataTypeException);    // signos mezclados
+        EXPECT_THROW((void)DateValue::decode(std::array<uint8_t, 6>{120, 124, 1, 1, 1, 1}), DataTypeException);
+    }
+
+    TEST_F(DateValueTest, EncodedBytesShouldSortLikeDates) {
+        std::vector<DateValue> values;
+        for (int year : {-4712, -4701, -4700, -4699, -101, -100, -99, -1, 0, 1, 99, 100, 1969, 1970, 9999}) {
+            values.push_back(DateValue::fromCivil(year, 6, 15, 12, 0, 0));
+            values.push_back(DateValue::fromCivil(year, 1, 1));
+        }
+        std::sort(values.begin(), values.end());
+
+        std::vector<uint8_t> bytes(values.size() * DateValue::ENCODED_SIZE);
+        DateKernels::encode(values, bytes);
+        for (size_t i = 1; i < values.size(); ++i) {
+            EXPECT_LT(std::memcmp(bytes.data() + (i - 1) * DateValue::ENCODED_SIZE,
+                                  bytes.data() + i * DateValue::ENCODED_SIZE, DateValue::ENCODED_SIZE), 0)
+                << "index " << i;
+        }
+
+        std::vector<DateValue> decoded(values.size());
+        DateKernels::decode(bytes, decoded);
+        EXPECT_EQ(decoded, values);
+
+        bytes[3] = 32;  // día 32 en la primera fila
+        EXPECT_THROW(DateKernels::decode(bytes, decoded), DataTypeException);
+        values.push_back(DateValue::fromCivil(-4713, 12, 31));
+        bytes.resize(values.size() * DateValue::ENCODED_SIZE);
+        EXPECT_THROW(DateKernels::encode(values, bytes), DataTypeException);
+    }
+
+} // namespace db::types::test
@@ -0,0 +1,20 @@
+// tests/core/types/DateValueTest.hpp
+#ifndef DATE_VALUE_TEST_HPP
+#define DATE_VALUE_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/values/DateValue.hpp"
+#include "../../../src/core/types/kernels/DateKernels.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class DateValueTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // DATE_VALUE_TEST_HPP
@@ -0,0 +1,93 @@
+// tests/core/types/DecimalArithmeticTest.cpp
+#include "DecimalArithmeticTest.hpp"
+#include <vector>
+
+namespace db::types::test {
+
+    namespace {
+        Decimal128 dec(const char* text) {
+            return Decimal128::fromNumberValue(NumberValue::fromString(text));
+        }
+    }
+
+    TEST_F(DecimalArithmeticTest, AddShouldUseResultScale) {
+        const NumberType money{true, 12, 2};
+
+        EXPECT_EQ(DecimalArithmetic::add(dec("10.25"), dec("0.75"), money).toString(), "11.00");
+        EXPECT_EQ(DecimalArithmetic::add(dec("10.5"), dec("0.125"), money).toString(), "10.63");
+        EXPECT_EQ(DecimalArithmetic::subtract(dec("1.5"), dec("3.25"), money).toString(), "-1.75");
+        EXPECT_EQ(DecimalArithmetic::add(dec("-0.005"), dec("0"), money).toString(), "-0.01");
+    }
+
+    TEST_F(DecimalArithmeticTest, AddShouldCheckDeclaredPrecision) {
+        const NumberType small{true, 4, 2};
+
+        EXPECT_EQ(DecimalArithmetic::add(Decimal128{9000, 2}, Decimal128{999, 2}, small).toString(), "99.99");
+        EXPECT_THROW((void)DecimalArithmetic::add(Decimal128{9000, 2}, Decimal128{1000, 2}, small), DataTypeException);
+        EXPECT_THROW((void)DecimalArithmetic::subtract(Decimal128{-9000, 2}, Decimal128{1000, 2}, small), DataTypeException);
+    }
+
+    TEST_F(DecimalArithmeticTest, AddShouldHandleFullWidthOperands) {
+        const NumberType wide{true, 38, 0};
+        const auto big = dec("99999999999999999999999999999999999999");
+
+        EXPECT_THROW((void)DecimalArithmetic::add(big, big, wide), DataTypeException);
+        EXPECT_EQ(DecimalArithmetic::subtract(big, big, wide).toString(), "0");
+        EXPECT_EQ(DecimalArithmetic::add(big, dec("-0.4"), wide).toString(), "99999999999999999999999999999999999999");
+    }
+
+    TEST_F(DecimalArithmeticTest, MultiplyShouldRoundProduct) {
+        const NumberType money{true, 18, 2};
+
+        EXPECT_EQ(DecimalArithmetic::multiply(dec("19.99"), dec("3"), money).toString(), "59.97");
+        EXPECT_EQ(DecimalArithmetic::multiply(dec("10.00"), dec("0.0825"), money).toString(), "0.83");
+        EXPECT_EQ(DecimalArithmetic::multiply(dec("-2.5"), dec("2.5"), money).toString(), "-6.25");
+    }
+
+    TEST_F(DecimalArithmeticTest, MultiplyShouldUseWidePathWhenProductExceeds128Bits) {
+        const NumberType result{true, 38, 2};
+        const auto a = dec("1234567890.12345678901234567890123456");
+        const auto b = dec("1000.00000000000000000000000000000000");
+
+        EXPECT_EQ(DecimalArithmetic::multiply(a, b, result).toString(), "1234567890123.46");
+        EXPECT_THROW((void)DecimalArithmetic::multiply(dec("1E30"), dec("1E10"), result), DataTypeException);
+    }
+
+    TEST_F(DecimalArithmeticTest, DivideShouldRoundHalfAwayFromZero) {
+        const NumberType result{true, 20, 4};
+
+        EXPECT_EQ(DecimalArithmetic::divide(dec("10"), dec("3"), result).toString(), "3.3333");
+        EXPECT_EQ(DecimalArithmetic::divide(dec("-2"), dec("3"), result).toString(), "-0.6667");
+        EXPECT_EQ(DecimalArithmetic::divide(dec("1.00005"), dec("1"), result).toString(), "1.0001");
+        EXPECT_EQ(DecimalArithmetic::divide(dec("1"), dec("0.0001"), result).toString(), "10000.0000");
+        EXPECT_THROW((void)DecimalArithmetic::divide(dec("1"), dec("0"), result), DataTypeException);
+    }
+
+    TEST_F(DecimalArithmeticTest, RescaleShouldRoundAndCheckPrecision) {
+        EXPECT_EQ(DecimalArithmetic::rescale(dec("2.345"), NumberType{true, 5, 2}).toString(), "2.35");
+        EXPECT_EQ(DecimalArithmetic::rescale(dec("2.5"), NumberType{true, 5, 0}).toString(), "3");
+        EXPECT_EQ(DecimalArithmetic::rescale(dec("7"), NumberType{true, 5, 3}).toString(), "7.000");
+        EXPECT_THROW((void)DecimalArithmetic::rescale(dec("123"), NumberType{true, 5, 3}), DataTypeException);
+    }
+
+    TEST_F(DecimalArithmeticTest, SumAndAvgShouldRunOnScaledIntegers) {
+        const std::vector<int64_t> cents = {1999, 250, -100, 5};  // NUMBER(10,2)
+        const NumberType total{true, 38, 2};
+        const NumberType mean{true, 38, 4};
+
+        EXPECT_EQ(DecimalArithmetic::sum(std::span<const int64_t>(cents), 2, total).toString(), "21.54");
+        EXPECT_EQ(DecimalArithmetic::avg(std::span<const int64_t>(cents), 2, mean).toString(), "5.3850");
+        EXPECT_THROW((void)DecimalArithmetic::avg(std::span<const int64_t>(), 2, mean), DataTypeException);
+    }
+
+    TEST_F(DecimalArithmeticTest, WideSumShouldDetectOverflowButAverageExactly) {
+        const auto big = dec("99999999999999999999999999999999999999").getUnscaled();
+        const std::vector<int128_t> values = {big, big, big};
+        const NumberType wide{true, 38, 0};
+
+        EXPECT_THROW((void)DecimalArithmetic::sum(std::span<const int128_t>(values), 0, wide), DataTypeException);
+        EXPECT_EQ(DecimalArithmetic::avg(std::span<const int128_t>(values), 0, wide).toString(),
+                  "99999999999999999999999999999999999999");
+    }
+
+} // namespace db::types::test
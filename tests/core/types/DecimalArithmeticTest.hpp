@@ -0,0 +1,20 @@
+// tests/core/types/DecimalArithmeticTest.hpp
+#ifndef DECIMAL_ARITHMETIC_TEST_HPP
+#define DECIMAL_ARITHMETIC_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/kernels/DecimalArithmetic.hpp"
+#include "../../../src/core/types/NumberType.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class DecimalArithmeticTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // DECIMAL_ARITHMETIC_TEST_HPP
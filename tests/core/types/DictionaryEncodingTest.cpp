@@ -0,0 +1,72 @@
+// tests/core/types/DictionaryEncodingTest.cpp
+#include "DictionaryEncodingTest.hpp"
+#include <string>
+#include <vector>
+
+namespace db::types::test {
+
+    TEST_F(DictionaryEncodingTest, CodesShouldFollowValueOrder) {
+        const std::vector<std::string_view> values = {"ES", "FR", "DE", "ES", "IT", "DE", "ES"};
+        const auto column = DictionaryColumn::encode(TypeDescriptor::varchar2(2), values);
+
+        EXPECT_EQ(column.size(), values.size());
+        EXPECT_EQ(column.getDictionarySize(), 4u);
+        EXPECT_EQ(column.getCodeWidth(), 1u);
+        for (size_t i = 0; i < values.size(); ++i) {
+            EXPECT_EQ(column.valueAt(i), values[i]);
+            for (size_t j = 0; j < values.size(); ++j) {
+                EXPECT_EQ(column.codeAt(i) < column.codeAt(j), values[i] < values[j]);
+            }
+        }
+        EXPECT_EQ(column.entry(0), "DE");
+        EXPECT_EQ(column.find("IT"), 3u);
+        EXPECT_FALSE(column.find("PT"));
+    }
+
+    TEST_F(DictionaryEncodingTest, PredicatesShouldRunOnCodes) {
+        const std::vector<std::string_view> values = {"ES", "FR", "DE", "ES", "IT", "DE", "ES"};
+        const auto column = DictionaryColumn::encode(TypeDescriptor::varchar2(2), values);
+
+        EXPECT_EQ(column.selectEqual("ES").toSelection(), (std::vector<uint32_t>{0, 3, 6}));
+        EXPECT_TRUE(column.selectEqual("PT").none());
+        // Límites que no están en el diccionario
+        EXPECT_EQ(column.selectBetween("E", "G").toSelection(), (std::vector<uint32_t>{0, 1, 3, 6}));
+        EXPECT_EQ(column.selectBetween("DE", "ES").toSelection(), (std::vector<uint32_t>{0, 2, 3, 5, 6}));
+        EXPECT_TRUE(column.selectBetween("Z", "A").none());
+        const std::vector<std::string_view> list = {"IT", "FR", "PT"};
+        EXPECT_EQ(column.selectIn(list).toSelection(), (std::vector<uint32_t>{1, 4}));
+    }
+
+    TEST_F(DictionaryEncodingTest, CharShouldUseBlankPaddedSemantics) {
+        const std::vector<std::string_view> values = {"A   ", "A", "B  ", "A\x01", "AB"};
+        const auto column = DictionaryColumn::encode(TypeDescriptor::charType(4), values);
+
+        EXPECT_EQ(column.getDictionarySize(), 4u);
+        EXPECT_EQ(column.codeAt(0), column.codeAt(1));
+        EXPECT_EQ(column.valueAt(0), "A");
+        // 'A' se compara como 'A   ', que va después de 'A\x01'
+        EXPECT_LT(column.codeAt(3), column.codeAt(0));
+        EXPECT_EQ(column.selectEqual("A  ").toSelection(), (std::vector<uint32_t>{0, 1}));
+        EXPECT_EQ(column.selectBetween("A", "AB  ").toSelection(), (std::vector<uint32_t>{0, 1, 4}));
+
+        EXPECT_THROW(static_cast<void>(DictionaryColumn::encode(TypeDescriptor::charType(2), values)),
+                     DataTypeException);
+        EXPECT_THROW(static_cast<void>(DictionaryColumn::encode(TypeDescriptor::date(), values)), DataTypeException);
+    }
+
+    TEST_F(DictionaryEncodingTest, CodeWidthShouldGrowWithDistinctValues) {
+        std::vector<std::string> texts;
+        for (int i = 0; i < 300; ++i) {
+            texts.push_back(std::to_string(100000 + i));
+        }
+        std::vector<std::string_view> values(texts.begin(), texts.end());
+        const auto wide = DictionaryColumn::encode(TypeDescriptor::varchar2(10), values);
+        EXPECT_EQ(wide.getCodeWidth(), 2u);
+        EXPECT_EQ(wide.codeAt(299), 299u);
+        EXPECT_EQ(wide.selectBetween("100250", "100299").count(), 50u);
+
+        values.resize(256);
+        EXPECT_EQ(DictionaryColumn::encode(TypeDescriptor::varchar2(10), values).getCodeWidth(), 1u);
+    }
+
+} // namespace db::types::test
@@ -0,0 +1,19 @@
+// tests/core/types/DictionaryEncodingTest.hpp
+#ifndef DICTIONARY_ENCODING_TEST_HPP
+#define DICTIONARY_ENCODING_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/kernels/DictionaryEncoding.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class DictionaryEncodingTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // DICTIONARY_ENCODING_TEST_HPP
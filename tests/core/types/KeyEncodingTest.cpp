@@ -0,0 +1,128 @@
+// tests/core/types/KeyEncodingTest.cpp
+#include "KeyEncodingTest.hpp"
+#include <string>
+#include <vector>
+
+namespace db::types::test {
+
+    namespace {
+        int sign(int value) { return (value > 0) - (value < 0); }
+
+        int keyOrder(const KeyEncoder& encoder, const std::vector<KeyValue>& a, const std::vector<KeyValue>& b) {
+            return KeyEncoder::compare(encoder.encode(a), encoder.encode(b));
+        }
+    } // namespace
+
+    TEST_F(KeyEncodingTest, NumberKeysShouldFollowNumericOrder) {
+        const std::vector<std::string> texts = {"-1000", "-12.5", "-1.5", "-1.05", "-1", "-0.001", "0", "0.001",
+                                                "0.5", "1", "1.05", "1.5", "2", "99", "100", "100.01", "1E30"};
+        const KeyEncoder encoder({{TypeDescriptor::number(38, 0)}});
+        for (size_t i = 0; i < texts.size(); ++i) {
+            for (size_t j = 0; j < texts.size(); ++j) {
+                const KeyValue a = NumberValue::fromString(texts[i]);
+                const KeyValue b = NumberValue::fromString(texts[j]);
+                EXPECT_EQ(keyOrder(encoder, {a}, {b}), sign(static_cast<int>(i) - static_cast<int>(j)))
+                    << texts[i] << " vs " << texts[j];
+            }
+        }
+        // Misma clave sin importar la escala
+        EXPECT_EQ(encoder.encode(std::vector<KeyValue>{NumberValue::fromString("1.50")}),
+                  encoder.encode(std::vector<KeyValue>{NumberValue::fromString("1.5")}));
+    }
+
+    TEST_F(KeyEncodingTest, StringKeysShouldFollowSqlComparison) {
+        const KeyEncoder varchar({{TypeDescriptor::varchar2(10)}});
+        const KeyEncoder padded({{TypeDescriptor::charType(10)}});
+        using namespace std::string_view_literals;
+
+        EXPECT_LT(keyOrder(varchar, {"a"sv}, {"ab"sv}), 0);
+        EXPECT_LT(keyOrder(varchar, {"a"sv}, {"a "sv}), 0);
+        EXPECT_LT(keyOrder(varchar, {"a"sv}, {"a\0"sv}), 0);
+        EXPECT_LT(keyOrder(varchar, {"a\0"sv}, {"a\x01"sv}), 0);
+        EXPECT_LT(keyOrder(varchar, {""sv}, {"\0"sv}), 0);
+
+        // CHAR compara con relleno en blanco
+        EXPECT_EQ(padded.encode(std::vector<KeyValue>{"A"sv}), padded.encode(std::vector<KeyValue>{"A   "sv}));
+        EXPECT_LT(keyOrder(padded, {"A"sv}, {"AB"sv}), 0);
+
+        // UTF-8 ordena por punto de código
+        const KeyEncoder national({{TypeDescriptor::nvarchar2(10)}});
+        EXPECT_LT(keyOrder(national, {"z"sv}, {"ñ"sv}), 0);
+    }
+
+    TEST_F(KeyEncodingTest, PaddedKeysShouldMatchBlankPaddedComparison) {
+        using namespace std::string_view_literals;
+        const std::vector<std::string_view> values = {"A"sv, "A\t"sv, "A \t"sv, "A B"sv, "AB"sv, "A  "sv,
+                                                      "A \0"sv, "A  B"sv, ""sv, "\x01"sv, "ñ"sv};
+        for (const SortDirection direction : {SortDirection::ASCENDING, SortDirection::DESCENDING}) {
+            const int flip = direction == SortDirection::DESCENDING ? -1 : 1;
+            const KeyEncoder padded({{TypeDescriptor::charType(10), direction}});
+            const KeyEncoder national({{TypeDescriptor::nchar(10), direction}});
+            for (const std::string_view a : values) {
+                for (const std::string_view b : values) {
+                    const int expected = flip * CharType::compare(a, b);
+                    EXPECT_EQ(keyOrder(padded, {a}, {b}), expected) << "'" << a << "' vs '" << b << "'";
+                    EXPECT_EQ(keyOrder(national, {a}, {b}), expected) << "'" << a << "' vs '" << b << "'";
+                }
+            }
+        }
+    }
+
+    TEST_F(KeyEncodingTest, CompositeKeysShouldHonorDirectionAndNulls) {
+        using namespace std::string_view_literals;
+        const KeyEncoder encoder({{TypeDescriptor::varchar2(10)},
+                                  {TypeDescriptor::date(), SortDirection::DESCENDING},
+                                  {TypeDescriptor::number(5, 0), SortDirection::ASCENDING, NullPlacement::FIRST}});
+        const DateValue early = DateValue::fromCivil(2020, 1, 1);
+        const DateValue late = DateValue::fromCivil(2024, 6, 30, 12, 0, 0);
+        const KeyValue one = NumberValue::fromInt64(1);
+        const KeyValue null{};
+
+        // La primera columna decide aunque la segunda sea mayor
+        EXPECT_LT(keyOrder(encoder, {"a"sv, early, one}, {"b"sv, late, one}), 0);
+        // Fecha descendente y NULL primero por defecto en DESC
+        EXPECT_LT(keyOrder(encoder, {"a"sv, late, one}, {"a"sv, early, one}), 0);
+        EXPECT_LT(keyOrder(encoder, {"a"sv, null, one}, {"a"sv, late, one}), 0);
+        // La cadena más corta sigue siendo menor delante de otras columnas
+        EXPECT_LT(keyOrder(encoder, {"a"sv, early, one}, {"a "sv, late, one}), 0);
+        // NULLS FIRST explícito en ASC; NULL al final por defecto en ASC
+        EXPECT_LT(keyOrder(encoder, {"a"sv, early, null}, {"a"sv, early, one}), 0);
+        EXPECT_GT(keyOrder(encoder, {null, early, one}, {"zzz"sv, early, one}), 0);
+        EXPECT_EQ(keyOrder(encoder, {null, null, null}, {null, null, null}), 0);
+
+        EXPECT_THROW(static_cast<void>(encoder.encode(std::vector<KeyValue>{"a"sv, early})), DataTypeException);
+        EXPECT_THROW(static_cast<void>(encoder.encode(std::vector<KeyValue>{one, early, one})), DataTypeException);
+    }
+
+    TEST_F(KeyEncodingTest, TimestampKeysShouldIgnoreOffsetAndSortDescending) {
+        const KeyEncoder encoder({{TypeDescriptor::timestamp(9, true), SortDirection::DESCENDING}});
+        const KeyValue utc = TimestampValue::fromCivil(2024, 1, 1, 10, 0, 0);
+        const KeyValue madrid = TimestampValue::fromCivil(2024, 1, 1, 11, 0, 0, 0, 60);
+        const KeyValue later = TimestampValue::fromCivil(2024, 1, 1, 10, 0, 0, 1);
+        const KeyValue beforeEpoch = TimestampValue::fromCivil(1969, 12, 31, 23, 59, 59, 999'999'999);
+
+        EXPECT_EQ(encoder.encode(std::vector<KeyValue>{utc}), encoder.encode(std::vector<KeyValue>{madrid}));
+        EXPECT_LT(keyOrder(encoder, {later}, {utc}), 0);
+        EXPECT_LT(keyOrder(encoder, {utc}, {beforeEpoch}), 0);
+    }
+
+    TEST_F(KeyEncodingTest, BatchShouldMatchRowEncoding) {
+        using namespace std::string_view_literals;
+        const KeyEncoder encoder({{TypeDescriptor::charType(3)}, {TypeDescriptor::number(10, 2)}});
+        const std::vector<KeyValue> rows = {"b"sv, NumberValue::fromString("2.5"),
+                                            "a  "sv, KeyValue{},
+                                            "a"sv, NumberValue::fromString("-7")};
+        KeyBatch batch;
+        encoder.encodeBatch(rows, batch);
+        ASSERT_EQ(batch.size(), 3u);
+        for (size_t i = 0; i < batch.size(); ++i) {
+            const auto expected = encoder.encode(std::span<const KeyValue>(rows).subspan(i * 2, 2));
+            const auto key = batch.key(i);
+            EXPECT_EQ(std::vector<uint8_t>(key.begin(), key.end()), expected);
+        }
+        EXPECT_LT(KeyEncoder::compare(batch.key(2), batch.key(1)), 0);
+        EXPECT_LT(KeyEncoder::compare(batch.key(1), batch.key(0)), 0);
+        EXPECT_THROW(encoder.encodeBatch(std::span<const KeyValue>(rows).first(3), batch), DataTypeException);
+    }
+
+} // namespace db::types::test
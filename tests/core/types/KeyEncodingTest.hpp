@@ -0,0 +1,20 @@
+// tests/core/types/KeyEncodingTest.hpp
+#ifndef KEY_ENCODING_TEST_HPP
+#define KEY_ENCODING_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/kernels/KeyEncoding.hpp"
+#include "../../../src/core/types/CharType.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class KeyEncodingTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // KEY_ENCODING_TEST_HPP
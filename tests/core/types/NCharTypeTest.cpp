@@ -91,6 +91,15 @@ namespace db::types::test {
         }
     }
 
+    TEST_F(NCharTypeTest, ShouldRejectInvalidUtf8) {
+        NCharType ncharType{true, 5};
+
+        EXPECT_FALSE(ncharType.isValidValue("ab\xFF"));
+        EXPECT_THROW({
+            (void)ncharType.formatValue("ab\xC3");
+        }, DataTypeException);
+    }
+
     TEST_F(NCharTypeTest, CompareValuesShouldWorkCorrectly) {
         struct TestCase {
             std::string value1;
@@ -126,4 +135,22 @@ namespace db::types::test {
         EXPECT_EQ(customType->getLength(), 10);
     }
 
+    TEST_F(NCharTypeTest, StoredValuesShouldBeTrimmedAndPaddedOnRead) {
+        const NCharType type{true, 6};
+        StringArena arena;
+
+        const auto stored = type.tryMakeValue("ñandú ", arena);
+        ASSERT_TRUE(stored);
+        EXPECT_EQ(stored->view(), "ñandú");
+        EXPECT_EQ(type.formatStored(*stored), type.formatValue("ñandú"));
+        EXPECT_EQ(type.formatStored(*stored), "ñandú ");
+        const NCharType narrow(true, 3);
+        EXPECT_EQ(narrow.tryFormatStored(*stored).error().code(), TypeErrorCode::VALUE_TOO_MANY_CHARACTERS);
+
+        EXPECT_EQ(NCharType::compare(*stored, type.tryMakeValue("ñandú", arena).value()), 0);
+        EXPECT_EQ(NCharType::compare(*stored, type.tryMakeValue("ñu", arena).value()), -1);
+        EXPECT_EQ(type.tryMakeValue("\xC3", arena).error().code(), TypeErrorCode::INVALID_UTF8);
+        EXPECT_EQ(type.tryMakeValue("ñandúes", arena).error().code(), TypeErrorCode::VALUE_TOO_MANY_CHARACTERS);
+    }
+
 } // namespace db::types::test
\ No newline at end of file
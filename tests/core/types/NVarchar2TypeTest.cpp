@@ -92,6 +92,18 @@ namespace db::types::test {
         }
     }
 
+    TEST_F(NVarchar2TypeTest, FormatValueShouldReportInvalidUtf8Position) {
+        NVarchar2Type nvarchar2Type{true, 10};
+
+        EXPECT_FALSE(nvarchar2Type.isValidValue("ok\xE3\x81"));
+        try {
+            (void)nvarchar2Type.formatValue("abc\x80");
+            FAIL() << "Expected DataTypeException";
+        } catch (const DataTypeException& e) {
+            EXPECT_NE(std::string(e.what()).find("byte 3"), std::string::npos);
+        }
+    }
+
     TEST_F(NVarchar2TypeTest, CompareValuesShouldBeExact) {
         struct TestCase {
             std::string value1;
@@ -0,0 +1,115 @@
+// tests/core/types/NumberKeyKernelsTest.cpp
+#include "NumberKeyKernelsTest.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace db::types::test {
+
+    namespace {
+        std::vector<uint8_t> keyOf(const NumberValue& value) {
+            std::vector<uint8_t> key(NumberValue::MAX_KEY_SIZE);
+            key.resize(value.encodeKey(key));
+            return key;
+        }
+
+        const std::vector<std::string> ORDERED = {
+            "-99999999999999999999999999999999999999", "-123456789012345678901", "-1000000", "-999999.99",
+            "-12.5", "-1.5", "-1.05", "-1", "-0.5", "-0.00001", "0", "0.00000000000000000000000000000000000001",
+            "0.00001", "0.5", "1", "1.05", "1.5", "2", "99", "100", "101", "999999999999999999",
+            "1000000000000000000", "123456789012345678901", "99999999999999999999999999999999999999"};
+    } // namespace
+
+    TEST_F(NumberKeyKernelsTest, KeysShouldFollowNumericOrder) {
+        for (size_t i = 0; i < ORDERED.size(); ++i) {
+            for (size_t j = 0; j < ORDERED.size(); ++j) {
+                const auto a = keyOf(NumberValue::fromString(ORDERED[i]));
+                const auto b = keyOf(NumberValue::fromString(ORDERED[j]));
+                EXPECT_EQ(std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()), i < j)
+                    << ORDERED[i] << " vs " << ORDERED[j];
+            }
+        }
+    }
+
+    TEST_F(NumberKeyKernelsTest, KeysShouldIgnoreScale) {
+        EXPECT_EQ(keyOf(NumberValue::fromString("1.50")), keyOf(NumberValue::fromString("1.5")));
+        EXPECT_EQ(keyOf(NumberValue::fromScaled(150000, 5)), keyOf(NumberValue::fromString("1.5")));
+        EXPECT_EQ(keyOf(NumberValue::fromString("-1200.00")), keyOf(NumberValue::fromInt64(-1200)));
+        EXPECT_EQ(keyOf(NumberValue::fromInt64(1)), (std::vector<uint8_t>{0xC1, 0x02, 0x00}));
+        EXPECT_EQ(keyOf(NumberValue::fromInt64(-1)), (std::vector<uint8_t>{0x3E, 0x64, 0x66}));
+        EXPECT_EQ(keyOf(NumberValue{}), (std::vector<uint8_t>{0x80}));
+    }
+
+    TEST_F(NumberKeyKernelsTest, SmallCoefficientPathShouldMatchBase100Encoding) {
+        // La vía de 64 bits debe producir la codificación de encode() más el terminador
+        for (int64_t coefficient : {1LL, 7LL, 10LL, 12LL, 120LL, 1200LL, 123456789LL, 100000000000000000LL,
+                                    999999999999999999LL}) {
+            for (size_t scale : {0u, 1u, 2u, 3u, 17u, 18u, 37u, 38u}) {
+                for (const bool negative : {false, true}) {
+                    const NumberValue value = NumberValue::fromScaled(static_cast<uint128_t>(coefficient), scale,
+                                                                      negative);
+                    auto expected = value.encode();
+                    expected.push_back(negative ? 102 : 0);
+                    EXPECT_EQ(keyOf(value), expected) << coefficient << " scale " << scale;
+                }
+            }
+        }
+    }
+
+    TEST_F(NumberKeyKernelsTest, BatchShouldRoundTrip) {
+        std::vector<NumberValue> values;
+        for (const auto& text : ORDERED) {
+            values.push_back(NumberValue::fromString(text));
+        }
+        std::vector<uint8_t> keys(values.size() * NumberValue::MAX_KEY_SIZE);
+        std::vector<uint32_t> ends(values.size());
+        const size_t total = NumberKeyKernels::encodeBatch(values, keys, ends);
+        EXPECT_EQ(total, ends.back());
+
+        uint32_t start = 0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            const std::span<const uint8_t> key(keys.data() + start, ends[i] - start);
+            EXPECT_EQ(NumberValue::keyLength(std::span<const uint8_t>(keys).subspan(start)), key.size());
+            EXPECT_EQ(std::vector<uint8_t>(key.begin(), key.end()), keyOf(values[i]));
+            start = ends[i];
+        }
+
+        std::vector<NumberValue> decoded(values.size());
+        NumberKeyKernels::decodeBatch(std::span<const uint8_t>(keys.data(), total), ends, decoded);
+        EXPECT_EQ(decoded, values);
+        EXPECT_THROW(NumberKeyKernels::encodeBatch(values, std::span<uint8_t>(keys).first(total), ends),
+                     DataTypeException);
+    }
+
+    TEST_F(NumberKeyKernelsTest, NativeColumnShouldEncodeLikeValues) {
+        const NumberType column(false, 18, 0);
+        const std::vector<int64_t> ids = {-999999999999999999, -42, 0, 1, 7, 100, 999999999999999999};
+        std::vector<uint8_t> keys(ids.size() * NumberValue::MAX_KEY_SIZE);
+        std::vector<uint32_t> ends(ids.size());
+        NumberKeyKernels::encodeBatch(column, std::span<const int64_t>(ids), keys, ends);
+
+        uint32_t start = 0;
+        for (size_t i = 0; i < ids.size(); ++i) {
+            const std::vector<uint8_t> key(keys.begin() + start, keys.begin() + ends[i]);
+            EXPECT_EQ(key, keyOf(NumberValue::fromInt64(ids[i])));
+            start = ends[i];
+        }
+
+        const NumberType money(true, 10, 2);
+        const std::vector<int32_t> cents = {150};
+        NumberKeyKernels::encodeBatch(money, std::span<const int32_t>(cents), keys, ends);
+        EXPECT_EQ(std::vector<uint8_t>(keys.begin(), keys.begin() + ends[0]), keyOf(NumberValue::fromString("1.5")));
+    }
+
+    TEST_F(NumberKeyKernelsTest, MalformedKeysShouldBeRejected) {
+        EXPECT_THROW(static_cast<void>(NumberValue::decodeKey(std::vector<uint8_t>{})), DataTypeException);
+        // Sin terminador o con bytes detrás
+        EXPECT_THROW(static_cast<void>(NumberValue::decodeKey(std::vector<uint8_t>{0xC1, 0x02})), DataTypeException);
+        EXPECT_THROW(static_cast<void>(NumberValue::decodeKey(std::vector<uint8_t>{0xC1, 0x02, 0x00, 0x01})),
+                     DataTypeException);
+        EXPECT_EQ(NumberValue::keyLength(std::vector<uint8_t>{0x3E, 0x64}), 0u);
+        EXPECT_EQ(NumberValue::decodeKey(std::vector<uint8_t>{0x3E, 0x64, 0x66}), NumberValue::fromInt64(-1));
+    }
+
+} // namespace db::types::test
@@ -0,0 +1,19 @@
+// tests/core/types/NumberKeyKernelsTest.hpp
+#ifndef NUMBER_KEY_KERNELS_TEST_HPP
+#define NUMBER_KEY_KERNELS_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/kernels/NumberKeyKernels.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class NumberKeyKernelsTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // NUMBER_KEY_KERNELS_TEST_HPP
@@ -0,0 +1,77 @@
+// tests/core/types/NumberRangeKernelsTest.cpp
+#include "NumberRangeKernelsTest.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace db::types::test {
+
+    TEST_F(NumberRangeKernelsTest, DoubleKernelShouldMatchScalarIsInRange) {
+        const NumberType type{true, 3, 1};
+        const std::vector<double> values = {
+            99.9, -99.9, 0.0, 50.5, -50.5, 99.8, -99.8, 100.0, -100.0, 150.5, -150.5,
+            99.94, 99.95, -99.95, std::numeric_limits<double>::quiet_NaN(),
+            std::numeric_limits<double>::infinity(), 1e-9
+        };
+
+        const Bitmap failed = NumberRangeKernels::findOutOfRange(type, std::span<const double>(values));
+
+        ASSERT_EQ(failed.size(), values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            EXPECT_EQ(failed.test(i), !type.isInRange(values[i])) << "Failed for value=" << values[i];
+        }
+        EXPECT_EQ(failed.toSelection(), (std::vector<uint32_t>{7, 8, 9, 10, 12, 13, 14, 15}));
+    }
+
+    TEST_F(NumberRangeKernelsTest, DoubleKernelShouldHandleLongColumns) {
+        const NumberType type{true, 5, 2};
+        std::vector<double> values(1000);
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = (i % 7 == 0) ? 1000.0 + static_cast<double>(i) : static_cast<double>(i) / 10.0;
+        }
+
+        std::vector<uint64_t> words(Bitmap::wordsFor(values.size()), ~uint64_t{0});
+        const size_t failedCount = NumberRangeKernels::findOutOfRange(type, std::span<const double>(values), words);
+
+        size_t expected = 0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            const bool bit = (words[i / 64] >> (i % 64)) & 1;
+            EXPECT_EQ(bit, !type.isInRange(values[i])) << "Failed at index " << i;
+            expected += bit ? 1 : 0;
+        }
+        EXPECT_EQ(failedCount, expected);
+    }
+
+    TEST_F(NumberRangeKernelsTest, Int64KernelShouldCheckIntegerDigits) {
+        const NumberType type{true, 6, 2};  // hasta 9999.99
+        const std::vector<int64_t> values = {0, 9999, -9999, 10000, -10000, 42, 123456789, -1};
+
+        const Bitmap failed = NumberRangeKernels::findOutOfRange(type, std::span<const int64_t>(values));
+
+        EXPECT_EQ(failed.toSelection(), (std::vector<uint32_t>{3, 4, 6}));
+    }
+
+    TEST_F(NumberRangeKernelsTest, Int64KernelShouldAcceptAnyValueForWidePrecision) {
+        const NumberType type{true, 19, 0};
+        const std::vector<int64_t> values = {
+            std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(), 0, -5, 7
+        };
+
+        EXPECT_TRUE(NumberRangeKernels::findOutOfRange(type, std::span<const int64_t>(values)).none());
+    }
+
+    TEST_F(NumberRangeKernelsTest, DecimalKernelShouldBeExact) {
+        const NumberType type{true, 38, 2};
+        const std::vector<NumberValue> values = {
+            NumberValue::fromString("999999999999999999999999999999999999.99"),
+            NumberValue::fromString("-999999999999999999999999999999999999.99"),
+            NumberValue::fromString("999999999999999999999999999999999999.995"),
+            NumberValue::fromString("12.345")
+        };
+
+        const Bitmap failed = NumberRangeKernels::findOutOfRange(type, std::span<const NumberValue>(values));
+
+        EXPECT_EQ(failed.toSelection(), (std::vector<uint32_t>{2}));
+    }
+
+} // namespace db::types::test
@@ -0,0 +1,19 @@
+// tests/core/types/NumberRangeKernelsTest.hpp
+#ifndef NUMBER_RANGE_KERNELS_TEST_HPP
+#define NUMBER_RANGE_KERNELS_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/kernels/NumberRangeKernels.hpp"
+#include "../../../src/core/types/NumberType.hpp"
+
+namespace db::types::test {
+
+    class NumberRangeKernelsTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // NUMBER_RANGE_KERNELS_TEST_HPP
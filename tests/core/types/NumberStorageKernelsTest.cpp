@@ -0,0 +1,76 @@
+// tests/core/types/NumberStorageKernelsTest.cpp
+#include "NumberStorageKernelsTest.hpp"
+#include <vector>
+
+namespace db::types::test {
+
+    TEST_F(NumberStorageKernelsTest, PackShouldStoreScaledIntegers) {
+        const NumberType column{true, 9, 2};
+        const std::vector<NumberValue> values = {
+            NumberValue::fromString("12.5"), NumberValue::fromString("-0.015"), NumberValue::fromString("9999999.99")
+        };
+        std::vector<int32_t> packed(values.size());
+
+        NumberStorageKernels::pack(column, std::span<const NumberValue>(values), std::span<int32_t>(packed));
+
+        EXPECT_EQ(packed, (std::vector<int32_t>{1250, -2, 999999999}));
+    }
+
+    TEST_F(NumberStorageKernelsTest, PackShouldRejectValuesOutOfPrecisionAndNarrowStorage) {
+        const NumberType column{true, 9, 2};
+        const std::vector<NumberValue> values = {NumberValue::fromString("10000000")};
+        std::vector<int32_t> packed(1);
+
+        EXPECT_THROW(NumberStorageKernels::pack(column, std::span<const NumberValue>(values), std::span<int32_t>(packed)),
+                     DataTypeException);
+        EXPECT_THROW(NumberStorageKernels::pack(NumberType{true, 18, 0}, std::span<const NumberValue>(values),
+                                                std::span<int32_t>(packed)),
+                     DataTypeException);
+    }
+
+    TEST_F(NumberStorageKernelsTest, UnpackShouldRoundTripEveryWidth) {
+        const NumberType columns[] = {NumberType{true, 9, 3}, NumberType{true, 18, 3}, NumberType{true, 38, 3}};
+        const std::vector<NumberValue> values = {
+            NumberValue::fromString("-1.5"), NumberValue::fromString("0"), NumberValue::fromString("123456.789")
+        };
+
+        for (const auto& column : columns) {
+            dispatchPhysicalWidth(column.getPhysicalLayout().width, [&](auto width) {
+                using Storage = physical_storage_t<decltype(width)::value>;
+                std::vector<Storage> packed(values.size());
+                std::vector<NumberValue> unpacked(values.size());
+
+                NumberStorageKernels::pack(column, std::span<const NumberValue>(values), std::span<Storage>(packed));
+                NumberStorageKernels::unpack(column, std::span<const Storage>(packed), std::span<NumberValue>(unpacked));
+
+                EXPECT_EQ(sizeof(Storage), column.getPhysicalLayout().size);
+                EXPECT_EQ(unpacked, values) << "Failed for " << column.getName();
+            });
+        }
+    }
+
+    TEST_F(NumberStorageKernelsTest, SumShouldAccumulateWithoutOverflow) {
+        const NumberType column{true, 9, 0};
+        const std::vector<int32_t> values(1000, 999999999);
+
+        const auto total = NumberStorageKernels::sum(column, std::span<const int32_t>(values), NumberType{true, 38, 0});
+
+        EXPECT_EQ(total.toString(), "999999999000");
+    }
+
+    TEST_F(NumberStorageKernelsTest, SelectBetweenShouldMarkMatchingRows) {
+        std::vector<int64_t> values(130);
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = static_cast<int64_t>(i) - 5;
+        }
+
+        const Bitmap selected = NumberStorageKernels::selectBetween(std::span<const int64_t>(values), int64_t{-1}, int64_t{70});
+
+        EXPECT_EQ(selected.count(), 72u);
+        EXPECT_FALSE(selected.test(3));
+        EXPECT_TRUE(selected.test(4));
+        EXPECT_TRUE(selected.test(75));
+        EXPECT_FALSE(selected.test(76));
+    }
+
+} // namespace db::types::test
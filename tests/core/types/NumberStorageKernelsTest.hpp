@@ -0,0 +1,20 @@
+// tests/core/types/NumberStorageKernelsTest.hpp
+#ifndef NUMBER_STORAGE_KERNELS_TEST_HPP
+#define NUMBER_STORAGE_KERNELS_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/kernels/NumberStorageKernels.hpp"
+#include "../../../src/core/types/NumberType.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class NumberStorageKernelsTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // NUMBER_STORAGE_KERNELS_TEST_HPP
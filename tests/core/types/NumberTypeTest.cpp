@@ -177,6 +177,30 @@ namespace db::types::test {
         }
     }
 
+    TEST_F(NumberTypeTest, PhysicalLayoutShouldPickNarrowestWidth) {
+        struct TestCase {
+            size_t precision;
+            size_t scale;
+            PhysicalWidth expectedWidth;
+            size_t expectedSize;
+        };
+
+        const TestCase testCases[] = {
+            {1, 0, PhysicalWidth::INT32, 4},
+            {9, 2, PhysicalWidth::INT32, 4},
+            {10, 0, PhysicalWidth::INT64, 8},
+            {18, 4, PhysicalWidth::INT64, 8},
+            {19, 0, PhysicalWidth::INT128, 16},
+            {38, 10, PhysicalWidth::INT128, 16}
+        };
+
+        for (const auto& tc : testCases) {
+            const auto layout = NumberType{true, tc.precision, tc.scale}.getPhysicalLayout();
+            EXPECT_EQ(layout.width, tc.expectedWidth) << "Failed for precision=" << tc.precision;
+            EXPECT_EQ(layout.size, tc.expectedSize) << "Failed for precision=" << tc.precision;
+            EXPECT_EQ(layout.scale, tc.scale);
+        }
+    }
 
     TEST_F(NumberTypeTest, FactoryMethodsShouldCreateValidInstances) {
         // Especificamos explícitamente los tipos para evitar problemas de deducción
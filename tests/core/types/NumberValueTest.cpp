@@ -0,0 +1,147 @@
+// tests/core/types/NumberValueTest.cpp
+#include "NumberValueTest.hpp"
+
+namespace db::types::test {
+
+    TEST_F(NumberValueTest, FromStringShouldParseExactly) {
+        struct TestCase {
+            std::string input;
+            std::string expected;
+        };
+
+        const TestCase testCases[] = {
+            {"0", "0"},
+            {"-0.000", "0"},
+            {"123.45", "123.45"},
+            {"-123.45", "-123.45"},
+            {"+.5", "0.5"},
+            {"1.50", "1.5"},
+            {"1.5E3", "1500"},
+            {"12345E-7", "0.0012345"},
+            {"99999999999999999999999999999999999999", "99999999999999999999999999999999999999"},
+            {"0.12345678901234567890123456789012345678", "0.12345678901234567890123456789012345678"}
+        };
+
+        for (const auto& tc : testCases) {
+            EXPECT_EQ(NumberValue::fromString(tc.input).toString(), tc.expected)
+                << "Failed for " << tc.input;
+        }
+    }
+
+    TEST_F(NumberValueTest, FromStringShouldRoundBeyondMaximumDigits) {
+        // 39 dígitos significativos: se redondea la mitad alejándose de cero
+        EXPECT_EQ(NumberValue::fromString("1.234567890123456789012345678901234567895").toString(),
+                  "1.2345678901234567890123456789012345679");
+        EXPECT_EQ(NumberValue::fromString("-9.9999999999999999999999999999999999999").toString(),
+                  "-9.9999999999999999999999999999999999999");
+        EXPECT_EQ(NumberValue::fromString("9.99999999999999999999999999999999999999").toString(), "10");
+    }
+
+    TEST_F(NumberValueTest, ToCharsShouldMatchToStringWithoutAllocating) {
+        char text[NumberValue::MAX_STRING_LENGTH];
+        for (const char* input : {"0", "-12.5", "0.001", "-0.00000000000000000000000000000000000001",
+                                  "-99999999999999999999999999999999999999", "123.4500"}) {
+            const NumberValue value = NumberValue::fromString(input);
+            EXPECT_EQ(std::string_view(text, value.toChars(text)), value.toString()) << input;
+        }
+        // El caso más largo: signo, "0." y 38 dígitos de fracción
+        EXPECT_EQ(NumberValue::fromScaled(1, NumberValue::MAX_SCALE, true).toChars(text),
+                  NumberValue::MAX_STRING_LENGTH);
+        EXPECT_THROW((void)NumberValue::fromString("-12.5").toChars(std::span<char>(text, 4)), DataTypeException);
+    }
+
+    TEST_F(NumberValueTest, FromStringShouldRejectInvalidInput) {
+        EXPECT_THROW((void)NumberValue::fromString(""), DataTypeException);
+        EXPECT_THROW((void)NumberValue::fromString("-"), DataTypeException);
+        EXPECT_THROW((void)NumberValue::fromString("1.2.3"), DataTypeException);
+        EXPECT_THROW((void)NumberValue::fromString("12a"), DataTypeException);
+        EXPECT_THROW((void)NumberValue::fromString("1E"), DataTypeException);
+        EXPECT_THROW((void)NumberValue::fromString("100000000000000000000000000000000000000"), DataTypeException);
+    }
+
+    TEST_F(NumberValueTest, RoundToScaleShouldRoundHalfAwayFromZero) {
+        EXPECT_EQ(NumberValue::fromString("2.345").roundToScale(2).toString(), "2.35");
+        EXPECT_EQ(NumberValue::fromString("-2.345").roundToScale(2).toString(), "-2.35");
+        EXPECT_EQ(NumberValue::fromString("2.344").roundToScale(2).toString(), "2.34");
+        EXPECT_EQ(NumberValue::fromString("1.5").roundToScale(3).toString(), "1.500");
+        EXPECT_EQ(NumberValue::fromString("0.4").roundToScale(0).toString(), "0");
+    }
+
+    TEST_F(NumberValueTest, FitsInShouldBeExactForWidePrecisions) {
+        const NumberType money{true, 38, 2};
+        // 36 dígitos enteros: el máximo de NUMBER(38,2)
+        EXPECT_TRUE(money.isInRange(NumberValue::fromString("999999999999999999999999999999999999.99")));
+        EXPECT_FALSE(money.isInRange(NumberValue::fromString("999999999999999999999999999999999999.995")));
+        EXPECT_FALSE(money.isInRange(NumberValue::fromString("1000000000000000000000000000000000000")));
+
+        const NumberType small{true, 3, 1};
+        EXPECT_TRUE(small.isInRange(NumberValue::fromString("99.94")));
+        EXPECT_FALSE(small.isInRange(NumberValue::fromString("99.95")));
+        EXPECT_TRUE(small.isInRange(NumberValue::fromString("-99.9")));
+        EXPECT_TRUE(small.isInRange(NumberValue::fromString("0.001")));
+    }
+
+    TEST_F(NumberValueTest, CoerceToShouldApplyTypeScale) {
+        const NumberType type{true, 10, 2};
+        EXPECT_EQ(NumberValue::fromString("12.3456").coerceTo(type).toString(), "12.35");
+        EXPECT_THROW((void)NumberValue::fromString("123456789").coerceTo(type), DataTypeException);
+    }
+
+    TEST_F(NumberValueTest, ComparisonShouldBeNumeric) {
+        EXPECT_EQ(NumberValue::fromString("1.50"), NumberValue::fromString("1.5"));
+        EXPECT_EQ(NumberValue::fromString("1.5").roundToScale(4), NumberValue::fromString("1.5"));
+        EXPECT_LT(NumberValue::fromString("-2"), NumberValue::fromString("-1.5"));
+        EXPECT_LT(NumberValue::fromString("-0.1"), NumberValue::fromString("0"));
+        EXPECT_LT(NumberValue::fromString("1.05"), NumberValue::fromString("1.5"));
+        EXPECT_GT(NumberValue::fromString("10"), NumberValue::fromString("9.99999"));
+    }
+
+    TEST_F(NumberValueTest, EncodeShouldUseOracleBase100Format) {
+        EXPECT_EQ(NumberValue{}.encode(), (std::vector<uint8_t>{0x80}));
+        EXPECT_EQ(NumberValue::fromInt64(1).encode(), (std::vector<uint8_t>{0xC1, 0x02}));
+        EXPECT_EQ(NumberValue::fromInt64(100).encode(), (std::vector<uint8_t>{0xC2, 0x02}));
+        EXPECT_EQ(NumberValue::fromString("123.45").encode(), (std::vector<uint8_t>{0xC2, 0x02, 0x18, 0x2E}));
+        EXPECT_EQ(NumberValue::fromString("0.5").encode(), (std::vector<uint8_t>{0xC0, 0x33}));
+        EXPECT_EQ(NumberValue::fromInt64(-1).encode(), (std::vector<uint8_t>{0x3E, 0x64}));
+    }
+
+    TEST_F(NumberValueTest, EncodeDecodeShouldRoundTrip) {
+        const char* values[] = {
+            "0", "1", "-1", "1.5", "-1.5", "0.05", "123456789.123", "-0.00000000000000000000000000000000000001",
+            "99999999999999999999999999999999999999", "-12345678901234567890123456789012345678",
+            "1234567890123456789012345678901234567.8", "0.10000000000000000000000000000000000001"
+        };
+
+        for (const char* text : values) {
+            const auto value = NumberValue::fromString(text);
+            const auto bytes = value.encode();
+            EXPECT_LE(bytes.size(), NumberValue::MAX_ENCODED_SIZE) << text;
+            EXPECT_EQ(bytes.size(), value.encodedSize()) << text;
+            EXPECT_EQ(NumberValue::decode(bytes).toString(), value.toString()) << text;
+        }
+    }
+
+    TEST_F(NumberValueTest, EncodedSizeShouldRespectTypeBound) {
+        const NumberType type{true, 10, 3};
+        const char* values[] = {"1234567.891", "-9999999.999", "0.001", "1", "-0.5"};
+        for (const char* text : values) {
+            EXPECT_LE(NumberValue::fromString(text).encodedSize(), NumberValue::maxEncodedSize(type)) << text;
+        }
+        EXPECT_EQ(NumberValue::maxEncodedSize(NumberType{true, 9, 0}), NumberType(true, 9, 0).getSize());
+    }
+
+    TEST_F(NumberValueTest, DecodeShouldRejectMalformedInput) {
+        EXPECT_THROW((void)NumberValue::decode(std::vector<uint8_t>{}), DataTypeException);
+        EXPECT_THROW((void)NumberValue::decode(std::vector<uint8_t>{0xC1}), DataTypeException);
+        EXPECT_THROW((void)NumberValue::decode(std::vector<uint8_t>{0xC1, 0x00}), DataTypeException);
+        EXPECT_THROW((void)NumberValue::decode(std::vector<uint8_t>{0xC1, 0x01}), DataTypeException);
+    }
+
+    TEST_F(NumberValueTest, FromDoubleShouldUseShortestRepresentation) {
+        EXPECT_EQ(NumberValue::fromDouble(0.1).toString(), "0.1");
+        EXPECT_EQ(NumberValue::fromDouble(-2.5e-3).toString(), "-0.0025");
+        EXPECT_EQ(NumberValue::fromDouble(1e20).toString(), "100000000000000000000");
+        EXPECT_THROW((void)NumberValue::fromDouble(1e300), DataTypeException);
+    }
+
+} // namespace db::types::test
@@ -0,0 +1,20 @@
+// tests/core/types/NumberValueTest.hpp
+#ifndef NUMBER_VALUE_TEST_HPP
+#define NUMBER_VALUE_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/values/NumberValue.hpp"
+#include "../../../src/core/types/NumberType.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class NumberValueTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // NUMBER_VALUE_TEST_HPP
@@ -0,0 +1,117 @@
+// tests/core/types/PaddingKernelsTest.cpp
+#include "PaddingKernelsTest.hpp"
+#include <string>
+#include <vector>
+
+namespace db::types::test {
+
+    TEST_F(PaddingKernelsTest, SlotWidthShouldCoverWorstCaseBytes) {
+        EXPECT_EQ(PaddingKernels::slotWidth(TypeDescriptor::charType(10)), 10u);
+        EXPECT_EQ(PaddingKernels::slotWidth(TypeDescriptor::nchar(10)), 40u);
+        EXPECT_THROW((void)PaddingKernels::slotWidth(TypeDescriptor::varchar2(10)), DataTypeException);
+    }
+
+    TEST_F(PaddingKernelsTest, CharSlotsShouldMatchFormatValue) {
+        const CharType type{true, 5};
+        const std::vector<std::string_view> values = {"AB", "", "ABCDE", "TOOLONG", "X"};
+        std::vector<char> out(values.size() * 5, '#');
+        std::vector<uint32_t> lengths(values.size());
+        Bitmap invalid(values.size());
+
+        EXPECT_EQ(PaddingKernels::padToSlots(type.getDescriptor(), values, out, lengths, invalid.words()), 1u);
+        EXPECT_EQ(invalid.toSelection(), (std::vector<uint32_t>{3}));
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (i == 3) {
+                EXPECT_EQ(lengths[i], 0u);
+                EXPECT_EQ(std::string_view(out.data() + i * 5, 5), "#####");
+                continue;
+            }
+            EXPECT_EQ(std::string_view(out.data() + i * 5, lengths[i]), type.formatValue(std::string(values[i])));
+        }
+    }
+
+    TEST_F(PaddingKernelsTest, NCharSlotsShouldPadByCharacters) {
+        const NCharType type{true, 4};
+        const std::vector<std::string_view> values = {"ñu", "日本語", "abcde", "\xC3", "ab  "};
+        const size_t width = PaddingKernels::slotWidth(type.getDescriptor());
+        std::vector<char> out(values.size() * width);
+        std::vector<uint32_t> lengths(values.size());
+        Bitmap invalid(values.size());
+
+        EXPECT_EQ(PaddingKernels::padToSlots(type.getDescriptor(), values, out, lengths, invalid.words()), 2u);
+        EXPECT_EQ(invalid.toSelection(), (std::vector<uint32_t>{2, 3}));
+        EXPECT_EQ(std::string_view(out.data(), lengths[0]), "ñu  ");
+        EXPECT_EQ(std::string_view(out.data() + width, lengths[1]), "日本語 ");
+        EXPECT_EQ(std::string_view(out.data() + 4 * width, lengths[4]), "ab  ");
+        for (const size_t i : {0u, 1u, 4u}) {
+            EXPECT_EQ(std::string_view(out.data() + i * width, lengths[i]),
+                      type.formatValue(std::string(values[i])));
+        }
+    }
+
+    TEST_F(PaddingKernelsTest, ArenaShouldHoldPaddedValues) {
+        const std::vector<std::string_view> values = {"Y", "N", "MAYBE?", ""};
+        std::vector<std::string_view> out(values.size());
+        Bitmap invalid(values.size());
+
+        EXPECT_EQ(PaddingKernels::padToArena(TypeDescriptor::charType(3), values, arena, out, invalid.words()), 1u);
+        EXPECT_EQ(out[0], "Y  ");
+        EXPECT_EQ(out[1], "N  ");
+        EXPECT_TRUE(out[2].empty());
+        EXPECT_EQ(out[3], "   ");
+        EXPECT_EQ(arena.bytesUsed(), 9u);
+        EXPECT_EQ(arena.blockCount(), 1u);
+    }
+
+    TEST_F(PaddingKernelsTest, ShortOutputShouldThrow) {
+        const std::vector<std::string_view> values = {"A", "B"};
+        std::vector<char> out(3);
+        std::vector<uint32_t> lengths(values.size());
+        std::vector<std::string_view> views(1);
+        Bitmap invalid(values.size());
+
+        EXPECT_THROW(PaddingKernels::padToSlots(TypeDescriptor::charType(2), values, out, lengths, invalid.words()),
+                     DataTypeException);
+        EXPECT_THROW(PaddingKernels::padToArena(TypeDescriptor::charType(2), values, arena, views, invalid.words()),
+                     DataTypeException);
+    }
+
+    TEST_F(PaddingKernelsTest, TrimmedColumnShouldPadOnRead) {
+        const TypeDescriptor type = TypeDescriptor::nchar(20);
+        const std::vector<std::string_view> values = {"Y", "Y                   ", "ñandú y cóndor", "",
+                                                      "demasiado largo para NCHAR(20)"};
+        std::vector<CompactString> stored(values.size());
+        Bitmap invalid(values.size());
+
+        EXPECT_EQ(PaddingKernels::trimToCompact(type, values, arena, stored, invalid.words()), 1u);
+        EXPECT_EQ(invalid.toSelection(), (std::vector<uint32_t>{4}));
+        EXPECT_EQ(stored[0], stored[1]);
+        EXPECT_TRUE(stored[0].isInline());
+        EXPECT_EQ(stored[2].view(), "ñandú y cóndor");
+        EXPECT_TRUE(stored[4].empty());
+        EXPECT_EQ(arena.bytesUsed(), std::string_view("ñandú y cóndor").size());
+
+        const size_t width = PaddingKernels::slotWidth(type);
+        std::vector<char> out(4 * width);
+        std::vector<uint32_t> lengths(4);
+        Bitmap unfit(4);
+        EXPECT_EQ(PaddingKernels::padToSlots(type, std::span<const CompactString>(stored).first(4), out, lengths,
+                                             unfit.words()),
+                  0u);
+        const NCharType nchar{true, 20};
+        for (size_t i = 0; i < 4; ++i) {
+            EXPECT_EQ(std::string_view(out.data() + i * width, lengths[i]), nchar.formatValue(std::string(values[i])));
+        }
+
+        // Leídos como NCHAR(5), los valores de la columna más ancha que no caben se marcan
+        const TypeDescriptor narrow = TypeDescriptor::nchar(5);
+        std::vector<char> narrowOut(4 * PaddingKernels::slotWidth(narrow), '#');
+        EXPECT_EQ(PaddingKernels::padToSlots(narrow, std::span<const CompactString>(stored).first(4), narrowOut,
+                                             lengths, unfit.words()),
+                  1u);
+        EXPECT_EQ(unfit.toSelection(), (std::vector<uint32_t>{2}));
+        EXPECT_EQ(lengths[2], 0u);
+        EXPECT_EQ(std::string_view(narrowOut.data(), lengths[0]), "Y    ");
+    }
+
+} // namespace db::types::test
@@ -0,0 +1,23 @@
+// tests/core/types/PaddingKernelsTest.hpp
+#ifndef PADDING_KERNELS_TEST_HPP
+#define PADDING_KERNELS_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/kernels/PaddingKernels.hpp"
+#include "../../../src/core/types/CharType.hpp"
+#include "../../../src/core/types/NCharType.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class PaddingKernelsTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+
+        StringArena arena;
+    };
+
+} // namespace db::types::test
+
+#endif // PADDING_KERNELS_TEST_HPP
@@ -0,0 +1,127 @@
+// tests/core/types/StaticSchemaTest.cpp
+#include "StaticSchemaTest.hpp"
+#include <vector>
+
+namespace db::types::test {
+
+    TEST_F(StaticSchemaTest, LayoutShouldBeComputedAtCompileTime) {
+        static_assert(OrdersSchema::COLUMN_COUNT == 7);
+        static_assert(OrdersSchema::NULL_BITMAP_SIZE == 1);
+        static_assert(OrdersSchema::indexOf<"amount">() == 3);
+        static_assert(OrdersSchema::DESCRIPTORS[3] == TypeDescriptor::number(10, 2));
+        static_assert(OrdersSchema::DESCRIPTORS[4] == TypeDescriptor::timestamp(3, false));
+        static_assert(std::is_same_v<OrdersSchema::StorageAt<1>, int64_t>);
+        static_assert(std::is_same_v<OrdersSchema::StorageAt<3>, int64_t>);
+        static_assert(sizeof(OrdersSchema::Row) == OrdersSchema::ROW_SIZE);
+
+        // Cada columna está alineada y no se solapa con el bitmap ni con las demás
+        std::vector<std::pair<size_t, size_t>> ranges;
+        for (size_t i = 0; i < OrdersSchema::COLUMN_COUNT; ++i) {
+            EXPECT_EQ(OrdersSchema::OFFSETS[i] % OrdersSchema::ALIGNMENTS[i], 0u) << OrdersSchema::NAMES[i];
+            EXPECT_GE(OrdersSchema::OFFSETS[i], OrdersSchema::NULL_BITMAP_SIZE);
+            ranges.emplace_back(OrdersSchema::OFFSETS[i], OrdersSchema::OFFSETS[i] + OrdersSchema::SIZES[i]);
+        }
+        std::sort(ranges.begin(), ranges.end());
+        size_t used = OrdersSchema::NULL_BITMAP_SIZE;
+        for (size_t i = 0; i < ranges.size(); ++i) {
+            if (i > 0) {
+                EXPECT_LE(ranges[i - 1].second, ranges[i].first);
+            }
+            used += ranges[i].second - ranges[i].first;
+        }
+        // Ordenar por alineación deja como mucho el hueco tras el bitmap y el final
+        EXPECT_LT(OrdersSchema::ROW_SIZE - used, 2 * OrdersSchema::ALIGNMENT);
+    }
+
+    TEST_F(StaticSchemaTest, RowShouldRoundTripValues) {
+        OrdersSchema::Row row;
+        EXPECT_TRUE(row.isNull<"amount">());
+
+        row.set<"status">("A");
+        row.set<"id">(NumberValue::fromInt64(42));
+        row.set<"customer">("ACME");
+        row.set<"amount">(NumberValue::fromString("1234.5"));
+        row.set<"placed">(TimestampValue::fromCivil(2024, 3, 1, 10, 30, 0, 123'000'000));
+        row.set<"due">(DateValue::fromCivil(2024, 3, 31));
+
+        EXPECT_EQ(row.get<"status">(), "A");
+        EXPECT_EQ(row.get<"id">().toString(), "42");
+        EXPECT_EQ(row.get<"customer">(), "ACME");
+        EXPECT_EQ(row.get<"amount">().toString(), "1234.50");
+        EXPECT_EQ(row.getStored<3>(), 123450);
+        EXPECT_EQ(row.get<"placed">(), TimestampValue::fromCivil(2024, 3, 1, 10, 30, 0, 123'000'000));
+        EXPECT_EQ(row.get<"due">(), DateValue::fromCivil(2024, 3, 31));
+        EXPECT_TRUE(row.isNull<"note">());
+
+        std::vector<std::byte> encoded(OrdersSchema::ROW_SIZE);
+        OrdersSchema::encode(row, encoded);
+        const auto decoded = OrdersSchema::decode(encoded);
+        EXPECT_EQ(OrdersSchema::compare(row, decoded), 0);
+        EXPECT_EQ(decoded.get<"customer">(), "ACME");
+        EXPECT_TRUE(decoded.isNull<"note">());
+    }
+
+    TEST_F(StaticSchemaTest, SetShouldValidateWithTypeLimits) {
+        OrdersSchema::Row row;
+        EXPECT_EQ(row.trySet<"customer">("a customer name that is too long").error().code(),
+                  TypeErrorCode::VALUE_TOO_LONG);
+        EXPECT_TRUE(row.isNull<"customer">());
+
+        EXPECT_EQ(row.trySet<"amount">(NumberValue::fromString("123456789")).error().code(),
+                  TypeErrorCode::VALUE_OUT_OF_RANGE);
+        EXPECT_EQ(row.trySet<"note">("ñañañ").error().code(), TypeErrorCode::VALUE_TOO_MANY_CHARACTERS);
+        EXPECT_TRUE(row.trySet<"note">("ñaña"));
+        EXPECT_EQ(row.get<"note">(), "ñaña");
+        EXPECT_EQ(row.trySet<"placed">(TimestampValue::fromCivil(2024, 1, 1, 0, 0, 0, 1'500'000)).error().code(),
+                  TypeErrorCode::INVALID_TIMESTAMP);
+        EXPECT_THROW(row.set<"status">("AB"), DataTypeException);
+    }
+
+    TEST_F(StaticSchemaTest, TimestampColumnsShouldRejectForeignZonesAndYears) {
+        const auto reason = [](const TypeError& error) { return static_cast<TimestampError>(error.reason()); };
+        OrdersSchema::Row row;
+
+        // Columna sin zona: ni desplazamiento ni región
+        const auto zoned = row.trySet<"placed">(TimestampValue::fromCivil(2024, 1, 1, 10, 0, 0, 0, 60));
+        EXPECT_EQ(zoned.error().code(), TypeErrorCode::INVALID_TIMESTAMP);
+        EXPECT_EQ(reason(zoned.error()), TimestampError::TIME_ZONE_PRESENCE);
+        const auto region = TimestampValue::fromLocal(TimeZone::get("Europe/London"), 2024, 1, 1, 10, 0, 0);
+        EXPECT_EQ(region.getOffsetMinutes(), 0);
+        EXPECT_EQ(reason(row.trySet<"placed">(region).error()), TimestampError::TIME_ZONE_PRESENCE);
+        EXPECT_TRUE(row.isNull<"placed">());
+
+        // Año local fuera de [-4712, 9999]
+        const auto late = row.trySet<"placed">(TimestampValue::fromCivil(10000, 1, 1, 0, 0, 0));
+        EXPECT_EQ(late.error().code(), TypeErrorCode::INVALID_TIMESTAMP);
+        EXPECT_EQ(reason(late.error()), TimestampError::YEAR);
+        EXPECT_EQ(reason(row.trySet<"placed">(TimestampValue::fromCivil(-4713, 12, 31, 23, 59, 59)).error()),
+                  TimestampError::YEAR);
+        EXPECT_TRUE(row.trySet<"placed">(TimestampValue::fromCivil(9999, 12, 31, 23, 59, 59)));
+
+        // Con zona cuenta el año en la hora local: 9999-12-31 23:00 -02:00 ya es 10000 en UTC
+        using Zoned = TypeTraits<Timestamp<6, true>>;
+        EXPECT_TRUE(Zoned::encode(TimestampValue::fromCivil(9999, 12, 31, 23, 0, 0, 0, -120)));
+        EXPECT_TRUE(Zoned::encode(region));
+        EXPECT_EQ(reason(Zoned::encode(TimestampValue::fromCivil(10000, 1, 1, 1, 0, 0, 0, 120)).error()),
+                  TimestampError::YEAR);
+    }
+
+    TEST_F(StaticSchemaTest, CompareShouldUseTypeOrderWithNullsLast) {
+        OrdersSchema::Row low;
+        OrdersSchema::Row high;
+        low.set<"amount">(NumberValue::fromString("-5"));
+        high.set<"amount">(NumberValue::fromString("3.25"));
+        EXPECT_LT(OrdersSchema::compare<3>(low, high), 0);
+        EXPECT_GT(OrdersSchema::compare<3>(high, low), 0);
+
+        OrdersSchema::Row empty;
+        EXPECT_GT(OrdersSchema::compare<3>(empty, high), 0);
+        EXPECT_EQ(OrdersSchema::compare<3>(empty, OrdersSchema::Row{}), 0);
+
+        // Los CHAR se comparan con su relleno; el orden de fila sigue el del esquema
+        low.set<"status">("B");
+        high.set<"status">("A");
+        EXPECT_GT(OrdersSchema::compare(low, high), 0);
+    }
+
+} // namespace db::types::test
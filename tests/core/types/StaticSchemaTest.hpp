@@ -0,0 +1,27 @@
+// tests/core/types/StaticSchemaTest.hpp
+#ifndef STATIC_SCHEMA_TEST_HPP
+#define STATIC_SCHEMA_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/schema/StaticSchema.hpp"
+
+namespace db::types::test {
+
+    using OrdersSchema = StaticSchema<
+        Column<"status", Char<1>>,
+        Column<"id", Number<18>>,
+        Column<"customer", Varchar2<20>>,
+        Column<"amount", Number<10, 2>>,
+        Column<"placed", Timestamp<3>>,
+        Column<"due", Date>,
+        Column<"note", NVarchar2<4>>>;
+
+    class StaticSchemaTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // STATIC_SCHEMA_TEST_HPP
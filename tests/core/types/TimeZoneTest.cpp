@@ -0,0 +1,113 @@
+// tests/core/types/TimeZoneTest.cpp
+#include "TimeZoneTest.hpp"
+#include <vector>
+
+namespace db::types::test {
+
+    namespace {
+        int64_t utc(int year, int month, int day, int hour, int minute = 0) {
+            return TimestampValue::fromCivil(year, month, day, hour, minute, 0).getUtcSeconds();
+        }
+    }
+
+    TEST_F(TimeZoneTest, ShouldFindRegionsIgnoringCase) {
+        EXPECT_NE(TimeZone::find("Europe/Madrid"), nullptr);
+        EXPECT_EQ(TimeZone::find("europe/madrid"), TimeZone::find("Europe/Madrid"));
+        EXPECT_EQ(TimeZone::find("Mars/Olympus_Mons"), nullptr);
+        EXPECT_THROW((void)TimeZone::get("Mars/Olympus_Mons"), DataTypeException);
+        EXPECT_TRUE(TimestampType::isValidTimeZoneRegion("America/Lima"));
+
+        const TimeZone& lima = TimeZone::get("America/Lima");
+        EXPECT_EQ(TimeZone::byId(lima.getId()), &lima);
+        EXPECT_EQ(TimeZone::byId(TimeZone::FIXED_OFFSET_ID), nullptr);
+        EXPECT_GE(TimeZone::availableNames().size(), 20u);
+    }
+
+    TEST_F(TimeZoneTest, ShouldApplyDaylightSavingTransitions) {
+        const TimeZone& madrid = TimeZone::get("Europe/Madrid");
+        EXPECT_EQ(madrid.offsetAt(utc(2024, 3, 31, 0, 59)), 60);
+        EXPECT_EQ(madrid.offsetAt(utc(2024, 3, 31, 1, 0)), 120);
+        EXPECT_EQ(madrid.offsetAt(utc(2024, 10, 27, 0, 59)), 120);
+        EXPECT_EQ(madrid.offsetAt(utc(2024, 10, 27, 1, 0)), 60);
+        EXPECT_EQ(madrid.offsetAt(utc(1990, 10, 15, 12)), 60);   // Antes de 1996 el verano acababa en septiembre
+        EXPECT_EQ(madrid.offsetAt(utc(2250, 7, 1, 12)), 120);    // Fuera de la caché
+
+        const TimeZone& newYork = TimeZone::get("America/New_York");
+        EXPECT_EQ(newYork.offsetAt(utc(2024, 3, 10, 6, 59)), -300);
+        EXPECT_EQ(newYork.offsetAt(utc(2024, 3, 10, 7, 0)), -240);
+        EXPECT_EQ(newYork.offsetAt(utc(2024, 11, 3, 5, 59)), -240);
+        EXPECT_EQ(newYork.offsetAt(utc(2024, 11, 3, 6, 0)), -300);
+        EXPECT_EQ(newYork.offsetAt(utc(2000, 4, 2, 7, 0)), -240);
+
+        const TimeZone& sydney = TimeZone::get("Australia/Sydney");
+        EXPECT_EQ(sydney.offsetAt(utc(2024, 1, 15, 0)), 660);
+        EXPECT_EQ(sydney.offsetAt(utc(2024, 4, 6, 15, 59)), 660);
+        EXPECT_EQ(sydney.offsetAt(utc(2024, 4, 6, 16, 0)), 600);
+        EXPECT_EQ(sydney.offsetAt(utc(2024, 10, 5, 16, 0)), 660);
+
+        const TimeZone& lima = TimeZone::get("America/Lima");
+        EXPECT_EQ(lima.offsetAt(utc(2024, 1, 1, 0)), -300);
+        EXPECT_EQ(lima.offsetAt(utc(2024, 7, 1, 0)), -300);
+    }
+
+    TEST_F(TimeZoneTest, LocalTimesShouldResolveGapsAndOverlaps) {
+        const TimeZone& madrid = TimeZone::get("Europe/Madrid");
+        // 02:30 no existe el 31 de marzo: se lee con el desplazamiento anterior y pasa a ser 03:30 +02:00
+        const auto gap = TimestampValue::fromLocal(madrid, 2024, 3, 31, 2, 30, 0);
+        EXPECT_EQ(gap.getUtcSeconds(), utc(2024, 3, 31, 1, 30));
+        EXPECT_EQ(gap.getOffsetMinutes(), 120);
+        EXPECT_EQ(gap.getZoneId(), madrid.getId());
+        const auto format = DateTimeFormat::compile("YYYY-MM-DD HH24:MI TZH:TZM TZR");
+        EXPECT_EQ(format.format(gap), "2024-03-31 03:30 +02:00 Europe/Madrid");
+        // El mismo caso entrando por el modelo de formato con TZR
+        const auto parsed =
+            DateTimeFormat::compile("YYYY-MM-DD HH24:MI TZR").parseTimestamp("2024-03-31 02:30 Europe/Madrid");
+        EXPECT_EQ(parsed, gap);
+        EXPECT_EQ(format.format(parsed), "2024-03-31 03:30 +02:00 Europe/Madrid");
+        // 02:30 ocurre dos veces el 27 de octubre: se elige la primera
+        const auto overlap = TimestampValue::fromLocal(madrid, 2024, 10, 27, 2, 30, 0);
+        EXPECT_EQ(overlap.getUtcSeconds(), utc(2024, 10, 27, 0, 30));
+        EXPECT_EQ(overlap.getOffsetMinutes(), 120);
+        EXPECT_EQ(overlap.getZoneId(), madrid.getId());
+    }
+
+    TEST_F(TimeZoneTest, FormatModelsShouldUseRegionNames) {
+        const auto format = DateTimeFormat::compile("YYYY-MM-DD HH24:MI TZR");
+        const auto summer = format.parseTimestamp("2024-07-01 12:00 Europe/Madrid");
+        EXPECT_EQ(summer.getUtcSeconds(), utc(2024, 7, 1, 10));
+        EXPECT_EQ(format.format(summer), "2024-07-01 12:00 Europe/Madrid");
+        EXPECT_EQ(format.format(summer.atZone(TimeZone::get("America/Lima"))), "2024-07-01 05:00 America/Lima");
+        EXPECT_EQ(format.format(format.parseTimestamp("2024-07-01 12:00 -05:00")), "2024-07-01 12:00 -05:00");
+        EXPECT_THROW((void)format.parseTimestamp("2024-07-01 12:00 Nowhere/City"), DataTypeException);
+    }
+
+    TEST_F(TimeZoneTest, BatchConversionShouldMatchPerRowOffsets) {
+        const TimeZone& madrid = TimeZone::get("Europe/Madrid");
+        std::vector<int64_t> instants;
+        for (int64_t t = utc(2024, 3, 30, 0); t < utc(2024, 4, 1, 0); t += 1800) {
+            instants.push_back(t);
+        }
+        instants.push_back(utc(1969, 7, 1, 0));  // salto fuera del tramo en curso
+        instants.push_back(utc(2024, 10, 27, 1, 0));
+
+        std::vector<int64_t> local(instants.size());
+        TimeZoneKernels::toLocalSeconds(madrid, instants, local);
+        for (size_t i = 0; i < instants.size(); ++i) {
+            ASSERT_EQ(local[i], instants[i] + madrid.offsetAt(instants[i]) * 60) << "index " << i;
+        }
+
+        const std::vector<TimestampValue> values = {
+            TimestampValue::fromCivil(2024, 1, 1, 12, 0, 0), TimestampValue::fromCivil(2024, 7, 1, 12, 0, 0)
+        };
+        std::vector<TimestampValue> converted(values.size());
+        TimeZoneKernels::atTimeZone(madrid, values, converted);
+        EXPECT_EQ(converted[0], values[0]);
+        EXPECT_EQ(converted[0].getOffsetMinutes(), 60);
+        EXPECT_EQ(converted[1].getOffsetMinutes(), 120);
+
+        std::vector<DateValue> dates(values.size());
+        TimeZoneKernels::toLocalDates(madrid, values, dates);
+        EXPECT_EQ(dates[1], DateValue::fromCivil(2024, 7, 1, 14, 0, 0));
+    }
+
+} // namespace db::types::test
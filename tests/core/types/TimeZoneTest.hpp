@@ -0,0 +1,21 @@
+// tests/core/types/TimeZoneTest.hpp
+#ifndef TIME_ZONE_TEST_HPP
+#define TIME_ZONE_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/util/TimeZone.hpp"
+#include "../../../src/core/types/kernels/TimeZoneKernels.hpp"
+#include "../../../src/core/types/kernels/DateTimeFormat.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class TimeZoneTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // TIME_ZONE_TEST_HPP
@@ -241,6 +241,18 @@ namespace db::types::test {
                 0,
                 "Equal times in different timezones"
             ),
+            TestCase(
+                {2024, 1, 1, 23, 30, 0, 0, -60},  // -01:00, 2024-01-02 00:30 UTC
+                {2024, 1, 1, 1, 0, 0, 0, 0},      // UTC
+                1,
+                "Offset carrying past midnight"
+            ),
+            TestCase(
+                {2024, 3, 1, 0, 30, 0, 0, 60},    // +01:00, 2024-02-29 23:30 UTC
+                {2024, 2, 29, 23, 30, 0, 0, 0},   // UTC
+                0,
+                "Offset borrowing across a leap day"
+            ),
             TestCase(
                 {-4712, 1, 1, 0, 0, 0, 0, std::nullopt},
                 {9999, 12, 31, 23, 59, 59, 999999999, std::nullopt},
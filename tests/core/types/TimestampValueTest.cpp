@@ -0,0 +1,149 @@
+// tests/core/types/TimestampValueTest.cpp
+#include "TimestampValueTest.hpp"
+#include <vector>
+
+namespace db::types::test {
+
+    TEST_F(TimestampValueTest, ShouldNormalizeToUtc) {
+        const auto utc = TimestampValue::fromCivil(2024, 1, 2, 0, 30, 0);
+        const auto lima = TimestampValue::fromCivil(2024, 1, 1, 19, 30, 0, 0, -300);
+        const auto madrid = TimestampValue::fromCivil(2024, 1, 2, 1, 30, 0, 0, 60);
+
+        EXPECT_EQ(utc, lima);
+        EXPECT_EQ(utc, madrid);
+        EXPECT_EQ(lima.getUtcSeconds(), utc.getUtcSeconds());
+        EXPECT_EQ(lima.getOffsetMinutes(), -300);
+        EXPECT_EQ(TimestampValue::fromCivil(1969, 12, 31, 23, 59, 59, 999'999'999).getUtcSeconds(), -1);
+    }
+
+    TEST_F(TimestampValueTest, FieldsShouldRoundTripInOriginalOffset) {
+        const TimestampType tz{9, true};
+        const TimestampFields fields{2024, 2, 29, 23, 45, 10, 123'456'789, -300};
+
+        const TimestampFields result = TimestampValue::fromFields(tz, fields).toFields(tz);
+        EXPECT_EQ(result.year, 2024);
+        EXPECT_EQ(result.month, 2);
+        EXPECT_EQ(result.day, 29);
+        EXPECT_EQ(result.hour, 23);
+        EXPECT_EQ(result.minute, 45);
+        EXPECT_EQ(result.second, 10);
+        EXPECT_EQ(result.fraction, 123'456'789);
+        EXPECT_EQ(result.tzOffset, -300);
+
+        // La fracción va en unidades de la precisión de la columna
+        const TimestampType millis{3};
+        const auto value = TimestampValue::fromFields(millis, {-4712, 1, 1, 0, 0, 0, 250});
+        EXPECT_EQ(value.getNanos(), 250'000'000);
+        EXPECT_EQ(value.toFields(millis).fraction, 250);
+        EXPECT_EQ(value.toFields(millis).year, -4712);
+        EXPECT_FALSE(value.toFields(millis).tzOffset.has_value());
+    }
+
+    TEST_F(TimestampValueTest, FromFieldsShouldRejectInvalidTimestamps) {
+        const TimestampType ts{6};
+        EXPECT_THROW((void)TimestampValue::fromFields(ts, {2023, 2, 29}), DataTypeException);
+        EXPECT_THROW((void)TimestampValue::fromFields(ts, {2024, 1, 1, 0, 0, 0, 1'000'000}), DataTypeException);
+        EXPECT_THROW((void)TimestampValue::fromFields(ts, {2024, 1, 1, 0, 0, 0, 0, 60}), DataTypeException);
+    }
+
+    TEST_F(TimestampValueTest, ComparisonShouldIgnoreOffset) {
+        const auto early = TimestampValue::fromCivil(2024, 1, 1, 0, 0, 0, 1);
+        const auto late = TimestampValue::fromCivil(2024, 1, 1, 0, 0, 0, 2);
+        EXPECT_LT(early, late);
+        EXPECT_LT(TimestampValue::fromCivil(-1, 12, 31, 23, 59, 59, 999'999'999),
+                  TimestampValue::fromCivil(0, 1, 1, 0, 0, 0));
+        // 23:30 en -01:00 ya es el día siguiente en UTC
+        EXPECT_GT(TimestampValue::fromCivil(2024, 1, 1, 23, 30, 0, 0, -60),
+                  TimestampValue::fromCivil(2024, 1, 2, 0, 0, 0));
+    }
+
+    TEST_F(TimestampValueTest, BatchCompareShouldMatchScalarOrder) {
+        std::vector<TimestampValue> values;
+        for (int second = 0; second < 3; ++second) {
+            for (int nanos = 0; nanos < 3; ++nanos) {
+                values.push_back(TimestampValue::fromCivil(2024, 6, 1, 12, 0, second, nanos, second * 60 - 60));
+            }
+        }
+        const auto constant = TimestampValue::fromCivil(2024, 6, 1, 12, 0, 1, 1);
+
+        std::vector<int8_t> results(values.size());
+        TimestampKernels::compareBatch(values, constant, results);
+        for (size_t i = 0; i < values.size(); ++i) {
+            const auto order = values[i] <=> constant;
+            EXPECT_EQ(results[i], (order > 0) - (order < 0)) << "index " << i;
+        }
+    }
+
+    TEST_F(TimestampValueTest, SelectBetweenShouldBeInclusive) {
+        std::vector<TimestampValue> values;
+        for (int i = 0; i < 70; ++i) {
+            values.push_back(TimestampValue::fromCivil(2024, 1, 1, 0, 0, i / 2, (i % 2) * 500'000'000));
+        }
+        const Bitmap selected = TimestampKernels::selectBetween(values, values[3], values[66]);
+
+        EXPECT_EQ(selected.count(), 64u);
+        EXPECT_FALSE(selected.test(2));
+        EXPECT_TRUE(selected.test(3));
+        EXPECT_TRUE(selected.test(66));
+        EXPECT_FALSE(selected.test(67));
+    }
+
+    TEST_F(TimestampValueTest, ValidateShouldReportFirstInvalidField) {
+        const TimestampType type(3, false);
+        EXPECT_EQ(type.validate(2024, 2, 29, 23, 59, 59, 999), TimestampError::NONE);
+        EXPECT_EQ(type.validate(2023, 2, 29, 0, 0, 0), TimestampError::DAY);
+        EXPECT_EQ(type.validate(2024, 13, 1, 0, 0, 0), TimestampError::MONTH);
+        EXPECT_EQ(type.validate(10000, 13, 1, 0, 0, 0), TimestampError::YEAR);
+        EXPECT_EQ(type.validate(2024, 1, 1, 24, 0, 0), TimestampError::HOUR);
+        EXPECT_EQ(type.validate(2024, 1, 1, 0, 0, 0, 1000), TimestampError::FRACTION);
+        EXPECT_EQ(type.validate(2024, 1, 1, 0, 0, 0, 0, 60), TimestampError::TIME_ZONE_PRESENCE);
+
+        const TimestampType zoned(9, true);
+        EXPECT_EQ(zoned.validate(2024, 1, 1, 0, 0, 0, 999'999'999, 14 * 60), TimestampError::NONE);
+        EXPECT_EQ(zoned.validate(2024, 1, 1, 0, 0, 0, 0, 14 * 60 + 1), TimestampError::TIME_ZONE_OFFSET);
+        EXPECT_EQ(zoned.validate(2024, 1, 1, 0, 0, 0), TimestampError::TIME_ZONE_PRESENCE);
+    }
+
+    TEST_F(TimestampValueTest, BatchValidateShouldMatchScalarValidation) {
+        const TimestampType type(2, true);
+        std::vector<int> year, month, day, hour, minute, second, fraction, offset;
+        for (int i = 0; i < 130; ++i) {
+            year.push_back(i == 7 ? -4713 : 2000 + i);
+            month.push_back(i == 20 ? 0 : 1 + i % 12);
+            day.push_back(i == 65 ? 31 : 1 + i % 28);  // 65: 31 de junio
+            hour.push_back(i % 24);
+            minute.push_back(i == 100 ? 60 : i % 60);
+            second.push_back(i % 60);
+            fraction.push_back(i == 129 ? 100 : i % 100);
+            offset.push_back(i == 64 ? -841 : (i % 29 - 14) * 60);
+        }
+        const TimestampFieldColumns<const int> fields{year, month, day, hour, minute, second, fraction, offset};
+        std::vector<uint64_t> invalid(Bitmap::wordsFor(year.size()));
+        std::vector<TimestampError> errors(year.size());
+        EXPECT_EQ(TimestampKernels::validate(type, fields, invalid, errors), 6u);
+
+        for (size_t i = 0; i < year.size(); ++i) {
+            const auto expected = type.validate(year[i], month[i], day[i], hour[i], minute[i], second[i],
+                                                fraction[i], offset[i]);
+            EXPECT_EQ(errors[i], expected) << "index " << i;
+            EXPECT_EQ((invalid[i / 64] >> (i % 64)) & 1u, expected != TimestampError::NONE ? 1u : 0u);
+        }
+        EXPECT_EQ(errors[7], TimestampError::YEAR);
+        EXPECT_EQ(errors[65], TimestampError::DAY);
+        EXPECT_EQ(errors[129], TimestampError::FRACTION);
+    }
+
+    TEST_F(TimestampValueTest, BatchValidateShouldRejectMissingTimeZoneColumn) {
+        const TimestampType type(0, true);
+        const std::vector<int> ones(3, 1);
+        const std::vector<int> zeros(3, 0);
+        const TimestampFieldColumns<const int> fields{ones, ones, ones, zeros, zeros, zeros, zeros, {}};
+        std::vector<uint64_t> invalid(1);
+        std::vector<TimestampError> errors(3);
+
+        EXPECT_EQ(TimestampKernels::validate(type, fields, invalid, errors), 3u);
+        EXPECT_EQ(invalid[0], 0b111u);
+        EXPECT_EQ(errors[1], TimestampError::TIME_ZONE_PRESENCE);
+    }
+
+} // namespace db::types::test
@@ -0,0 +1,20 @@
+// tests/core/types/TimestampValueTest.hpp
+#ifndef TIMESTAMP_VALUE_TEST_HPP
+#define TIMESTAMP_VALUE_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/values/TimestampValue.hpp"
+#include "../../../src/core/types/kernels/TimestampKernels.hpp"
+#include "../../../src/core/types/exceptions/DataTypeException.hpp"
+
+namespace db::types::test {
+
+    class TimestampValueTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // TIMESTAMP_VALUE_TEST_HPP
@@ -0,0 +1,72 @@
+// tests/core/types/TypeDescriptorTest.cpp
+#include "TypeDescriptorTest.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace db::types::test {
+
+    TEST_F(TypeDescriptorTest, DescriptorShouldMatchVirtualInterface) {
+        std::vector<std::unique_ptr<DataType>> types;
+        types.push_back(std::make_unique<NumberType>(true, 10, 2));
+        types.push_back(std::make_unique<NumberType>(false, 7, 0));
+        types.push_back(std::make_unique<Varchar2Type>(true, 100));
+        types.push_back(std::make_unique<CharType>(false, 5));
+        types.push_back(std::make_unique<NCharType>(true, 20));
+        types.push_back(std::make_unique<NVarchar2Type>(true, 300));
+        types.push_back(std::make_unique<DateType>(false));
+        types.push_back(std::make_unique<TimestampType>(0));
+        types.push_back(std::make_unique<TimestampType>(4, true));
+        types.push_back(std::make_unique<TimestampType>(9, true, false));
+
+        for (const auto& type : types) {
+            const TypeDescriptor descriptor = type->getDescriptor();
+            EXPECT_EQ(descriptor.getSize(), type->getSize()) << type->getName();
+            EXPECT_EQ(descriptor.isNullable(), type->isNullable()) << type->getName();
+
+            // El descriptor reconstruye un tipo equivalente
+            const std::string name = dispatchType(descriptor, [](const auto& concrete) {
+                return concrete.getName();
+            });
+            EXPECT_EQ(name, type->getName());
+            EXPECT_EQ(dispatchType(descriptor, [](const auto& concrete) { return concrete.getDescriptor(); }),
+                      descriptor);
+        }
+    }
+
+    TEST_F(TypeDescriptorTest, DescriptorShouldBeCompactValue) {
+        constexpr auto descriptor = TypeDescriptor::timestamp(6, true, false);
+        static_assert(descriptor.kind == TypeKind::TIMESTAMP);
+        static_assert(descriptor.hasTimeZone() && !descriptor.isNullable());
+        static_assert(TypeDescriptor::number(10, 2) != TypeDescriptor::number(10, 3));
+        static_assert(TypeDescriptor::varchar2(10).isString() && !TypeDescriptor::date().isString());
+        EXPECT_EQ(sizeof(TypeDescriptor), 8u);
+    }
+
+    TEST_F(TypeDescriptorTest, FindInvalidStringsShouldDispatchOncePerBatch) {
+        const std::vector<std::string_view> values = {"abc", "abcdef", "", "ñandú", "a\xC3", "abcd"};
+        std::vector<uint64_t> invalid(1);
+
+        EXPECT_EQ(TypeKernels::findInvalid(TypeDescriptor::varchar2(4), values, invalid), 2u);
+        EXPECT_EQ(invalid[0], 0b001010u);  // "abcdef" y "ñandú" (7 bytes)
+
+        EXPECT_EQ(TypeKernels::findInvalid(TypeDescriptor::nvarchar2(5), values, invalid), 2u);
+        EXPECT_EQ(invalid[0], 0b010010u);  // "abcdef" y UTF-8 mal formado
+
+        EXPECT_EQ(TypeKernels::findInvalid(TypeDescriptor::charType(3), values, invalid), 3u);
+
+        EXPECT_THROW(static_cast<void>(TypeKernels::findInvalid(TypeDescriptor::date(), values, invalid)),
+                     DataTypeException);
+    }
+
+    TEST_F(TypeDescriptorTest, FindInvalidNumbersShouldUseNumberRange) {
+        const std::vector<double> values = {1.5, 999.99, 1000.0, -999.994, -999.996};
+        std::vector<uint64_t> invalid(1);
+
+        EXPECT_EQ(TypeKernels::findInvalid(TypeDescriptor::number(5, 2), values, invalid), 2u);
+        EXPECT_EQ(invalid[0], 0b10100u);
+        EXPECT_THROW(static_cast<void>(TypeKernels::findInvalid(TypeDescriptor::varchar2(5), values, invalid)),
+                     DataTypeException);
+    }
+
+} // namespace db::types::test
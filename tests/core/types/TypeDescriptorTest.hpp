@@ -0,0 +1,19 @@
+// tests/core/types/TypeDescriptorTest.hpp
+#ifndef TYPE_DESCRIPTOR_TEST_HPP
+#define TYPE_DESCRIPTOR_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/TypeDispatch.hpp"
+#include "../../../src/core/types/kernels/TypeKernels.hpp"
+
+namespace db::types::test {
+
+    class TypeDescriptorTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // TYPE_DESCRIPTOR_TEST_HPP
@@ -0,0 +1,99 @@
+// tests/core/types/TypeErrorTest.cpp
+#include "TypeErrorTest.hpp"
+#include <string>
+
+namespace db::types::test {
+
+    TEST_F(TypeErrorTest, CheckLengthShouldReportCodeAndLimit) {
+        static_assert(CharType::checkLength(CharType::MAX_LENGTH).hasValue());
+        static_assert(!Varchar2Type::checkLength(0).hasValue());
+
+        const auto tooLong = NVarchar2Type::checkLength(NVarchar2Type::MAX_LENGTH + 1);
+        ASSERT_FALSE(tooLong);
+        EXPECT_EQ(tooLong.error().code(), TypeErrorCode::LENGTH_TOO_LARGE);
+        EXPECT_EQ(tooLong.error().detail(), NVarchar2Type::MAX_LENGTH);
+        EXPECT_EQ(tooLong.error().message(), "Length cannot exceed 4000");
+
+        EXPECT_EQ(NCharType::checkLength(0).error().code(), TypeErrorCode::LENGTH_ZERO);
+    }
+
+    TEST_F(TypeErrorTest, CheckPrecisionScaleShouldMatchConstructor) {
+        static_assert(NumberType::checkPrecisionScale(38, 10).hasValue());
+        EXPECT_EQ(NumberType::checkPrecisionScale(39, 0).error().code(), TypeErrorCode::PRECISION_TOO_LARGE);
+        EXPECT_EQ(NumberType::checkPrecisionScale(5, 6).error().code(), TypeErrorCode::SCALE_EXCEEDS_PRECISION);
+
+        const auto created = NumberType::tryCreate(true, 10, 2);
+        ASSERT_TRUE(created);
+        EXPECT_EQ(created->getScale(), 2u);
+        EXPECT_FALSE(NumberType::tryCreate(true, 5, 6));
+    }
+
+    TEST_F(TypeErrorTest, TryFormatValueShouldNotThrow) {
+        const CharType charType(true, 3);
+        const auto padded = charType.tryFormatValue("ab");
+        ASSERT_TRUE(padded);
+        EXPECT_EQ(*padded, "ab ");
+
+        const auto tooLong = charType.tryFormatValue("abcd");
+        ASSERT_FALSE(tooLong);
+        EXPECT_EQ(tooLong.error(), TypeError(TypeErrorCode::VALUE_TOO_LONG, 3));
+
+        const NCharType ncharType(true, 2);
+        const auto badUtf8 = ncharType.tryFormatValue("a\xC3");
+        ASSERT_FALSE(badUtf8);
+        EXPECT_EQ(badUtf8.error().code(), TypeErrorCode::INVALID_UTF8);
+        EXPECT_EQ(badUtf8.error().detail(), 1u);
+        EXPECT_EQ(ncharType.tryFormatValue("ñññ").error().code(), TypeErrorCode::VALUE_TOO_MANY_CHARACTERS);
+
+        const NVarchar2Type nvarcharType(true, 2);
+        EXPECT_EQ(nvarcharType.tryFormatValue("ñ").valueOr(std::string("fallback")), "ñ");
+        EXPECT_EQ(nvarcharType.tryFormatValue("ñññ").valueOr(std::string("fallback")), "fallback");
+    }
+
+    TEST_F(TypeErrorTest, DateTimeFormattingShouldReturnReason) {
+        const DateType dateType;
+        EXPECT_EQ(dateType.tryFormatDate(2023, 2, 29).error().code(), TypeErrorCode::INVALID_DATE);
+        EXPECT_EQ(*dateType.tryFormatDate(2024, 2, 29), dateType.formatDate(2024, 2, 29));
+
+        const TimestampType timestampType(2);
+        const auto error = timestampType.tryFormatTimestamp(2024, 1, 1, 0, 0, 0, 100).error();
+        EXPECT_EQ(error.code(), TypeErrorCode::INVALID_TIMESTAMP);
+        EXPECT_EQ(static_cast<TimestampError>(error.reason()), TimestampError::FRACTION);
+        EXPECT_EQ(error.message(), "Invalid timestamp: Fraction exceeds precision");
+    }
+
+    TEST_F(TypeErrorTest, FactoriesShouldReturnErrorsInsteadOfThrowing) {
+        const auto varchar = StringTypeFactory::tryCreateVarchar2(100);
+        ASSERT_TRUE(varchar);
+        EXPECT_EQ((*varchar)->getName(), "VARCHAR2(100)");
+
+        const auto tooLong = StringTypeFactory::tryCreateChar(CharType::MAX_LENGTH + 1);
+        ASSERT_FALSE(tooLong);
+        EXPECT_EQ(tooLong.error().code(), TypeErrorCode::LENGTH_TOO_LARGE);
+        EXPECT_EQ(StringTypeFactory::tryCreateNChar(0).error().code(), TypeErrorCode::LENGTH_ZERO);
+        EXPECT_TRUE(StringTypeFactory::tryCreateNVarchar2(10));
+
+        EXPECT_EQ(NumericTypeFactory::tryCreateDecimal(5, 6).error().code(),
+                  TypeErrorCode::SCALE_EXCEEDS_PRECISION);
+        EXPECT_TRUE(NumericTypeFactory::tryCreateNumber(true, 10, 2));
+    }
+
+    TEST_F(TypeErrorTest, ValueShouldThrowWithErrorCode) {
+        const CharType charType(true, 1);
+        try {
+            static_cast<void>(charType.tryFormatValue("ab").value());
+            FAIL() << "Expected DataTypeException";
+        } catch (const DataTypeException& e) {
+            EXPECT_EQ(e.error().code(), TypeErrorCode::VALUE_TOO_LONG);
+            EXPECT_NE(std::string(e.what()).find("Value exceeds maximum length of 1"), std::string::npos);
+        }
+
+        try {
+            static_cast<void>(NumberType(true, 39, 0));
+            FAIL() << "Expected DataTypeException";
+        } catch (const DataTypeException& e) {
+            EXPECT_EQ(e.error().code(), TypeErrorCode::PRECISION_TOO_LARGE);
+        }
+    }
+
+} // namespace db::types::test
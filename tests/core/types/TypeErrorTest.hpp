@@ -0,0 +1,22 @@
+// tests/core/types/TypeErrorTest.hpp
+#ifndef TYPE_ERROR_TEST_HPP
+#define TYPE_ERROR_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/util/Expected.hpp"
+#include "../../../src/core/types/factories/NumericTypeFactory.hpp"
+#include "../../../src/core/types/factories/StringTypeFactory.hpp"
+#include "../../../src/core/types/DateType.hpp"
+#include "../../../src/core/types/TimestampType.hpp"
+
+namespace db::types::test {
+
+    class TypeErrorTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // TYPE_ERROR_TEST_HPP
@@ -0,0 +1,108 @@
+// tests/core/types/TypeRegistryTest.cpp
+#include "TypeRegistryTest.hpp"
+#include <thread>
+#include <vector>
+
+namespace db::types::test {
+
+    TEST_F(TypeRegistryTest, EqualTypesShouldShareOneDescriptor) {
+        const TypeHandle first = registry.number(10, 2);
+        const TypeHandle second = registry.number(10, 2);
+        EXPECT_EQ(first, second);
+        EXPECT_EQ(first.get(), second.get());
+        EXPECT_EQ(first->getName(), "NUMBER(10,2)");
+        EXPECT_EQ(first.getKind(), TypeKind::NUMBER);
+
+        EXPECT_NE(registry.number(10, 2, false), first);
+        EXPECT_NE(registry.varchar2(100), registry.nvarchar2(100));
+        EXPECT_EQ(registry.date(), registry.date(true));
+        EXPECT_EQ(registry.timestamp(12), registry.timestamp(9));
+        EXPECT_EQ(registry.size(), 6u);
+    }
+
+    TEST_F(TypeRegistryTest, InvalidTypesShouldThrowOrReturnErrors) {
+        EXPECT_THROW(static_cast<void>(registry.number(39)), DataTypeException);
+        EXPECT_THROW(static_cast<void>(registry.charType(0)), DataTypeException);
+
+        const auto tooLong = registry.intern(TypeDescriptor::varchar2(4001));
+        ASSERT_FALSE(tooLong);
+        EXPECT_EQ(tooLong.error().code(), TypeErrorCode::LENGTH_TOO_LARGE);
+        EXPECT_EQ(registry.size(), 0u);
+    }
+
+    TEST_F(TypeRegistryTest, ParseShouldMapDdlToInternedHandles) {
+        struct TestCase {
+            std::string_view ddl;
+            TypeHandle expected;
+        };
+        const std::vector<TestCase> cases = {
+            {"NUMBER(10,2)", registry.number(10, 2)},
+            {"number ( 10 , 2 )", registry.number(10, 2)},
+            {"NUMBER", registry.number()},
+            {"INTEGER NOT NULL", registry.number(38, 0, false)},
+            {"DECIMAL(5)", registry.number(5)},
+            {"VARCHAR2(100 BYTE) NOT NULL", registry.varchar2(100, false)},
+            {"varchar(20) null", registry.varchar2(20)},
+            {"CHAR", registry.charType(1)},
+            {"CHAR(10)", registry.charType(10)},
+            {"NCHAR(5)", registry.nchar(5)},
+            {"NVARCHAR2(200)", registry.nvarchar2(200)},
+            {"DATE", registry.date()},
+            {"TIMESTAMP", registry.timestamp(6)},
+            {"TIMESTAMP(6) WITH TIME ZONE", registry.timestamp(6, true)},
+            {"  timestamp(3) with time zone not null  ", registry.timestamp(3, true, false)},
+        };
+
+        for (const auto& testCase : cases) {
+            const auto parsed = registry.parse(testCase.ddl);
+            ASSERT_TRUE(parsed) << testCase.ddl << ": " << parsed.error().message();
+            EXPECT_EQ(*parsed, testCase.expected) << testCase.ddl;
+        }
+    }
+
+    TEST_F(TypeRegistryTest, ParseShouldReportErrorPosition) {
+        const auto unknown = registry.parse("BLOB");
+        ASSERT_FALSE(unknown);
+        EXPECT_EQ(unknown.error().code(), TypeErrorCode::INVALID_TYPE_SYNTAX);
+        EXPECT_EQ(unknown.error().detail(), 0u);
+
+        EXPECT_EQ(registry.parse("NUMBER(10,").error().detail(), 10u);
+        EXPECT_EQ(registry.parse("VARCHAR2").error().code(), TypeErrorCode::INVALID_TYPE_SYNTAX);
+        EXPECT_EQ(registry.parse("NUMBERS").error().code(), TypeErrorCode::INVALID_TYPE_SYNTAX);
+        EXPECT_EQ(registry.parse("DATE NOT").error().code(), TypeErrorCode::INVALID_TYPE_SYNTAX);
+        EXPECT_EQ(registry.parse("TIMESTAMP WITH LOCAL TIME ZONE").error().code(),
+                  TypeErrorCode::INVALID_TYPE_SYNTAX);
+
+        EXPECT_EQ(registry.parse("NUMBER(5,6)").error().code(), TypeErrorCode::SCALE_EXCEEDS_PRECISION);
+        EXPECT_EQ(registry.parse("TIMESTAMP(10)").error().code(), TypeErrorCode::PRECISION_TOO_LARGE);
+        EXPECT_EQ(registry.parse("CHAR(99999999999)").error().code(), TypeErrorCode::LENGTH_TOO_LARGE);
+    }
+
+    TEST_F(TypeRegistryTest, ConcurrentInternShouldReturnSameHandle) {
+        constexpr size_t THREADS = 8;
+        std::vector<TypeHandle> handles(THREADS);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < THREADS; ++t) {
+            threads.emplace_back([&, t] {
+                for (size_t length = 1; length <= 200; ++length) {
+                    static_cast<void>(registry.varchar2(length));
+                }
+                handles[t] = *registry.parse("VARCHAR2(100)");
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(registry.size(), 200u);
+        for (const TypeHandle handle : handles) {
+            EXPECT_EQ(handle, registry.varchar2(100));
+        }
+    }
+
+    TEST_F(TypeRegistryTest, InstanceShouldBeShared) {
+        EXPECT_EQ(&TypeRegistry::instance(), &TypeRegistry::instance());
+        EXPECT_EQ(TypeRegistry::instance().date(), TypeRegistry::instance().date());
+    }
+
+} // namespace db::types::test
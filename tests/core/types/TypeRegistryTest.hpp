@@ -0,0 +1,20 @@
+// tests/core/types/TypeRegistryTest.hpp
+#ifndef TYPE_REGISTRY_TEST_HPP
+#define TYPE_REGISTRY_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/TypeRegistry.hpp"
+
+namespace db::types::test {
+
+    class TypeRegistryTest : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+
+        TypeRegistry registry;
+    };
+
+} // namespace db::types::test
+
+#endif // TYPE_REGISTRY_TEST_HPP
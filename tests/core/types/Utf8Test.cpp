@@ -0,0 +1,63 @@
+// tests/core/types/Utf8Test.cpp
+#include "Utf8Test.hpp"
+#include <string>
+
+namespace db::types::test {
+
+    TEST_F(Utf8Test, ValidateShouldCountCodePoints) {
+        struct TestCase {
+            std::string value;
+            size_t expectedCodePoints;
+            std::string description;
+        };
+
+        const TestCase testCases[] = {
+            {"", 0, "Empty string"},
+            {"Hello", 5, "ASCII string"},
+            {std::string(100, 'a'), 100, "Long ASCII crossing SIMD blocks"},
+            {"こんにちは", 5, "Japanese characters"},
+            {std::string(31, 'a') + "ñ" + std::string(40, 'b'), 72, "Multibyte across block boundary"},
+            {"🌟⭐✨", 3, "Emojis"},
+            {"\xF4\x8F\xBF\xBF", 1, "Maximum code point"}
+        };
+
+        for (const auto& tc : testCases) {
+            const Utf8Validation result = validateUtf8(tc.value);
+            EXPECT_TRUE(result.valid) << "Failed for " << tc.description;
+            EXPECT_EQ(result.codePoints, tc.expectedCodePoints) << "Failed for " << tc.description;
+            EXPECT_EQ(countUtf8CodePoints(tc.value), tc.expectedCodePoints) << "Failed for " << tc.description;
+        }
+    }
+
+    TEST_F(Utf8Test, ValidateShouldReportExactErrorOffset) {
+        struct TestCase {
+            std::string value;
+            size_t expectedOffset;
+            size_t expectedCodePoints;
+            std::string description;
+        };
+
+        const TestCase testCases[] = {
+            {"abc\x80", 3, 3, "Stray continuation byte"},
+            {"ab\xC0\xAF", 2, 2, "Overlong encoding"},
+            {"\xED\xA0\x80", 0, 0, "UTF-16 surrogate"},
+            {"\xF4\x90\x80\x80", 0, 0, "Beyond U+10FFFF"},
+            {"あい\xE3\x81", 6, 2, "Truncated sequence"},
+            {std::string(40, 'x') + "\xFF", 40, 40, "Invalid byte after ASCII blocks"}
+        };
+
+        for (const auto& tc : testCases) {
+            const Utf8Validation result = validateUtf8(tc.value);
+            EXPECT_FALSE(result.valid) << "Failed for " << tc.description;
+            EXPECT_EQ(result.errorOffset, tc.expectedOffset) << "Failed for " << tc.description;
+            EXPECT_EQ(result.codePoints, tc.expectedCodePoints) << "Failed for " << tc.description;
+        }
+    }
+
+    TEST_F(Utf8Test, IsAsciiShouldDetectHighBytes) {
+        EXPECT_TRUE(isAscii(std::string(70, 'z')));
+        EXPECT_FALSE(isAscii(std::string(50, 'z') + "é"));
+        EXPECT_FALSE(isAscii("é" + std::string(50, 'z')));
+    }
+
+} // namespace db::types::test
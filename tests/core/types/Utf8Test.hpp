@@ -0,0 +1,18 @@
+// tests/core/types/Utf8Test.hpp
+#ifndef UTF8_TEST_HPP
+#define UTF8_TEST_HPP
+
+#include <gtest/gtest.h>
+#include "../../../src/core/types/util/Utf8.hpp"
+
+namespace db::types::test {
+
+    class Utf8Test : public ::testing::Test {
+    protected:
+        void SetUp() override {}
+        void TearDown() override {}
+    };
+
+} // namespace db::types::test
+
+#endif // UTF8_TEST_HPP